@@ -33,8 +33,19 @@ bisearch_cat(wint_t ucs, const struct _category *table, int max)
   return -1;
 }
 
+#if !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+/* two-stage table of the categories of planes 0-3, see mkcategories */
+#include "catblocks.t"
+#endif
+
 enum category category(wint_t ucs)
 {
+#ifdef CAT_LIMIT
+  if (ucs < CAT_LIMIT)
+    return (enum category)
+	   (category_blocks[category_pages[ucs >> CAT_BLOCK_SHIFT]]
+			   [ucs & ((1 << CAT_BLOCK_SHIFT) - 1)] - 1);
+#endif
   return bisearch_cat(ucs, categories,
 		      sizeof(categories) / sizeof(*categories) - 1);
 }
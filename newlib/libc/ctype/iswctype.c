@@ -1,6 +1,6 @@
 /*
 FUNCTION
-	<<iswctype>>, <<iswctype_l>>---extensible wide-character test
+	<<iswctype>>, <<iswctype_l>>, <<wmemctype>>---extensible wide-character test
 
 INDEX
 	iswctype
@@ -8,6 +8,9 @@ INDEX
 INDEX
 	iswctype_l
 
+INDEX
+	wmemctype
+
 SYNOPSIS
 	#include <wctype.h>
 	int iswctype(wint_t <[c]>, wctype_t <[desc]>);
@@ -15,6 +18,9 @@ SYNOPSIS
 	#include <wctype.h>
 	int iswctype_l(wint_t <[c]>, wctype_t <[desc]>, locale_t <[locale]>);
 
+	#include <wctype.h>
+	size_t wmemctype(const wchar_t *<[s]>, size_t <[n]>, wctype_t <[desc]>);
+
 DESCRIPTION
 <<iswctype>> is a function which classifies wide-character values using the
 wide-character test specified by <[desc]>.
@@ -23,17 +29,27 @@ wide-character test specified by <[desc]>.
 locale specified by the locale object locale.  If <[locale]> is
 LC_GLOBAL_LOCALE or not a valid locale object, the behaviour is undefined.
 
+<<wmemctype>> applies the test specified by <[desc]> to the <[n]> wide
+characters starting at <[s]>, as <<iswctype>> would, and stops at the first
+one which does not match.  Null wide characters are tested like any other.
+
 RETURNS
 <<iswctype>>, <<iswctype_l>> return non-zero if and only if <[c]> matches
 the test specified by <[desc]>.  If <[desc]> is unknown, zero is returned.
 
+<<wmemctype>> returns the number of leading characters of <[s]> which match
+the test, <[n]> if all of them do.  If <[desc]> is unknown, zero is
+returned.
+
 PORTABILITY
 <<iswctype>> is C99.
 <<iswctype_l>> is POSIX-1.2008.
+<<wmemctype>> is a newlib extension.
 
 No supporting OS subroutines are required.
 */
 #include <_ansi.h>
+#include <ctype.h>
 #include <wctype.h>
 #include "local.h"
 
@@ -73,3 +89,96 @@ iswctype (wint_t c, wctype_t desc)
   /* otherwise unknown */
   return 0;
 }
+
+/* _ctype_ classes of ASCII characters, the same in all locales */
+static const char ascii_class[] = {
+  0,
+  _U|_L|_N,		/* WC_ALNUM */
+  _U|_L,		/* WC_ALPHA */
+  _B,			/* WC_BLANK, besides '\t' */
+  _C,			/* WC_CNTRL */
+  _N,			/* WC_DIGIT */
+  _P|_U|_L|_N,		/* WC_GRAPH */
+  _L,			/* WC_LOWER */
+  _P|_U|_L|_N|_B,	/* WC_PRINT */
+  _P,			/* WC_PUNCT */
+  _S,			/* WC_SPACE */
+  _U,			/* WC_UPPER */
+  _X|_N			/* WC_XDIGIT */
+};
+
+/* The class and the locale are resolved once.  ASCII characters are
+   looked up in _ctype_, which agrees with the Unicode categories used by
+   the isw* functions, except in the JIS, SJIS and EUCJP locales whose
+   wide characters are not Unicode: there every character goes through
+   the isw* function and so through _jp2uc_l.  */
+size_t
+wmemctype (const wchar_t *s, size_t n, wctype_t desc)
+{
+  struct __locale_t *locale = __get_current_locale ();
+  int (*isw) (wint_t, struct __locale_t *);
+  char mask;
+  size_t i;
+  wint_t c;
+  wint_t ascii_end = 0x80;
+
+  switch (desc)
+    {
+    case WC_ALNUM:
+      isw = iswalnum_l;
+      break;
+    case WC_ALPHA:
+      isw = iswalpha_l;
+      break;
+    case WC_BLANK:
+      isw = iswblank_l;
+      break;
+    case WC_CNTRL:
+      isw = iswcntrl_l;
+      break;
+    case WC_DIGIT:
+      isw = iswdigit_l;
+      break;
+    case WC_GRAPH:
+      isw = iswgraph_l;
+      break;
+    case WC_LOWER:
+      isw = iswlower_l;
+      break;
+    case WC_PRINT:
+      isw = iswprint_l;
+      break;
+    case WC_PUNCT:
+      isw = iswpunct_l;
+      break;
+    case WC_SPACE:
+      isw = iswspace_l;
+      break;
+    case WC_UPPER:
+      isw = iswupper_l;
+      break;
+    case WC_XDIGIT:
+      isw = iswxdigit_l;
+      break;
+    default:
+      return 0;
+    }
+
+#ifdef _MB_CAPABLE
+  if (_locale_is_jp (locale))
+    ascii_end = 0;
+#endif
+  mask = ascii_class[desc];
+  for (i = 0; i < n; i++)
+    {
+      c = s[i];
+      if (c < ascii_end)
+	{
+	  if (!((_ctype_ + 1)[c] & mask) && !(desc == WC_BLANK && c == L'\t'))
+	    break;
+	}
+      else if (!isw (c, locale))
+	break;
+    }
+  return i;
+}
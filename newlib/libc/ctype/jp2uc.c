@@ -196,5 +196,13 @@ _uc2jp_l (wint_t c, struct __locale_t * l)
   return c;
 }
 
+int
+_locale_is_jp (struct __locale_t * l)
+{
+  const char * cs = __locale_charset(l);
+  return 0 == strcmp (cs, "JIS") || 0 == strcmp (cs, "SJIS")
+	 || 0 == strcmp (cs, "EUCJP");
+}
+
 #endif /* !__CYGWIN__ */
 #endif /* _MB_CAPABLE */
@@ -37,8 +37,11 @@
 #define _jp2uc(c) (c)
 #define _jp2uc_l(c, l) (c)
 #define _uc2jp_l(c, l) (c)
+#define _locale_is_jp(l) 0
 #else
 wint_t _jp2uc (wint_t);
 wint_t _jp2uc_l (wint_t, struct __locale_t *);
 wint_t _uc2jp_l (wint_t, struct __locale_t *);
+/* nonzero if the wide characters of the locale are JIS, SJIS or EUCJP */
+int _locale_is_jp (struct __locale_t *);
 #endif
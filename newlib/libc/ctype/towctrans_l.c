@@ -2,6 +2,7 @@
 #include <_ansi.h>
 #include <wctype.h>
 #include <stdint.h>
+#include <string.h>
 //#include <errno.h>
 #include "local.h"
 
@@ -70,12 +71,8 @@ bisearch (wint_t ucs, const struct caseconv_entry *table, int max)
 }
 
 static wint_t
-toulower (wint_t c)
+lower_by (wint_t c, const struct caseconv_entry *cce)
 {
-  const struct caseconv_entry * cce =
-    bisearch(c, caseconv_table,
-             sizeof(caseconv_table) / sizeof(*caseconv_table) - 1);
-
   if (cce)
     switch (cce->mode)
       {
@@ -105,12 +102,8 @@ toulower (wint_t c)
 }
 
 static wint_t
-touupper (wint_t c)
+upper_by (wint_t c, const struct caseconv_entry *cce)
 {
-  const struct caseconv_entry * cce =
-    bisearch(c, caseconv_table,
-             sizeof(caseconv_table) / sizeof(*caseconv_table) - 1);
-
   if (cce)
     switch (cce->mode)
       {
@@ -139,6 +132,20 @@ touupper (wint_t c)
   return c;
 }
 
+static wint_t
+toulower (wint_t c)
+{
+  return lower_by (c, bisearch(c, caseconv_table,
+			       sizeof(caseconv_table) / sizeof(*caseconv_table) - 1));
+}
+
+static wint_t
+touupper (wint_t c)
+{
+  return upper_by (c, bisearch(c, caseconv_table,
+			       sizeof(caseconv_table) / sizeof(*caseconv_table) - 1));
+}
+
 wint_t
 towctrans_l (wint_t c, wctrans_t w, struct __locale_t *locale)
 {
@@ -160,3 +167,222 @@ towctrans_l (wint_t c, wctrans_t w, struct __locale_t *locale)
   else
     return c;
 }
+
+/*
+   Bulk case conversion.  The locale is resolved once per call, ASCII
+   characters are converted without table lookups, and for the others
+   the table entry found last is tried first since text tends to stay
+   within one script.
+ */
+
+static wint_t
+trans_cached (wint_t c, wctrans_t w, const struct caseconv_entry **cce)
+{
+  const struct caseconv_entry *e = *cce;
+
+  if (!e || c < first((*e)) || c > last((*e)))
+    {
+      e = bisearch(c, caseconv_table,
+		   sizeof(caseconv_table) / sizeof(*caseconv_table) - 1);
+      if (!e)
+	return c;
+      *cce = e;
+    }
+  return w == WCT_TOLOWER ? lower_by (c, e) : upper_by (c, e);
+}
+
+/* flip case of ASCII letters from 'from' to 'from' + 25 */
+#define ASCII_TRANS(c, from) \
+  ((c) ^ (((wint_t)(c) - (from) < 26) << 5))
+
+static wchar_t *
+wmemtrans (wchar_t *dst, const wchar_t *src, size_t n, wctrans_t w)
+{
+#ifdef _MB_CAPABLE
+  struct __locale_t *locale = __get_current_locale ();
+  const struct caseconv_entry *cce = 0;
+  wint_t from = w == WCT_TOLOWER ? L'A' : L'a';
+  size_t i = 0, j, end;
+  wint_t any;
+
+  if (_locale_is_jp (locale))
+    {
+      for (i = 0; i < n; i++)
+	dst[i] = towctrans_l (src[i], w, locale);
+      return dst;
+    }
+
+  while (i < n)
+    {
+      /* blocks of 8 ASCII characters, converted without branches */
+      if (n - i >= 8)
+	{
+	  for (any = 0, j = 0; j < 8; j++)
+	    any |= (wint_t)src[i + j];
+	  if (any < 0x80)
+	    {
+	      for (j = 0; j < 8; j++)
+		dst[i + j] = ASCII_TRANS (src[i + j], from);
+	      i += 8;
+	      continue;
+	    }
+	}
+
+      /* otherwise up to 8 characters one by one */
+      for (end = i + (n - i < 8 ? n - i : 8); i < end; i++)
+	if ((wint_t)src[i] < 0x80)
+	  dst[i] = ASCII_TRANS (src[i], from);
+	else
+	  dst[i] = trans_cached (src[i], w, &cce);
+    }
+#else
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    dst[i] = w == WCT_TOLOWER ? towlower (src[i]) : towupper (src[i]);
+#endif /* _MB_CAPABLE */
+  return dst;
+}
+
+/* mask of the high bits of every byte of a word */
+#define HIGHBITS ((unsigned long)-1 / 0xFF * 0x80)
+#define ONES ((unsigned long)-1 / 0xFF)
+
+static size_t
+utf8trans (char *dst, size_t dstsize, const char *src, size_t srclen,
+	   wctrans_t w)
+{
+  const unsigned char *s = (const unsigned char *) src;
+  const unsigned char *end = s + srclen;
+  const struct caseconv_entry *cce = 0;
+  unsigned char from = w == WCT_TOLOWER ? 'A' : 'a';
+  /* adding these sets the high bit of bytes >= from, > from + 25 */
+  unsigned long ge = ONES * (0x80 - from);
+  unsigned long gt = ONES * (0x80 - from - 26);
+  unsigned char buf[4];
+  unsigned long x;
+  size_t len = 0, k, m;
+  wint_t c;
+
+  while (s < end)
+    {
+      /* words of ASCII characters */
+      if ((size_t)(end - s) >= sizeof (x) && len + sizeof (x) <= dstsize)
+	{
+	  memcpy (&x, s, sizeof (x));
+	  if ((x & HIGHBITS) == 0)
+	    {
+	      x ^= ((x + ge) & ~(x + gt) & HIGHBITS) >> 2;
+	      memcpy (dst + len, &x, sizeof (x));
+	      s += sizeof (x);
+	      len += sizeof (x);
+	      continue;
+	    }
+	}
+
+      /* decode one character, invalid bytes are copied as they are */
+      c = s[0];
+      k = 1;
+      if (c < 0x80)
+	c = ASCII_TRANS (c, from);
+      else
+	{
+	  if (c >= 0xc2 && c <= 0xdf && end - s >= 2
+	      && (s[1] & 0xc0) == 0x80)
+	    {
+	      c = (c & 0x1f) << 6 | (s[1] & 0x3f);
+	      k = 2;
+	    }
+	  else if (c >= 0xe0 && c <= 0xef && end - s >= 3
+		   && (s[1] & 0xc0) == 0x80 && (s[2] & 0xc0) == 0x80
+		   && (c != 0xe0 || s[1] >= 0xa0)
+		   && (c != 0xed || s[1] < 0xa0))
+	    {
+	      c = (c & 0x0f) << 12 | (s[1] & 0x3f) << 6 | (s[2] & 0x3f);
+	      k = 3;
+	    }
+	  else if (c >= 0xf0 && c <= 0xf4 && end - s >= 4
+		   && (s[1] & 0xc0) == 0x80 && (s[2] & 0xc0) == 0x80
+		   && (s[3] & 0xc0) == 0x80
+		   && (c != 0xf0 || s[1] >= 0x90)
+		   && (c != 0xf4 || s[1] < 0x90))
+	    {
+	      c = (c & 0x07) << 18 | (s[1] & 0x3f) << 12
+		  | (s[2] & 0x3f) << 6 | (s[3] & 0x3f);
+	      k = 4;
+	    }
+	  if (k > 1)
+	    c = trans_cached (c, w, &cce);
+	}
+
+      /* and encode it */
+      if (k == 1 || c < 0x80)
+	{
+	  buf[0] = c;
+	  m = 1;
+	}
+      else if (c < 0x800)
+	{
+	  buf[0] = 0xc0 | c >> 6;
+	  buf[1] = 0x80 | (c & 0x3f);
+	  m = 2;
+	}
+      else if (c < 0x10000)
+	{
+	  buf[0] = 0xe0 | c >> 12;
+	  buf[1] = 0x80 | ((c >> 6) & 0x3f);
+	  buf[2] = 0x80 | (c & 0x3f);
+	  m = 3;
+	}
+      else
+	{
+	  buf[0] = 0xf0 | c >> 18;
+	  buf[1] = 0x80 | ((c >> 12) & 0x3f);
+	  buf[2] = 0x80 | ((c >> 6) & 0x3f);
+	  buf[3] = 0x80 | (c & 0x3f);
+	  m = 4;
+	}
+
+      /* nothing is stored after the first character which doesn't fit */
+      if (len + m <= dstsize)
+	memcpy (dst + len, buf, m);
+      else
+	dstsize = 0;
+      s += k;
+      len += m;
+    }
+
+  return len;
+}
+
+/* Convert 'n' wide characters of 'src' to lowercase into 'dst' like
+   towlower; 'dst' may be 'src'.  */
+wchar_t *
+wmemtolower (wchar_t *dst, const wchar_t *src, size_t n)
+{
+  return wmemtrans (dst, src, n, WCT_TOLOWER);
+}
+
+/* Likewise to uppercase.  */
+wchar_t *
+wmemtoupper (wchar_t *dst, const wchar_t *src, size_t n)
+{
+  return wmemtrans (dst, src, n, WCT_TOUPPER);
+}
+
+/* Convert 'srclen' bytes of UTF-8 'src' to lowercase into the 'dstsize'
+   bytes of 'dst', independent of the locale.  Invalid bytes are copied
+   as they are.  The buffers must not overlap.  Returns the length of the
+   whole result, which was stored only if not greater than 'dstsize'.  */
+size_t
+utf8tolower (char *dst, size_t dstsize, const char *src, size_t srclen)
+{
+  return utf8trans (dst, dstsize, src, srclen, WCT_TOLOWER);
+}
+
+/* Likewise to uppercase.  */
+size_t
+utf8toupper (char *dst, size_t dstsize, const char *src, size_t srclen)
+{
+  return utf8trans (dst, dstsize, src, srclen, WCT_TOUPPER);
+}
@@ -36,6 +36,11 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <sys/lock.h>
+#include <sys/stat.h>
+#ifdef _POSIX_MAPPED_FILES
+#include <sys/mman.h>
+#endif
 #include <sys/iconvnls.h>
 #include "../lib/endian.h"
 #include "../lib/local.h"
@@ -68,6 +73,9 @@ find_code_speed_8bit (ucs2_t code, const unsigned char *tblp);
 #ifdef _ICONV_ENABLE_EXTERNAL_CCS
 static const iconv_ccs_desc_t *
 load_file (struct _reent *rptr, const char *name, int direction);
+
+static void
+unload_file (struct _reent *rptr, const iconv_ccs_desc_t *ccsp);
 #endif
 
 /*
@@ -79,8 +87,13 @@ table_close (struct _reent *rptr,
 {
   const iconv_ccs_desc_t *ccsp = (iconv_ccs_desc_t *)data;
 
+#ifdef _ICONV_ENABLE_EXTERNAL_CCS
   if (ccsp->type == TABLE_EXTERNAL)
-    _free_r (rptr, (void *)ccsp->tbl);
+    {
+      unload_file (rptr, ccsp);
+      return 0;
+    }
+#endif
 
   _free_r( rptr, (void *)ccsp);
   return 0;
@@ -433,8 +446,56 @@ find_code_size (ucs2_t code,
     ICONV_BETOHL(*((__uint32_t *)(buf + (offset))))
 
 /*
- * load_file - load conversion table from external file and initialize
- *             iconv_ccs_desc_t object.
+ * External tables are loaded once and shared by all the conversions which
+ * use them. The list of loaded tables is protected by
+ * '__iconv_ext_tables_mutex', the table is freed when the last conversion
+ * using it is closed. If the system supports mapped files, the table file
+ * is mapped read-only and tables are used in place, otherwise the needed
+ * table is read into memory.
+ */
+typedef struct ext_table
+{
+  /* Table description passed to conversions */
+  iconv_ccs_desc_t desc;
+  struct ext_table *next;
+  /* Conversion direction, see load_file */
+  int direction;
+  /* Number of conversions which use the table */
+  int refcount;
+  /* Mapped file, NULL if 'desc.tbl' was read into memory */
+  void *map;
+  size_t maplen;
+  /* CCS name */
+  char name[1];
+} ext_table_t;
+
+static ext_table_t *ext_tables = NULL;
+#ifndef __SINGLE_THREAD__
+__LOCK_INIT(static, __iconv_ext_tables_mutex);
+#endif
+
+/*
+ * free_table - release the table memory and the ext_table_t object.
+ *
+ * PARAMETERS:
+ *    struct _reent *rptr - reent structure of current thread/process.
+ *    ext_table_t *etp - table to free.
+ */
+static void
+free_table (struct _reent *rptr,
+                   ext_table_t *etp)
+{
+#ifdef _POSIX_MAPPED_FILES
+  if (etp->map != NULL)
+    munmap (etp->map, etp->maplen);
+  else
+#endif
+    _free_r (rptr, (void *)etp->desc.tbl);
+  _free_r (rptr, (void *)etp);
+}
+
+/*
+ * read_file - load conversion table from external file.
  *
  * PARAMETERS:
  *    struct _reent *rptr - reent structure of current thread/process.
@@ -443,62 +504,84 @@ find_code_size (ucs2_t code,
  *
  * DESCRIPTION:
  *    Loads conversion table of appropriate endianess from external file
- *    and initializes 'iconv_ccs_desc_t' table description structure.
+ *    and initializes 'ext_table_t' object with reference count 1.
  *    If 'direction' is 0 - load "To UCS" table, else load "From UCS"
  *    table.
  *
  * RETURN:
- *    iconv_ccs_desc_t * pointer is success, NULL if failure.
+ *    ext_table_t * pointer is success, NULL if failure.
  */
-static const iconv_ccs_desc_t *
-load_file (struct _reent *rptr,
+static ext_table_t *
+read_file (struct _reent *rptr,
                   const char *name,
                   int direction)
 {
   int fd;
-  const unsigned char *buf;
+  const unsigned char *buf = NULL;
+  __uint16_t *tbl;
   int tbllen, hdrlen;
   off_t off;
   const char *fname;
-  iconv_ccs_desc_t *ccsp = NULL;
+  ext_table_t *etp = NULL;
   int nmlen = strlen(name);
   /* Since CCS table name length can vary - it is aligned (by adding extra
    * bytes to it's end) to 4-byte boundary. */
   int alignment = nmlen & 3 ? 4 - (nmlen & 3) : 0;
-  
-  nmlen = strlen(name);
-  
+#ifdef _POSIX_MAPPED_FILES
+  struct stat st;
+  void *map;
+#endif
+
   hdrlen = nmlen + EXTTABLE_HEADER_LEN + alignment;
 
   if ((fname = _iconv_nls_construct_filename (rptr, name, ICONV_SUBDIR,
                                               ICONV_DATA_EXT)) == NULL)
     return NULL;
-  
+
   if ((fd = _open_r (rptr, fname, O_RDONLY, S_IRUSR)) == -1)
     goto error1;
-  
-  if ((buf = (const unsigned char *)_malloc_r (rptr, hdrlen)) == NULL)
+
+  if ((etp = (ext_table_t *)
+           _calloc_r (rptr, 1, sizeof (ext_table_t) + nmlen)) == NULL)
     goto error2;
 
-  if (_read_r (rptr, fd, (void *)buf, hdrlen) != hdrlen)
-    goto error3;
+  memcpy (etp->name, name, nmlen + 1);
+  etp->direction = direction;
+  etp->refcount = 1;
+  etp->desc.type = TABLE_EXTERNAL;
+
+#ifdef _POSIX_MAPPED_FILES
+  if (_fstat_r (rptr, fd, &st) == 0 && st.st_size >= hdrlen
+      && (map = mmap (NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0))
+         != MAP_FAILED)
+    {
+      etp->map = map;
+      etp->maplen = st.st_size;
+      buf = (const unsigned char *)map;
+    }
+#endif
+
+  /* Mapping failed or isn't supported - read the header */
+  if (buf == NULL)
+    {
+      if ((buf = (const unsigned char *)_malloc_r (rptr, hdrlen)) == NULL)
+        goto error3;
+
+      if (_read_r (rptr, fd, (void *)buf, hdrlen) != hdrlen)
+        goto error4;
+    }
 
   if (_16BIT_ELT (EXTTABLE_VERSION_OFF) != TABLE_VERSION_1
       || _32BIT_ELT (EXTTABLE_CCSNAME_LEN_OFF) != nmlen
       || strncmp (buf + EXTTABLE_CCSNAME_OFF, name, nmlen) != 0)
-    goto error3; /* Bad file */
+    goto error4; /* Bad file */
 
-  if ((ccsp = (iconv_ccs_desc_t *)
-           _calloc_r (rptr, 1, sizeof (iconv_ccs_desc_t))) == NULL)
-    goto error3;
-  
-  ccsp->bits = _16BIT_ELT (EXTTABLE_BITS_OFF);
-  ccsp->type = TABLE_EXTERNAL;
+  etp->desc.bits = _16BIT_ELT (EXTTABLE_BITS_OFF);
 
   /* Add 4-byte alignment to name length */
   nmlen += alignment;
 
-  if (ccsp->bits == TABLE_8BIT)
+  if (etp->desc.bits == TABLE_8BIT)
     {
       if (direction == 0) /* Load "To UCS" table */
         {
@@ -511,7 +594,7 @@ load_file (struct _reent *rptr,
           tbllen = _32BIT_ELT (nmlen + EXTTABLE_FROM_SPEED_LEN_OFF);
         }
     }
-  else if (ccsp->bits == TABLE_16BIT)
+  else if (etp->desc.bits == TABLE_16BIT)
     {
       if (direction == 0) /* Load "To UCS" table */
         {
@@ -534,9 +617,9 @@ load_file (struct _reent *rptr,
 #endif
         }
 #ifdef TABLE_USE_SIZE_OPTIMIZATION
-      ccsp->optimization = TABLE_SIZE_OPTIMIZED; 
+      etp->desc.optimization = TABLE_SIZE_OPTIMIZED;
 #else
-      ccsp->optimization = TABLE_SPEED_OPTIMIZED;
+      etp->desc.optimization = TABLE_SPEED_OPTIMIZED;
 #endif
     }
   else
@@ -545,38 +628,133 @@ load_file (struct _reent *rptr,
   if (off == EXTTABLE_NO_TABLE)
     goto error4; /* No correspondent table in file */
 
-  if ((ccsp->tbl = (ucs2_t *)_malloc_r (rptr, tbllen)) == NULL)
+  if (etp->map != NULL)
+    {
+      /* Use the table in place */
+      if (off < 0 || (off & 1) != 0 || tbllen < 0
+          || (size_t)off + tbllen > etp->maplen)
+        goto error4; /* Bad file */
+      etp->desc.tbl = (const __uint16_t *)(buf + off);
+      goto normal_exit;
+    }
+
+  if ((tbl = (__uint16_t *)_malloc_r (rptr, tbllen)) == NULL)
     goto error4;
 
   if (_lseek_r (rptr, fd, off, SEEK_SET) == (off_t)-1
-      || _read_r (rptr, fd, (void *)ccsp->tbl, tbllen) != tbllen)
+      || _read_r (rptr, fd, (void *)tbl, tbllen) != tbllen)
     goto error5;
 
+  etp->desc.tbl = tbl;
   goto normal_exit;
 
 error5:
-  _free_r (rptr, (void *)ccsp->tbl);
-  ccsp->tbl = NULL;
+  _free_r (rptr, (void *)tbl);
 error4:
-  _free_r (rptr, (void *)ccsp);
-  ccsp = NULL;
+#ifdef _POSIX_MAPPED_FILES
+  if (etp->map != NULL)
+    munmap (etp->map, etp->maplen);
+  else
+#endif
+    _free_r (rptr, (void *)buf);
 error3:
+  _free_r (rptr, (void *)etp);
+  etp = NULL;
+  goto error2;
 normal_exit:
-  _free_r (rptr, (void *)buf);
+  if (etp->map == NULL)
+    _free_r (rptr, (void *)buf);
 error2:
-  if (_close_r (rptr, fd) == -1)
+  if (_close_r (rptr, fd) == -1 && etp != NULL)
     {
-      if (ccsp != NULL)
-        {
-          if (ccsp->tbl != NULL)
-            _free_r (rptr, (void *)ccsp->tbl);
-          _free_r (rptr, (void *)ccsp);
-        }
-      ccsp = NULL;
+      free_table (rptr, etp);
+      etp = NULL;
     }
 error1:
   _free_r (rptr, (void *)fname);
-  return ccsp;
+  return etp;
+}
+
+/*
+ * load_file - find loaded conversion table or load it from external file.
+ *
+ * PARAMETERS:
+ *    struct _reent *rptr - reent structure of current thread/process.
+ *    const char *name - encoding name.
+ *    int direction - conversion direction.
+ *
+ * DESCRIPTION:
+ *    Returns the shared description of "To UCS" (if 'direction' is 0) or
+ *    "From UCS" table of 'name' encoding, loading the table if it isn't
+ *    loaded yet. Every successful call should be paired with unload_file.
+ *
+ * RETURN:
+ *    iconv_ccs_desc_t * pointer is success, NULL if failure.
+ */
+static const iconv_ccs_desc_t *
+load_file (struct _reent *rptr,
+                  const char *name,
+                  int direction)
+{
+  ext_table_t *etp;
+
+#ifndef __SINGLE_THREAD__
+  __lock_acquire (__iconv_ext_tables_mutex);
+#endif
+  for (etp = ext_tables; etp != NULL; etp = etp->next)
+    if (etp->direction == direction && strcmp (etp->name, name) == 0)
+      {
+        etp->refcount += 1;
+        break;
+      }
+
+  if (etp == NULL && (etp = read_file (rptr, name, direction)) != NULL)
+    {
+      etp->next = ext_tables;
+      ext_tables = etp;
+    }
+#ifndef __SINGLE_THREAD__
+  __lock_release (__iconv_ext_tables_mutex);
+#endif
+
+  return etp != NULL ? &etp->desc : NULL;
+}
+
+/*
+ * unload_file - release conversion table returned by load_file.
+ *
+ * PARAMETERS:
+ *    struct _reent *rptr - reent structure of current thread/process.
+ *    const iconv_ccs_desc_t *ccsp - table description.
+ *
+ * DESCRIPTION:
+ *    Decrements table reference count and frees the table when it
+ *    drops to zero.
+ */
+static void
+unload_file (struct _reent *rptr,
+                    const iconv_ccs_desc_t *ccsp)
+{
+  ext_table_t *etp, **prev;
+
+#ifndef __SINGLE_THREAD__
+  __lock_acquire (__iconv_ext_tables_mutex);
+#endif
+  for (prev = &ext_tables; (etp = *prev) != NULL; prev = &etp->next)
+    if (&etp->desc == ccsp)
+      {
+        if ((etp->refcount -= 1) == 0)
+          *prev = etp->next;
+        else
+          etp = NULL;
+        break;
+      }
+#ifndef __SINGLE_THREAD__
+  __lock_release (__iconv_ext_tables_mutex);
+#endif
+
+  if (etp != NULL)
+    free_table (rptr, etp);
 }
 #endif
 
@@ -32,6 +32,7 @@
 #include "local.h"
 #include "conv.h"
 #include "ucsconv.h"
+#include "encnames.h"
 
 static int fake_data;
 
@@ -39,6 +40,11 @@ static int
 find_encoding_name (const char *searchee,
                             const char **names);
 
+static void
+select_bulk_converter (iconv_ucs_conversion_t *uc,
+                              const char *to,
+                              const char *from);
+
 
 /*
  * UCS-based conversion interface functions implementation.
@@ -109,6 +115,8 @@ ucs_based_conversion_open (struct _reent *rptr,
   else
     uc->from_ucs.data = (void *)&fake_data;
 
+  select_bulk_converter (uc, to, from);
+
   return uc;
 
 error:
@@ -155,6 +163,10 @@ ucs_based_conversion_convert (struct _reent *rptr,
   size_t res = 0;
   iconv_ucs_conversion_t *uc = (iconv_ucs_conversion_t *)data;
 
+  if (uc->bulk != NULL && !(flags & ICONV_DONT_SAVE_BIT))
+    return uc->bulk (rptr, data, inbuf, inbytesleft,
+                     outbuf, outbytesleft, flags);
+
   while (*inbytesleft > 0)
     {
       register size_t bytes;
@@ -346,3 +358,559 @@ find_encoding_name (const char *searchee,
   return -1;
 }
 
+
+
+/*
+ * Direct converters.
+ *
+ * Conversions between UTF-8, UTF-16BE/LE, UCS-4/UCS-4BE/LE, ISO-8859-1 and
+ * US-ASCII don't go through the CES converters handlers for every character.
+ * The decoder and the encoder of a pair are inlined into one loop, and runs
+ * of ASCII bytes are copied a word at a time. Characters are checked exactly
+ * as the correspondent CES converters do it.
+ */
+
+#if !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+
+#define BULK_UTF_8  0
+#define BULK_UTF_16 1 /* Parameter: 1 for Little Endian */
+#define BULK_UCS_4  2 /* Parameter: 1 for Little Endian */
+#define BULK_8BIT   3 /* Parameter: maximum code */
+#define BULK_KINDS  4
+
+static const struct
+{
+  const char *name;
+  int kind;
+  ucs4_t param;
+} bulk_encodings[] =
+{
+  {ICONV_ENCODING_UTF_8,      BULK_UTF_8,  0},
+  {ICONV_ENCODING_UTF_16BE,   BULK_UTF_16, 0},
+  {ICONV_ENCODING_UTF_16LE,   BULK_UTF_16, 1},
+  {ICONV_ENCODING_UCS_4,      BULK_UCS_4,  0},
+  {ICONV_ENCODING_UCS_4BE,    BULK_UCS_4,  0},
+  {ICONV_ENCODING_UCS_4LE,    BULK_UCS_4,  1},
+  {ICONV_ENCODING_ISO_8859_1, BULK_8BIT,   0xFF},
+  {ICONV_ENCODING_US_ASCII,   BULK_8BIT,   0x7F},
+  {NULL, 0, 0}
+};
+
+/* Mask of the high bits of every byte of a word */
+#define BULK_HIGHBITS ((unsigned long)-1 / 0xFF * 0x80)
+
+static __always_inline ucs4_t
+bulk_get_16 (const unsigned char *p,
+                    ucs4_t le)
+{
+  return le ? (ucs4_t)p[0] | ((ucs4_t)p[1] << 8)
+            : ((ucs4_t)p[0] << 8) | (ucs4_t)p[1];
+}
+
+static __always_inline void
+bulk_put_16 (unsigned char *p,
+                    ucs4_t c,
+                    ucs4_t le)
+{
+  if (le)
+    {
+      p[0] = (unsigned char)c;
+      p[1] = (unsigned char)(c >> 8);
+    }
+  else
+    {
+      p[0] = (unsigned char)(c >> 8);
+      p[1] = (unsigned char)c;
+    }
+}
+
+static __always_inline ucs4_t
+bulk_get_32 (const unsigned char *p,
+                    ucs4_t le)
+{
+  if (le)
+    return (ucs4_t)p[0] | ((ucs4_t)p[1] << 8)
+           | ((ucs4_t)p[2] << 16) | ((ucs4_t)p[3] << 24);
+  return ((ucs4_t)p[0] << 24) | ((ucs4_t)p[1] << 16)
+         | ((ucs4_t)p[2] << 8) | (ucs4_t)p[3];
+}
+
+static __always_inline void
+bulk_put_32 (unsigned char *p,
+                    ucs4_t c,
+                    ucs4_t le)
+{
+  if (le)
+    {
+      p[0] = (unsigned char)c;
+      p[1] = (unsigned char)(c >> 8);
+      p[2] = (unsigned char)(c >> 16);
+      p[3] = (unsigned char)(c >> 24);
+    }
+  else
+    {
+      p[0] = (unsigned char)(c >> 24);
+      p[1] = (unsigned char)(c >> 16);
+      p[2] = (unsigned char)(c >> 8);
+      p[3] = (unsigned char)c;
+    }
+}
+
+static __always_inline size_t
+bulk_unit (int kind)
+{
+  return kind == BULK_UTF_16 ? 2 : kind == BULK_UCS_4 ? 4 : 1;
+}
+
+/*
+ * Converts the run of ASCII bytes at the beginning of 'in' into 'kind'
+ * encoding. Returns the number of bytes converted, which is 0 if 'out'
+ * can't hold the first character.
+ */
+static __always_inline size_t
+bulk_ascii_run (const unsigned char *in,
+                       size_t inbytesleft,
+                       unsigned char *out,
+                       size_t outbytesleft,
+                       int kind,
+                       ucs4_t param)
+{
+  unsigned long w[2];
+  size_t n, i, j;
+
+  n = outbytesleft / bulk_unit (kind);
+  if (n > inbytesleft)
+    n = inbytesleft;
+
+  for (i = 0; i + sizeof (w) <= n; i += sizeof (w))
+    {
+      memcpy (w, in + i, sizeof (w));
+      if ((w[0] | w[1]) & BULK_HIGHBITS)
+        break;
+      if (kind == BULK_UTF_8 || kind == BULK_8BIT)
+        memcpy (out + i, w, sizeof (w));
+      else
+        for (j = 0; j < sizeof (w); j++)
+          if (kind == BULK_UTF_16)
+            bulk_put_16 (out + 2 * (i + j), in[i + j], param);
+          else
+            bulk_put_32 (out + 4 * (i + j), in[i + j], param);
+    }
+
+  for (; i < n && in[i] < 0x80; i++)
+    if (kind == BULK_UTF_8 || kind == BULK_8BIT)
+      out[i] = in[i];
+    else if (kind == BULK_UTF_16)
+      bulk_put_16 (out + 2 * i, in[i], param);
+    else
+      bulk_put_32 (out + 4 * i, in[i], param);
+
+  return i;
+}
+
+/*
+ * Converts the run of ASCII characters at the beginning of UTF-16 'in' into
+ * UTF-8 or 8-bit encoding. Returns the number of characters converted.
+ */
+static __always_inline size_t
+bulk_ascii_run_16 (const unsigned char *in,
+                          size_t inbytesleft,
+                          unsigned char *out,
+                          size_t outbytesleft,
+                          ucs4_t param)
+{
+  ucs4_t any;
+  size_t n, i, j;
+
+  n = inbytesleft / 2;
+  if (n > outbytesleft)
+    n = outbytesleft;
+
+  for (i = 0; i + 8 <= n; i += 8)
+    {
+      for (any = 0, j = 0; j < 8; j++)
+        any |= bulk_get_16 (in + 2 * (i + j), param);
+      if (any >= 0x80)
+        break;
+      for (j = 0; j < 8; j++)
+        out[i + j] = in[2 * (i + j) + !param];
+    }
+
+  for (; i < n && bulk_get_16 (in + 2 * i, param) < 0x80; i++)
+    out[i] = in[2 * i + !param];
+
+  return i;
+}
+
+/*
+ * Decodes one character of 'kind' encoding, see the convert_to_ucs
+ * functions of correspondent CES converters. '*len' is set to the
+ * character length.
+ */
+static __always_inline ucs4_t
+bulk_decode (const unsigned char *in,
+                    size_t inbytesleft,
+                    size_t *len,
+                    int kind,
+                    ucs4_t param)
+{
+  ucs4_t res, w2;
+  size_t bytes, i;
+
+  switch (kind)
+    {
+      case BULK_UTF_8:
+        res = in[0];
+        if (res < 0x80)
+          {
+            *len = 1;
+            return res;
+          }
+        else if (res < 0xC0)
+          return (ucs4_t)ICONV_CES_INVALID_CHARACTER;
+        else if (res < 0xE0)
+          res &= 0x1F, bytes = 2;
+        else if (res < 0xF0)
+          res &= 0x0F, bytes = 3;
+        else if (res < 0xF8)
+          res &= 0x07, bytes = 4;
+        else if (res < 0xFC)
+          res &= 0x03, bytes = 5;
+        else if (res <= 0xFD)
+          res &= 0x01, bytes = 6;
+        else
+          return (ucs4_t)ICONV_CES_INVALID_CHARACTER;
+
+        if (inbytesleft < bytes)
+          return (ucs4_t)ICONV_CES_BAD_SEQUENCE;
+
+        for (i = 1; i < bytes; i++)
+          {
+            if ((in[i] & 0xC0) != 0x80)
+              return (ucs4_t)ICONV_CES_INVALID_CHARACTER;
+            res = (res << 6) | (in[i] & 0x3F);
+          }
+
+        /* Overlong sequence */
+        if (res < (bytes == 2 ? 0x80 : (ucs4_t)1 << (5 * bytes - 4)))
+          return (ucs4_t)ICONV_CES_INVALID_CHARACTER;
+        break;
+
+      case BULK_UTF_16:
+        if (inbytesleft < 2)
+          return (ucs4_t)ICONV_CES_BAD_SEQUENCE;
+
+        res = bulk_get_16 (in, param);
+        if (res < 0xD800 || res > 0xDFFF)
+          {
+            bytes = 2;
+            break;
+          }
+
+        /* Process surrogate pair */
+        if (inbytesleft < 4)
+          return (ucs4_t)ICONV_CES_BAD_SEQUENCE;
+        if (res > 0xDBFF)
+          return (ucs4_t)ICONV_CES_INVALID_CHARACTER;
+        w2 = bulk_get_16 (in + 2, param);
+        if (w2 < 0xDC00 || w2 > 0xDFFF)
+          return (ucs4_t)ICONV_CES_INVALID_CHARACTER;
+
+        *len = 4;
+        return ((w2 & 0x03FF) | ((res & 0x03FF) << 10)) + 0x00010000;
+
+      case BULK_UCS_4:
+        if (inbytesleft < 4)
+          return (ucs4_t)ICONV_CES_BAD_SEQUENCE;
+
+        res = bulk_get_32 (in, param);
+        bytes = 4;
+        break;
+
+      default: /* BULK_8BIT */
+        res = in[0];
+        if (res > param)
+          return (ucs4_t)ICONV_CES_INVALID_CHARACTER;
+        *len = 1;
+        return res;
+    }
+
+  if ((res >= 0x0000D800 && res <= 0x0000DFFF)
+      || res > 0x7FFFFFFF || res == 0x0000FFFF || res == 0x0000FFFE)
+    return (ucs4_t)ICONV_CES_INVALID_CHARACTER;
+
+  *len = bytes;
+  return res;
+}
+
+/*
+ * Encodes 'in' to 'kind' encoding, see the convert_from_ucs functions of
+ * correspondent CES converters. 'outbytesleft' is at least 1.
+ */
+static __always_inline size_t
+bulk_encode (ucs4_t in,
+                    unsigned char *out,
+                    size_t outbytesleft,
+                    int kind,
+                    ucs4_t param)
+{
+  size_t bytes, i;
+
+  if (kind == BULK_8BIT)
+    {
+      if (in > param)
+        return (size_t)ICONV_CES_INVALID_CHARACTER;
+      *out = (unsigned char)in;
+      return 1;
+    }
+
+  if ((in >= 0x0000D800 && in <= 0x0000DFFF)
+      || in > (kind == BULK_UTF_16 ? 0x0010FFFF : 0x7FFFFFFF)
+      || in == 0x0000FFFF || in == 0x0000FFFE)
+    return (size_t)ICONV_CES_INVALID_CHARACTER;
+
+  switch (kind)
+    {
+      case BULK_UTF_8:
+        if (in < 0x80)
+          {
+            *out = (unsigned char)in;
+            return 1;
+          }
+        else if (in < 0x800)
+          bytes = 2;
+        else if (in < 0x10000)
+          bytes = 3;
+        else if (in < 0x200000)
+          bytes = 4;
+        else if (in < 0x4000000)
+          bytes = 5;
+        else
+          bytes = 6;
+
+        if (outbytesleft < bytes)
+          return (size_t)ICONV_CES_NOSPACE;
+
+        for (i = bytes - 1; i > 0; i--, in >>= 6)
+          out[i] = (unsigned char)((in & 0x3F) | 0x80);
+        out[0] = (unsigned char)(in | (0xFF00 >> bytes));
+        return bytes;
+
+      case BULK_UTF_16:
+        if (in < 0x00010000)
+          {
+            if (outbytesleft < 2)
+              return (size_t)ICONV_CES_NOSPACE;
+            bulk_put_16 (out, in, param);
+            return 2;
+          }
+
+        if (outbytesleft < 4)
+          return (size_t)ICONV_CES_NOSPACE;
+        in -= 0x00010000;
+        bulk_put_16 (out, ((in >> 10) & 0x03FF) | 0xD800, param);
+        bulk_put_16 (out + 2, (in & 0x03FF) | 0xDC00, param);
+        return 4;
+
+      default: /* BULK_UCS_4 */
+        if (outbytesleft < 4)
+          return (size_t)ICONV_CES_NOSPACE;
+        bulk_put_32 (out, in, param);
+        return 4;
+    }
+}
+
+/*
+ * Converts from 'from' to 'to' encoding kind. Behaves exactly like
+ * ucs_based_conversion_convert() without ICONV_DONT_SAVE_BIT.
+ */
+static __always_inline size_t
+bulk_convert (struct _reent *rptr,
+                     void *data,
+                     const unsigned char **inbuf,
+                     size_t *inbytesleft,
+                     unsigned char **outbuf,
+                     size_t *outbytesleft,
+                     int flags,
+                     int from,
+                     int to)
+{
+  iconv_ucs_conversion_t *uc = (iconv_ucs_conversion_t *)data;
+  const unsigned char *in = *inbuf;
+  const unsigned char *inend = in + *inbytesleft;
+  unsigned char *out = *outbuf;
+  unsigned char *outend = out + *outbytesleft;
+  ucs4_t from_param = uc->bulk_to_ucs;
+  ucs4_t to_param = uc->bulk_from_ucs;
+  size_t res = 0;
+  int err = 0;
+
+  while (in < inend)
+    {
+      size_t len, bytes;
+      ucs4_t ch;
+
+      if (out == outend)
+        {
+          err = E2BIG;
+          break;
+        }
+
+      if ((from == BULK_UTF_8 || from == BULK_8BIT) && *in < 0x80)
+        {
+          len = bulk_ascii_run (in, inend - in, out, outend - out,
+                                to, to_param);
+          if (len > 0)
+            {
+              in += len;
+              out += len * bulk_unit (to);
+              continue;
+            }
+        }
+      else if (from == BULK_UTF_16 && (to == BULK_UTF_8 || to == BULK_8BIT)
+               && inend - in >= 2 && bulk_get_16 (in, from_param) < 0x80)
+        {
+          len = bulk_ascii_run_16 (in, inend - in, out, outend - out,
+                                   from_param);
+          in += 2 * len;
+          out += len;
+          continue;
+        }
+
+      ch = bulk_decode (in, inend - in, &len, from, from_param);
+
+      if (ch == (ucs4_t)ICONV_CES_BAD_SEQUENCE)
+        {
+          err = EINVAL;
+          break;
+        }
+
+      if (ch == (ucs4_t)ICONV_CES_INVALID_CHARACTER)
+        {
+          err = EILSEQ;
+          break;
+        }
+
+      bytes = bulk_encode (ch, out, outend - out, to, to_param);
+
+      if (bytes == (size_t)ICONV_CES_NOSPACE)
+        {
+          err = E2BIG;
+          break;
+        }
+
+      in += len;
+
+      if (bytes == (size_t)ICONV_CES_INVALID_CHARACTER)
+        {
+          if (flags & ICONV_FAIL_BIT)
+            {
+              err = EILSEQ;
+              break;
+            }
+          /* Default character is dropped if there is no room for it */
+          bytes = bulk_encode ((ucs4_t)DEFAULT_CHARACTER, out, outend - out,
+                               to, to_param);
+          res += 1;
+        }
+
+      out += bytes;
+    }
+
+  *inbytesleft -= in - *inbuf;
+  *inbuf = in;
+  *outbytesleft -= out - *outbuf;
+  *outbuf = out;
+
+  if (err != 0)
+    {
+      __errno_r (rptr) = err;
+      return (size_t)-1;
+    }
+
+  return res;
+}
+
+#define BULK_CONVERTER(name, from, to)                                       \
+static size_t                                                                \
+name (struct _reent *rptr,                                                   \
+             void *data,                                                     \
+             const unsigned char **inbuf,                                    \
+             size_t *inbytesleft,                                            \
+             unsigned char **outbuf,                                         \
+             size_t *outbytesleft,                                           \
+             int flags)                                                      \
+{                                                                            \
+  return bulk_convert (rptr, data, inbuf, inbytesleft, outbuf, outbytesleft, \
+                       flags, from, to);                                     \
+}
+
+BULK_CONVERTER (bulk_utf_8_to_utf_8,   BULK_UTF_8,  BULK_UTF_8)
+BULK_CONVERTER (bulk_utf_8_to_utf_16,  BULK_UTF_8,  BULK_UTF_16)
+BULK_CONVERTER (bulk_utf_8_to_ucs_4,   BULK_UTF_8,  BULK_UCS_4)
+BULK_CONVERTER (bulk_utf_8_to_8bit,    BULK_UTF_8,  BULK_8BIT)
+BULK_CONVERTER (bulk_utf_16_to_utf_8,  BULK_UTF_16, BULK_UTF_8)
+BULK_CONVERTER (bulk_utf_16_to_utf_16, BULK_UTF_16, BULK_UTF_16)
+BULK_CONVERTER (bulk_utf_16_to_ucs_4,  BULK_UTF_16, BULK_UCS_4)
+BULK_CONVERTER (bulk_utf_16_to_8bit,   BULK_UTF_16, BULK_8BIT)
+BULK_CONVERTER (bulk_ucs_4_to_utf_8,   BULK_UCS_4,  BULK_UTF_8)
+BULK_CONVERTER (bulk_ucs_4_to_utf_16,  BULK_UCS_4,  BULK_UTF_16)
+BULK_CONVERTER (bulk_ucs_4_to_ucs_4,   BULK_UCS_4,  BULK_UCS_4)
+BULK_CONVERTER (bulk_ucs_4_to_8bit,    BULK_UCS_4,  BULK_8BIT)
+BULK_CONVERTER (bulk_8bit_to_utf_8,    BULK_8BIT,   BULK_UTF_8)
+BULK_CONVERTER (bulk_8bit_to_utf_16,   BULK_8BIT,   BULK_UTF_16)
+BULK_CONVERTER (bulk_8bit_to_ucs_4,    BULK_8BIT,   BULK_UCS_4)
+BULK_CONVERTER (bulk_8bit_to_8bit,     BULK_8BIT,   BULK_8BIT)
+
+static size_t (* const bulk_converters[BULK_KINDS][BULK_KINDS]) (
+                                                  struct _reent *,
+                                                  void *,
+                                                  const unsigned char **,
+                                                  size_t *,
+                                                  unsigned char **,
+                                                  size_t *,
+                                                  int) =
+{
+  {bulk_utf_8_to_utf_8, bulk_utf_8_to_utf_16,
+   bulk_utf_8_to_ucs_4, bulk_utf_8_to_8bit},
+  {bulk_utf_16_to_utf_8, bulk_utf_16_to_utf_16,
+   bulk_utf_16_to_ucs_4, bulk_utf_16_to_8bit},
+  {bulk_ucs_4_to_utf_8, bulk_ucs_4_to_utf_16,
+   bulk_ucs_4_to_ucs_4, bulk_ucs_4_to_8bit},
+  {bulk_8bit_to_utf_8, bulk_8bit_to_utf_16,
+   bulk_8bit_to_ucs_4, bulk_8bit_to_8bit}
+};
+
+static void
+select_bulk_converter (iconv_ucs_conversion_t *uc,
+                              const char *to,
+                              const char *from)
+{
+  int i, j;
+
+  for (i = 0; bulk_encodings[i].name != NULL; i++)
+    if (strcmp (bulk_encodings[i].name, from) == 0)
+      break;
+  for (j = 0; bulk_encodings[j].name != NULL; j++)
+    if (strcmp (bulk_encodings[j].name, to) == 0)
+      break;
+
+  if (bulk_encodings[i].name == NULL || bulk_encodings[j].name == NULL)
+    return;
+
+  uc->bulk = bulk_converters[bulk_encodings[i].kind][bulk_encodings[j].kind];
+  uc->bulk_to_ucs = bulk_encodings[i].param;
+  uc->bulk_from_ucs = bulk_encodings[j].param;
+}
+
+#else /* PREFER_SIZE_OVER_SPEED || __OPTIMIZE_SIZE__ */
+
+static void
+select_bulk_converter (iconv_ucs_conversion_t *uc,
+                              const char *to,
+                              const char *from)
+{
+  return;
+}
+
+#endif /* !PREFER_SIZE_OVER_SPEED && !__OPTIMIZE_SIZE__ */
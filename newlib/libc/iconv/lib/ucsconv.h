@@ -276,6 +276,23 @@ typedef struct
 
   /* UCS -> destination encoding CES converter. */
   iconv_from_ucs_ces_desc_t from_ucs;
+
+  /*
+   * Direct converter for the encodings pair which doesn't call CES
+   * converters for every character, NULL if there is no such converter.
+   * Has the same interface as iconv_conversion_handlers_t 'convert'.
+   */
+  size_t (*bulk) (struct _reent *rptr,
+                       void *data,
+                       const unsigned char **inbuf,
+                       size_t *inbytesleft,
+                       unsigned char **outbuf,
+                       size_t *outbytesleft,
+                       int flags);
+
+  /* Byte order or maximum code of source and destination encodings. */
+  ucs4_t bulk_to_ucs;
+  ucs4_t bulk_from_ucs;
 } iconv_ucs_conversion_t;
 
 
@@ -14,6 +14,11 @@
 
 #include <sys/cdefs.h>
 
+#if __MISC_VISIBLE
+#define __need_size_t
+#include <stddef.h>
+#endif
+
 __BEGIN_DECLS
 
 /* 7.3.5 Trigonometric functions */
@@ -128,6 +133,15 @@ double complex clog10(double complex);
 float complex clog10f(float complex);
 #endif
 
+#if __MISC_VISIBLE
+void cexp_array(double complex *, const double complex *, size_t);
+void cexpf_array(float complex *, const float complex *, size_t);
+void cabs_array(double *, const double complex *, size_t);
+void cabsf_array(float *, const float complex *, size_t);
+void carg_array(double *, const double complex *, size_t);
+void cargf_array(float *, const float complex *, size_t);
+#endif
+
 #if defined(__CYGWIN__)
 long double complex cacosl(long double complex);
 long double complex ccosl(long double complex);
@@ -48,8 +48,17 @@
 #define	FNM_FILE_NAME	FNM_PATHNAME
 #endif
 
+#if __MISC_VISIBLE
+typedef struct __fnmatch_pat *fnmatch_pat_t;
+#endif
+
 __BEGIN_DECLS
 int	 fnmatch(const char *, const char *, int);
+#if __MISC_VISIBLE
+fnmatch_pat_t fnmatch_compile(const char *, int);
+int	 fnmatch_exec(fnmatch_pat_t, const char *);
+void	 fnmatch_free(fnmatch_pat_t);
+#endif
 __END_DECLS
 
 #endif /* !_FNMATCH_H_ */
@@ -85,6 +85,8 @@ __BEGIN_DECLS
 int	glob(const char *__restrict, int, int (*)(const char *, int), 
 		glob_t *__restrict);
 void	globfree(glob_t *);
+int	glob_stream(const char *__restrict, int, int (*)(const char *, int),
+		int (*)(const char *, void *), void *, glob_t *__restrict);
 __END_DECLS
 
 #endif /* !_GLOB_H_ */
@@ -620,6 +620,29 @@ extern __IMPORT _LIB_VERSION_TYPE _LIB_VERSION;
 
 #endif /* __BSD_VISIBLE */
 
+/* libm has vector variants of these functions, which the compiler may
+   call from vectorized loops.  Like other fast math optimizations this
+   is only done with -ffast-math, since they are not always rounded the
+   same way as the scalar functions.  _HAVE_VECTOR_MATH records whether
+   libm was built with them, whatever __OBSOLETE_MATH is here.  They are
+   not exported by Cygwin.  */
+#if defined (__FAST_MATH__) && defined (_HAVE_VECTOR_MATH) \
+    && !defined (__CYGWIN__) && __GNUC_PREREQ (9, 0) \
+    && (defined (__x86_64__) \
+	|| (defined (__aarch64__) && !defined (__ARM_FEATURE_SVE)))
+#define __MATH_VECTOR __attribute__ ((__simd__ ("notinbranch")))
+__MATH_VECTOR extern double exp (double);
+__MATH_VECTOR extern double log (double);
+__MATH_VECTOR extern double pow (double, double);
+__MATH_VECTOR extern double sin (double);
+__MATH_VECTOR extern double cos (double);
+__MATH_VECTOR extern float expf (float);
+__MATH_VECTOR extern float logf (float);
+__MATH_VECTOR extern float powf (float, float);
+__MATH_VECTOR extern float sinf (float);
+__MATH_VECTOR extern float cosf (float);
+#endif
+
 _END_STD_C
 
 #ifdef __FAST_MATH__
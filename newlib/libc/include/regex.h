@@ -91,6 +91,7 @@ typedef struct {
 #define	REG_TRACE	00400	/* tracing of execution */
 #define	REG_LARGE	01000	/* force large representation */
 #define	REG_BACKR	02000	/* force use of backref code */
+#define	REG_NODFA	04000	/* don't use the lazy DFA */
 
 __BEGIN_DECLS
 int	regcomp(regex_t *__restrict, const char *__restrict, int);
@@ -317,7 +317,9 @@ extern bool_t xdr_bool (XDR *, bool_t *);
 extern bool_t xdr_enum (XDR *, enum_t *);
 extern bool_t xdr_array (XDR *, char **, u_int *, u_int, u_int, xdrproc_t);
 extern bool_t xdr_bytes (XDR *, char **, u_int *, u_int);
+extern bool_t xdr_bytes_inline (XDR *, char **, u_int *, u_int);
 extern bool_t xdr_opaque (XDR *, char *, u_int);
+extern bool_t xdr_opaque_inline (XDR *, char **, u_int);
 extern bool_t xdr_string (XDR *, char **, u_int);
 extern bool_t xdr_union (XDR *, enum_t *, char *,
                                   const struct xdr_discrim *, xdrproc_t);
@@ -379,6 +381,13 @@ extern bool_t xdrrec_skiprecord (XDR *);
 extern bool_t xdrrec_eof (XDR *);
 extern u_int xdrrec_readbytes (XDR *, caddr_t, u_int);
 
+/* non-blocking record streams */
+extern bool_t xdrrec_setnonblock (XDR *, int);
+extern int xdrrec_getrec (XDR *);
+
+/* write out ended records */
+extern int xdrrec_flush (XDR *);
+
 /* free memory buffers for xdr */
 extern void xdr_free (xdrproc_t, void *);
 
@@ -128,6 +128,10 @@ char    *strnstr(const char *, const char *, size_t) __pure;
 #if __MISC_VISIBLE
 char	*strlwr (char *);
 char	*strupr (char *);
+int	 strcollsort (const char **, size_t);
+#if __POSIX_VISIBLE >= 200809
+int	 strcollsort_l (const char **, size_t, locale_t);
+#endif
 #endif
 
 #ifndef DEFS_H	/* Kludge to work around problem compiling in gdb */
@@ -28,7 +28,7 @@
 #include <sys/types.h>
 #include <sys/timespec.h>
 
-#if __POSIX_VISIBLE >= 200809
+#if __POSIX_VISIBLE >= 200809 || __MISC_VISIBLE
 #include <sys/_locale.h>
 #endif
 
@@ -73,6 +73,17 @@ extern size_t strftime_l (char *__restrict _s, size_t _maxsize,
 			  const struct tm *__restrict _t, locale_t _l);
 #endif
 
+#if __MISC_VISIBLE
+typedef struct __strftime_plan *strftime_plan_t;
+
+strftime_plan_t strftime_compile (const char *__restrict _fmt);
+strftime_plan_t strftime_compile_l (const char *__restrict _fmt, locale_t _l);
+size_t	   strftime_exec (char *__restrict _s, size_t _maxsize,
+			  strftime_plan_t _plan,
+			  const struct tm *__restrict _t);
+void	   strftime_free (strftime_plan_t _plan);
+#endif
+
 char	  *asctime_r 	(const struct tm *__restrict,
 				 char *__restrict);
 char	  *ctime_r 	(const time_t *, char *);
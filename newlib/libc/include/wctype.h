@@ -5,6 +5,10 @@
 #include <sys/_types.h>
 
 #define __need_wint_t
+#if __MISC_VISIBLE
+#define __need_size_t
+#define __need_wchar_t
+#endif
 #include <stddef.h>
 
 #if __POSIX_VISIBLE >= 200809
@@ -69,6 +73,14 @@ extern wctrans_t wctrans_l (const char *, locale_t);
 extern wctype_t wctype_l (const char *, locale_t);
 #endif
 
+#if __MISC_VISIBLE
+wchar_t	*wmemtolower (wchar_t *, const wchar_t *, size_t);
+wchar_t	*wmemtoupper (wchar_t *, const wchar_t *, size_t);
+size_t	wmemctype (const wchar_t *, size_t, wctype_t);
+size_t	utf8tolower (char *, size_t, const char *, size_t);
+size_t	utf8toupper (char *, size_t, const char *, size_t);
+#endif
+
 _END_STD_C
 
 #endif /* _WCTYPE_H_ */
@@ -54,21 +54,14 @@ _duplocale_r (struct _reent *p, struct __locale_t *locobj)
   /* The "C" locale is used statically, never copied. */
   else if (locobj == __get_C_locale ())
     return __get_C_locale ();
-  /* Copy locale content. */
-  tmp_locale = *locobj;
-#ifdef __HAVE_LOCALE_INFO__
+  /* The category data is interned, so just acquire another reference
+     to it.  The data of the global locale is looked up by name. */
+  tmp_locale = *__get_C_locale ();
   for (i = 1; i < _LC_LAST; ++i)
-    if (locobj->lc_cat[i].buf)
-      {
-	/* If the object is not a "C" locale category, copy it.  Just call
-	   __loadlocale.  It knows what to do to replicate the category. */
-	tmp_locale.lc_cat[i].ptr = NULL;
-	tmp_locale.lc_cat[i].buf = NULL;
-	tmp_locale.categories[i][0] = '\0';	/* __loadlocale tests this! */
-	if (!__loadlocale (&tmp_locale, i, locobj->categories[i]))
-	  goto error;
-      }
-#endif /* __HAVE_LOCALE_INFO__ */
+    if (strcmp (locobj->categories[i], "C")
+	&& __locale_category_acquire (p, &tmp_locale, i,
+				      locobj->categories[i]) < 0)
+      goto error;
   /* Allocate new locale_t. */
   new_locale = (struct __locale_t *) _calloc_r (p, 1, sizeof *new_locale);
   if (!new_locale)
@@ -78,16 +71,12 @@ _duplocale_r (struct _reent *p, struct __locale_t *locobj)
   return new_locale;
 
 error:
-  /* An error occured while we had already (potentially) allocated memory.
-     Free memory and return NULL.  errno is supposed to be set already. */
-#ifdef __HAVE_LOCALE_INFO__
+  /* An error occured while we had already (potentially) acquired category
+     data.  Release it and return NULL.  errno is supposed to be set
+     already. */
   while (--i > 0)
-    if (tmp_locale.lc_cat[i].buf)
-      {
-	_free_r (p, (void *) tmp_locale.lc_cat[i].ptr);
-	_free_r (p, tmp_locale.lc_cat[i].buf);
-      }
-#endif /* __HAVE_LOCALE_INFO__ */
+    if (strcmp (tmp_locale.categories[i], "C"))
+      __locale_category_release (p, i, tmp_locale.categories[i]);
 
   return NULL;
 #endif /* _MB_CAPABLE */
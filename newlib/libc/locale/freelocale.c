@@ -45,14 +45,10 @@ _freelocale_r (struct _reent *p, struct __locale_t *locobj)
   /* Sanity check.  The "C" locale is static, don't try to free it. */
   if (!locobj || locobj == __get_C_locale () || locobj == LC_GLOBAL_LOCALE)
     return;
-#ifdef __HAVE_LOCALE_INFO__
+  /* The category data is interned, just release it. */
   for (int i = 1; i < _LC_LAST; ++i)
-    if (locobj->lc_cat[i].buf)
-      {
-	_free_r (p, (void *) locobj->lc_cat[i].ptr);
-	_free_r (p, locobj->lc_cat[i].buf);
-      }
-#endif /* __HAVE_LOCALE_INFO__ */
+    if (strcmp (locobj->categories[i], "C"))
+      __locale_category_release (p, i, locobj->categories[i]);
   _free_r (p, locobj);
 #endif /* _MB_CAPABLE */
 }
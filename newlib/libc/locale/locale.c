@@ -489,9 +489,9 @@ __loadlocale (struct __locale_t *loc, int category, char *new_locale)
 
   /* Avoid doing everything twice if nothing has changed.
 
-     duplocale relies on this test to go wrong so the locale is actually
-     duplicated when required.  Any change here has to be synced with a
-     matching change in duplocale. */
+     __locale_category_acquire relies on this test to go wrong so the
+     category is actually loaded into its copy of the "C" locale.  Any
+     change here has to be synced with a matching change there. */
   if (!strcmp (new_locale, loc->categories[category]))
     return loc->categories[category];
 
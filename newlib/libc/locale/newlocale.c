@@ -77,11 +77,156 @@ PORTABILITY
 #include <errno.h>
 #include <reent.h>
 #include <stdlib.h>
+#include <sys/lock.h>
 #include "setlocale.h"
 
 #define LC_VALID_MASK	(LC_COLLATE_MASK | LC_CTYPE_MASK | LC_MONETARY_MASK \
 			 | LC_NUMERIC_MASK | LC_TIME_MASK | LC_MESSAGES_MASK)
 
+#ifdef _MB_CAPABLE
+/* The category data of locale objects created by newlocale and duplocale
+   is interned.  The data of a category for a locale name is loaded once
+   and shared by all locale objects using it, so creating a locale object
+   for a name seen before is just a lookup, and duplocale and freelocale
+   never copy or free the data itself.  Entries count the locale objects
+   using them.  Up to LC_INTERN_UNUSED unused entries are kept for later
+   newlocale calls, beyond that the least recently used one is freed.
+   The global locale loads its own data, see setlocale. */
+#define LC_INTERN_UNUSED 24
+
+struct lc_intern
+{
+  struct lc_intern	*next;
+  int			 refcount;
+  int			 category;
+  /* "C" locale with just this category loaded.  The locale name is
+     loc.categories[category]. */
+  struct __locale_t	 loc;
+};
+
+static struct lc_intern *lc_interned = NULL;
+#ifndef __SINGLE_THREAD__
+__LOCK_INIT(static, __locale_intern_mutex);
+#endif
+
+static void
+copy_category (struct __locale_t *dst, const struct __locale_t *src, int i)
+{
+  strcpy (dst->categories[i], src->categories[i]);
+  if (i == LC_CTYPE)
+    {
+      dst->wctomb = src->wctomb;
+      dst->mbtowc = src->mbtowc;
+      dst->cjk_lang = src->cjk_lang;
+      dst->ctype_ptr = src->ctype_ptr;
+#ifndef __HAVE_LOCALE_INFO__
+      memcpy (dst->mb_cur_max, src->mb_cur_max, sizeof dst->mb_cur_max);
+      strcpy (dst->ctype_codeset, src->ctype_codeset);
+#endif
+    }
+#ifdef __HAVE_LOCALE_INFO__
+  dst->lc_cat[i] = src->lc_cat[i];
+#else
+  if (i == LC_MESSAGES)
+    strcpy (dst->message_codeset, src->message_codeset);
+#endif
+}
+
+static void
+free_intern (struct _reent *p, struct lc_intern *e)
+{
+#ifdef __HAVE_LOCALE_INFO__
+  /* If buf is not NULL, both pointers have been alloc'ed */
+  if (e->loc.lc_cat[e->category].buf)
+    {
+      _free_r (p, (void *) e->loc.lc_cat[e->category].ptr);
+      _free_r (p, e->loc.lc_cat[e->category].buf);
+    }
+#endif /* __HAVE_LOCALE_INFO__ */
+  _free_r (p, e);
+}
+
+/* Set category of loc to the interned data of locale name, loading it if
+   it's not interned yet.  Returns 0 on success, -1 on failure.  Every
+   successful call has to be paired with __locale_category_release. */
+int
+__locale_category_acquire (struct _reent *p, struct __locale_t *loc,
+			   int category, const char *name)
+{
+  struct lc_intern *e, **prev;
+  char new_locale[ENCODING_LEN + 1];
+
+#ifndef __SINGLE_THREAD__
+  __lock_acquire (__locale_intern_mutex);
+#endif
+  for (prev = &lc_interned; (e = *prev) != NULL; prev = &e->next)
+    if (e->category == category && !strcmp (e->loc.categories[category], name))
+      {
+	/* Move to the front, unused entries are freed from the end. */
+	*prev = e->next;
+	break;
+      }
+  if (!e
+      && (e = (struct lc_intern *) _malloc_r (p, sizeof *e)) != NULL)
+    {
+      e->refcount = 0;
+      e->category = category;
+      e->loc = *__get_C_locale ();
+      /* __loadlocale may modify the name. */
+      strcpy (new_locale, name);
+      if (!__loadlocale (&e->loc, category, new_locale))
+	{
+	  free_intern (p, e);
+	  e = NULL;
+	}
+    }
+  if (e)
+    {
+      e->next = lc_interned;
+      lc_interned = e;
+      ++e->refcount;
+      copy_category (loc, &e->loc, category);
+    }
+#ifndef __SINGLE_THREAD__
+  __lock_release (__locale_intern_mutex);
+#endif
+  return e ? 0 : -1;
+}
+
+/* Release the interned data of category for locale name. */
+void
+__locale_category_release (struct _reent *p, int category, const char *name)
+{
+  struct lc_intern *e, **prev, **last_unused = NULL;
+  int unused = 0;
+
+#ifndef __SINGLE_THREAD__
+  __lock_acquire (__locale_intern_mutex);
+#endif
+  for (prev = &lc_interned; (e = *prev) != NULL; prev = &e->next)
+    {
+      if (e->category == category && !strcmp (e->loc.categories[category], name))
+	--e->refcount;
+      if (e->refcount == 0)
+	{
+	  ++unused;
+	  last_unused = prev;
+	}
+    }
+  e = NULL;
+  if (unused > LC_INTERN_UNUSED)
+    {
+      e = *last_unused;
+      *last_unused = e->next;
+    }
+#ifndef __SINGLE_THREAD__
+  __lock_release (__locale_intern_mutex);
+#endif
+  if (e)
+    free_intern (p, e);
+}
+#endif /* _MB_CAPABLE */
+
 struct __locale_t *
 _newlocale_r (struct _reent *p, int category_mask, const char *locale,
 	      struct __locale_t *base)
@@ -133,83 +278,30 @@ _newlocale_r (struct _reent *p, int category_mask, const char *locale,
       else
 	strcpy (new_categories[i], base ? base->categories[i] : "C");
     }
-  /* Now go over all categories and set them. */
+  /* Now go over all categories and set them.  Nothing to do for "C"/"POSIX",
+     otherwise fetch the interned data, which also covers the categories
+     copied over from base. */
   for (i = 1; i < _LC_LAST; ++i)
-    {
-      /* If we have a base locale, and the category is not in category_mask
-	 or the new category is the base categroy, just copy over. */
-      if (base && (((1 << i) & category_mask) == 0
-		   || !strcmp (base->categories[i], new_categories[i])))
-	{
-	  strcpy (tmp_locale.categories[i], new_categories[i]);
-	  if (i == LC_CTYPE)
-	    {
-	      tmp_locale.wctomb = base->wctomb;
-	      tmp_locale.mbtowc = base->mbtowc;
-	      tmp_locale.cjk_lang = base->cjk_lang;
-	      tmp_locale.ctype_ptr = base->ctype_ptr;
-	    }
-#ifdef __HAVE_LOCALE_INFO__
-	  /* Mark the values as "has still to be copied".  We do this in
-	     two steps to simplify freeing new locale types in case of a
-	     subsequent error. */
-	  tmp_locale.lc_cat[i].ptr = base->lc_cat[i].ptr;
-	  tmp_locale.lc_cat[i].buf = (void *) -1;
-#else /* !__HAVE_LOCALE_INFO__ */
-	  if (i == LC_CTYPE)
-	    strcpy (tmp_locale.ctype_codeset, base->ctype_codeset);
-	  else if (i == LC_MESSAGES)
-	    strcpy (tmp_locale.message_codeset, base->message_codeset);
-#endif /* !__HAVE_LOCALE_INFO__ */
-	}
-      /* Otherwise, if the category is in category_mask, create entry. */
-      else if (((1 << i) & category_mask) != 0)
-	{
-	  /* Nothing to do for "C"/"POSIX" locale. */
-	  if (!strcmp (new_categories[i], "C")
-	      || !strcmp (new_categories[i], "POSIX"))
-	    continue;
-	  /* Otherwise load locale data. */
-	  else if (!__loadlocale (&tmp_locale, i, new_categories[i]))
-	    goto error;
-	}
-    }
+    if (strcmp (new_categories[i], "C") && strcmp (new_categories[i], "POSIX")
+	&& __locale_category_acquire (p, &tmp_locale, i, new_categories[i]) < 0)
+      goto error;
   /* Allocate new locale_t. */
   new_locale = (struct __locale_t *) _calloc_r (p, 1, sizeof *new_locale);
   if (!new_locale)
     goto error;
   if (base)
-    {
-#ifdef __HAVE_LOCALE_INFO__
-      /* Step 2 of copying over..  Make sure to invalidate the copied buffer
-	 pointers in base, so the subsequent _freelocale_r (base) doesn't free
-	 the buffers now used in the new locale. */
-      for (i = 1; i < _LC_LAST; ++i)
-	if (tmp_locale.lc_cat[i].buf == (const void *) -1)
-	  {
-	    tmp_locale.lc_cat[i].buf = base->lc_cat[i].buf;
-	    base->lc_cat[i].ptr = base->lc_cat[i].buf = NULL;
-	  }
-#endif /* __HAVE_LOCALE_INFO__ */
-      _freelocale_r (p, base);
-    }
+    _freelocale_r (p, base);
 
   *new_locale = tmp_locale;
   return new_locale;
 
 error:
-  /* An error occured while we had already (potentially) allocated memory.
-     Free memory and return NULL.  errno is supposed to be set already. */
-#ifdef __HAVE_LOCALE_INFO__
-  for (i = 1; i < _LC_LAST; ++i)
-    if (((1 << i) & category_mask) != 0
-	&& tmp_locale.lc_cat[i].buf
-	&& tmp_locale.lc_cat[i].buf != (const void *) -1)
-      {
-	_free_r (p, (void *) tmp_locale.lc_cat[i].ptr);
-	_free_r (p, tmp_locale.lc_cat[i].buf);
-      }
-#endif /* __HAVE_LOCALE_INFO__ */
+  /* An error occured while we had already (potentially) acquired category
+     data.  Release it and return NULL.  errno is supposed to be set
+     already. */
+  while (--i > 0)
+    if (strcmp (tmp_locale.categories[i], "C"))
+      __locale_category_release (p, i, tmp_locale.categories[i]);
 
   return NULL;
 #endif /* _MB_CAPABLE */
@@ -197,6 +197,9 @@ struct __locale_t
 #ifdef _MB_CAPABLE
 extern char *__loadlocale (struct __locale_t *, int, char *);
 extern const char *__get_locale_env(struct _reent *, int);
+extern int __locale_category_acquire (struct _reent *, struct __locale_t *,
+				      int, const char *);
+extern void __locale_category_release (struct _reent *, int, const char *);
 #endif /* _MB_CAPABLE */
 
 extern struct lconv *__localeconv_l (struct __locale_t *locale);
@@ -251,6 +254,32 @@ __get_C_locale (void)
 #endif
 }
 
+/* Nonzero if category of locale is the "C" locale.  Hot paths check this
+   once and then use the constant "C" locale data instead of fetching it
+   through the locale object.  Always true on !_MB_CAPABLE targets, which
+   only support the "C" locale. */
+_ELIDABLE_INLINE int
+__locale_is_C_l (struct __locale_t *locale, int category)
+{
+#ifndef _MB_CAPABLE
+  return 1;
+#else
+  return locale->categories[category][0] == 'C'
+	 && locale->categories[category][1] == '\0';
+#endif
+}
+
+/* Same for the current locale. */
+_ELIDABLE_INLINE int
+__locale_is_C (int category)
+{
+#ifndef _MB_CAPABLE
+  return 1;
+#else
+  return __locale_is_C_l (__get_current_locale (), category);
+#endif
+}
+
 #ifdef __CYGWIN__
 _ELIDABLE_INLINE const struct lc_collate_T *
 __get_collate_locale (struct __locale_t *locale)
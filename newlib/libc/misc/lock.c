@@ -20,6 +20,12 @@ INDEX
 	__lock___dd_hash_mutex
 INDEX
 	__lock___arc4random_mutex
+INDEX
+	__lock___locale_intern_mutex
+INDEX
+	__lock___fnmatch_lock
+INDEX
+	__lock___iconv_ext_tables_mutex
 
 INDEX
 	__retarget_lock_init
@@ -53,6 +59,9 @@ SYNOPSIS
 	struct __lock __lock___tz_mutex;
 	struct __lock __lock___dd_hash_mutex;
 	struct __lock __lock___arc4random_mutex;
+	struct __lock __lock___locale_intern_mutex;
+	struct __lock __lock___fnmatch_lock;
+	struct __lock __lock___iconv_ext_tables_mutex;
 
 	void __retarget_lock_init (_LOCK_T * <[lock_ptr]>);
 	void __retarget_lock_init_recursive (_LOCK_T * <[lock_ptr]>);
@@ -101,6 +110,9 @@ struct __lock __lock___env_recursive_mutex;
 struct __lock __lock___tz_mutex;
 struct __lock __lock___dd_hash_mutex;
 struct __lock __lock___arc4random_mutex;
+struct __lock __lock___locale_intern_mutex;
+struct __lock __lock___fnmatch_lock;
+struct __lock __lock___iconv_ext_tables_mutex;
 
 void
 __retarget_lock_init (_LOCK_T *lock)
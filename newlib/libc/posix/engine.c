@@ -53,6 +53,10 @@
 #define	print	sprint
 #define	at	sat
 #define	match	smat
+#define	dfast	sdfast
+#define	dflags	sdflags
+#define	dtrans	sdtrans
+#define	dstate	sdstate
 #endif
 #ifdef LNAMES
 #define	matcher	lmatcher
@@ -64,8 +68,117 @@
 #define	print	lprint
 #define	at	lat
 #define	match	lmat
+#define	dfast	ldfast
+#define	dflags	ldflags
+#define	dtrans	ldtrans
+#define	dstate	ldstate
 #endif
 
+#ifndef DFA_MAXSTATES
+/*
+ * Lazy DFA used by dfast() in place of fast() for REs without back
+ * references.  A DFA state is a set of strip states as seen by fast() at
+ * the top of its loop, plus the class of the character preceding the
+ * current position (which decides BOL, BOW and EOW).  Transitions are
+ * computed with step() the first time they are needed and cached for the
+ * rest of the call, so each distinct (state, character) pair costs one
+ * NFA step no matter how long the string is.  The cache is bounded; when
+ * it fills up it is flushed, and if that keeps happening dfast() hands the
+ * string to fast().
+ */
+#define	DFA_MINLEN	64	/* shorter strings are left to fast() */
+#define	DFA_INITSTATES	16	/* initial cache size, in DFA states */
+#define	DFA_MAXSTATES	256	/* maximum cache size, in DFA states */
+#define	DFA_MAXFLUSH	8	/* give up after this many cache flushes */
+#define	DFA_NCHAR	(UCHAR_MAX+1)
+#define	DFA_UNKNOWN	(-1)	/* transition not computed yet */
+#define	DFA_MATCH	(-2)	/* a match has ended before this character */
+#define	DFA_FAIL	(-3)	/* out of memory or cache thrashing */
+/* classes of the preceding character */
+#define	DFA_PREV_OUT	0	/* beginning of string */
+#define	DFA_PREV_NL	1	/* newline */
+#define	DFA_PREV_WORD	2	/* word character */
+#define	DFA_PREV_OTHER	3	/* anything else */
+#define	DFA_PREV(c)	((c) == OUT ? DFA_PREV_OUT : (c) == '\n' ? \
+			DFA_PREV_NL : ISWORD(c) ? DFA_PREV_WORD : DFA_PREV_OTHER)
+
+struct dfa {
+	size_t setsize;		/* bytes per set of strip states */
+	int nstates;		/* DFA states in use */
+	int maxstates;		/* DFA states allocated */
+	int nflush;		/* times the cache has been flushed */
+	short hash[2*DFA_MAXSTATES];	/* open addressing, -1 if empty */
+	short *next;		/* -> short [maxstates][DFA_NCHAR] */
+	char *prev;		/* -> char [maxstates], DFA_PREV_* */
+	char *isfresh;		/* -> char [maxstates], set == fresh */
+	char *sets;		/* -> char [maxstates][setsize] */
+};
+
+static int
+dfa_grow(struct dfa *d, int n)
+{
+	short *next;
+	char *prev, *isfresh, *sets;
+
+	next = (short *)realloc(d->next, n * DFA_NCHAR * sizeof(short));
+	if (next == NULL)
+		return(REG_ESPACE);
+	d->next = next;
+	prev = (char *)realloc(d->prev, n);
+	if (prev == NULL)
+		return(REG_ESPACE);
+	d->prev = prev;
+	isfresh = (char *)realloc(d->isfresh, n);
+	if (isfresh == NULL)
+		return(REG_ESPACE);
+	d->isfresh = isfresh;
+	sets = (char *)realloc(d->sets, n * d->setsize);
+	if (sets == NULL)
+		return(REG_ESPACE);
+	d->sets = sets;
+	d->maxstates = n;
+	return(0);
+}
+
+static void
+dfa_flush(struct dfa *d)
+{
+	memset(d->hash, -1, sizeof(d->hash));
+	d->nstates = 0;
+}
+
+static int
+dfa_init(struct dfa *d, size_t setsize)
+{
+	d->setsize = setsize;
+	d->maxstates = 0;
+	d->nflush = 0;
+	d->next = NULL;
+	d->prev = d->isfresh = d->sets = NULL;
+	dfa_flush(d);
+	return(dfa_grow(d, DFA_INITSTATES));
+}
+
+static void
+dfa_free(struct dfa *d)
+{
+	free(d->next);
+	free(d->prev);
+	free(d->isfresh);
+	free(d->sets);
+}
+
+static unsigned
+dfa_hash(const char *set, size_t len, int prev)
+{
+	unsigned h = 2166136261U ^ (unsigned)prev;
+
+	while (len-- > 0)
+		h = (h ^ (unsigned char)*set++) * 16777619U;
+	return(h);
+}
+#endif /* !DFA_MAXSTATES */
+
 /* another structure passed up and down to avoid zillions of parameters */
 struct match {
 	struct re_guts *g;
@@ -94,6 +207,10 @@ static char *dissect(struct match *m, char *start, char *stop, sopno startst, so
 static char *backref(struct match *m, char *start, char *stop, sopno startst, sopno stopst, sopno lev);
 static char *fast(struct match *m, char *start, char *stop, sopno startst, sopno stopst);
 static char *slow(struct match *m, char *start, char *stop, sopno startst, sopno stopst);
+static char *dfast(struct match *m, char *start, char *stop, sopno startst, sopno stopst);
+static states dflags(struct match *m, sopno startst, sopno stopst, states st, int prev, int c);
+static int dtrans(struct match *m, struct dfa *d, int cur, int c, sopno startst, sopno stopst);
+static int dstate(struct match *m, struct dfa *d, states st, int prev);
 static states step(struct re_guts *g, sopno start, sopno stop, states bef, int ch, states aft);
 #define	BOL	(OUT+1)
 #define	EOL	(BOL+1)
@@ -151,13 +268,6 @@ int eflags;
 	const sopno gl = g->laststate;
 	char *start;
 	char *stop;
-	/* Boyer-Moore algorithms variables */
-	char *pp;
-	int cj, mj;
-	char *mustfirst;
-	char *mustlast;
-	int *matchjump;
-	int *charjump;
 
 	/* simplify the situation where possible */
 	if (g->cflags&REG_NOSUB)
@@ -174,46 +284,10 @@ int eflags;
 
 	/* prescreening; this does wonders for this rather slow code */
 	if (g->must != NULL) {
-		if (g->charjump != NULL && g->matchjump != NULL) {
-			mustfirst = g->must;
-			mustlast = g->must + g->mlen - 1;
-			charjump = g->charjump;
-			matchjump = g->matchjump;
-			pp = mustlast;
-			for (dp = start+g->mlen-1; dp < stop;) {
-				/* Fast skip non-matches */
-				while (dp < stop && charjump[(unsigned char) *dp])
-					dp += charjump[(unsigned char) *dp];
-
-				if (dp >= stop)
-					break;
-
-				/* Greedy matcher */
-				/* We depend on not being used for
-				 * for strings of length 1
-				 */
-				while (*--dp == *--pp && pp != mustfirst);
-
-				if (*dp == *pp)
-					break;
-
-				/* Jump to next possible match */
-				mj = matchjump[pp - mustfirst];
-				cj = charjump[(unsigned char) *dp];
-				dp += (cj < mj ? mj : cj);
-				pp = mustlast;
-			}
-			if (pp != mustfirst)
-				return(REG_NOMATCH);
-		} else {
-			for (dp = start; dp < stop; dp++)
-				if (*dp == g->must[0] &&
-				    stop - dp >= g->mlen &&
-				    memcmp(dp, g->must, (size_t)g->mlen) == 0)
-					break;
-			if (dp == stop)		/* we didn't find g->must */
-				return(REG_NOMATCH);
-		}
+		dp = memmem(start, (size_t)(stop - start), g->must,
+							(size_t)g->mlen);
+		if (dp == NULL)		/* we didn't find g->must */
+			return(REG_NOMATCH);
 	}
 
 	/* match struct setup */
@@ -235,9 +309,31 @@ int eflags;
 	if (g->moffset > -1)
 		start = ((dp - g->moffset) < start) ? start : dp - g->moffset;
 
+	/* Skip ahead to the first character that can begin a match */
+	if (g->firstmap != NULL) {
+		if (g->nfirst == 1)
+			dp = memchr(start, g->firstch, (size_t)(stop - start));
+		else {
+			for (dp = start; dp < stop; dp++)
+				if (g->firstmap[(uch)*dp])
+					break;
+			if (dp == stop)
+				dp = NULL;
+		}
+		if (dp == NULL) {
+			STATETEARDOWN(m);
+			return(REG_NOMATCH);
+		}
+		start = dp;
+	}
+
 	/* this loop does only one repetition except for backrefs */
 	for (;;) {
-		endp = fast(m, start, stop, gf, gl);
+		if (!g->backrefs && !(m->eflags&REG_NODFA) &&
+						stop - start >= DFA_MINLEN)
+			endp = dfast(m, start, stop, gf, gl);
+		else
+			endp = fast(m, start, stop, gf, gl);
 		if (endp == NULL) {		/* a miss */
 			STATETEARDOWN(m);
 			return(REG_NOMATCH);
@@ -915,6 +1011,199 @@ sopno stopst;
 	return(matchp);
 }
 
+/*
+ - dfast - fast() as a lazily built DFA; same contract and results
+ == static char *dfast(struct match *m, char *start, \
+ ==	char *stop, sopno startst, sopno stopst);
+ */
+static char *			/* where tentative match ended, or NULL */
+dfast(m, start, stop, startst, stopst)
+struct match *m;
+char *start;
+char *stop;
+sopno startst;
+sopno stopst;
+{
+	states st = m->st;
+	states fresh = m->fresh;
+	struct dfa d;
+	char *p = start;
+	int c = (start == m->beginp) ? OUT : *(start-1);
+	int cur;
+	int nxt;
+	char *coldp;		/* last p after which no match was underway */
+
+	CLEAR(st);
+	SET1(st, startst);
+	st = step(m->g, startst, stopst, st, NOTHING, st);
+	ASSIGN(fresh, st);
+	m->fresh = fresh;	/* dtrans() and dstate() want it too */
+	if (dfa_init(&d, STATEBYTES(m)) != 0) {
+		dfa_free(&d);
+		return(fast(m, start, stop, startst, stopst));
+	}
+	cur = dstate(m, &d, st, DFA_PREV(c));
+	coldp = NULL;
+	for (;;) {
+		if (d.isfresh[cur])
+			coldp = p;
+		if (p == stop)
+			break;
+		nxt = d.next[cur*DFA_NCHAR + (uch)*p];
+		if (nxt < 0) {
+			if (nxt == DFA_UNKNOWN)
+				nxt = dtrans(m, &d, cur, *p, startst, stopst);
+			if (nxt == DFA_MATCH) {
+				dfa_free(&d);
+				m->coldp = coldp;
+				return(p+1);
+			}
+			if (nxt == DFA_FAIL) {
+				NOTE("dfa gave up");
+				dfa_free(&d);
+				return(fast(m, start, stop, startst, stopst));
+			}
+		}
+		cur = nxt;
+		p++;
+	}
+
+	/* at the end, see whether the match completes with c == OUT */
+	LOADSTATE(st, &d.sets[cur*d.setsize]);
+	st = dflags(m, startst, stopst, st, d.prev[cur], OUT);
+	dfa_free(&d);
+	assert(coldp != NULL);
+	m->coldp = coldp;
+	if (ISSET(st, stopst))
+		return(p+1);
+	else
+		return(NULL);
+}
+
+/*
+ - dflags - apply the BOL/EOL/BOW/EOW steps fast() does between characters
+ == static states dflags(struct match *m, sopno startst, sopno stopst, \
+ ==	states st, int prev, int c);
+ */
+static states
+dflags(m, startst, stopst, st, prev, c)
+struct match *m;
+sopno startst;
+sopno stopst;
+states st;
+int prev;			/* DFA_PREV_* class of the previous character */
+int c;				/* next character, or OUT */
+{
+	int flagch;
+	int i;
+
+	flagch = '\0';
+	i = 0;
+	if ( (prev == DFA_PREV_NL && m->g->cflags&REG_NEWLINE) ||
+			(prev == DFA_PREV_OUT && !(m->eflags&REG_NOTBOL)) ) {
+		flagch = BOL;
+		i = m->g->nbol;
+	}
+	if ( (c == '\n' && m->g->cflags&REG_NEWLINE) ||
+			(c == OUT && !(m->eflags&REG_NOTEOL)) ) {
+		flagch = (flagch == BOL) ? BOLEOL : EOL;
+		i += m->g->neol;
+	}
+	for (; i > 0; i--)
+		st = step(m->g, startst, stopst, st, flagch, st);
+
+	if ( (flagch == BOL || prev == DFA_PREV_NL || prev == DFA_PREV_OTHER) &&
+					(c != OUT && ISWORD(c)) ) {
+		flagch = BOW;
+	}
+	if ( prev == DFA_PREV_WORD &&
+				(flagch == EOL || (c != OUT && !ISWORD(c))) ) {
+		flagch = EOW;
+	}
+	if (flagch == BOW || flagch == EOW)
+		st = step(m->g, startst, stopst, st, flagch, st);
+	return(st);
+}
+
+/*
+ - dtrans - compute and cache the transition of DFA state cur on c
+ == static int dtrans(struct match *m, struct dfa *d, int cur, int c, \
+ ==	sopno startst, sopno stopst);
+ */
+static int			/* next DFA state, DFA_MATCH or DFA_FAIL */
+dtrans(m, d, cur, c, startst, stopst)
+struct match *m;
+struct dfa *d;
+int cur;
+int c;
+sopno startst;
+sopno stopst;
+{
+	states st = m->st;
+	states tmp = m->tmp;
+	int nflush = d->nflush;
+	int nxt;
+
+	LOADSTATE(st, &d->sets[cur*d->setsize]);
+	st = dflags(m, startst, stopst, st, d->prev[cur], c);
+	if (ISSET(st, stopst)) {
+		d->next[cur*DFA_NCHAR + (uch)c] = DFA_MATCH;
+		return(DFA_MATCH);
+	}
+	ASSIGN(tmp, st);
+	ASSIGN(st, m->fresh);
+	st = step(m->g, startst, stopst, tmp, c, st);
+	nxt = dstate(m, d, st, DFA_PREV(c));
+	/* a flush may have discarded cur, in which case there's no slot */
+	if (nxt >= 0 && d->nflush == nflush)
+		d->next[cur*DFA_NCHAR + (uch)c] = nxt;
+	return(nxt);
+}
+
+/*
+ - dstate - find or add the DFA state for (st, prev)
+ == static int dstate(struct match *m, struct dfa *d, states st, int prev);
+ */
+static int			/* DFA state, or DFA_FAIL */
+dstate(m, d, st, prev)
+struct match *m;
+struct dfa *d;
+states st;
+int prev;
+{
+	char *set;
+	unsigned h;
+	int n;
+
+	if (d->nstates == d->maxstates) {
+		if (d->maxstates < DFA_MAXSTATES) {
+			if (dfa_grow(d, d->maxstates*2) != 0)
+				return(DFA_FAIL);
+		} else {
+			if (++d->nflush > DFA_MAXFLUSH)
+				return(DFA_FAIL);
+			NOTE("dfa flush");
+			dfa_flush(d);
+		}
+	}
+	/* build the key in the first free slot, keep it if it's new */
+	set = &d->sets[d->nstates*d->setsize];
+	SAVESTATE(set, st);
+	h = dfa_hash(set, d->setsize, prev) & (2*DFA_MAXSTATES - 1);
+	while ((n = d->hash[h]) >= 0) {
+		if (d->prev[n] == prev &&
+		    memcmp(&d->sets[n*d->setsize], set, d->setsize) == 0)
+			return(n);
+		h = (h + 1) & (2*DFA_MAXSTATES - 1);
+	}
+	n = d->nstates++;
+	d->hash[h] = n;
+	d->prev[n] = prev;
+	d->isfresh[n] = EQ(st, m->fresh);
+	memset(&d->next[n*DFA_NCHAR], DFA_UNKNOWN & 0xff,
+					DFA_NCHAR*sizeof(short));
+	return(n);
+}
 
 /*
  - step - map set of states reachable before char to set reachable after
@@ -1139,3 +1428,7 @@ int ch;
 #undef	print
 #undef	at
 #undef	match
+#undef	dfast
+#undef	dflags
+#undef	dtrans
+#undef	dstate
@@ -44,8 +44,11 @@ static char sccsid[] = "@(#)fnmatch.c	8.2 (Berkeley) 4/16/94";
 
 #include <ctype.h>
 #include <fnmatch.h>
+#include <limits.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <sys/lock.h>
 
 #include "collate.h"
 
@@ -55,10 +58,11 @@ static char sccsid[] = "@(#)fnmatch.c	8.2 (Berkeley) 4/16/94";
 #define RANGE_NOMATCH   0
 #define RANGE_ERROR     (-1)
 
+static int fnmatch1(const char *, const char *, int);
 static int rangematch(const char *, char, int, char **);
 
-int
-fnmatch(pattern, string, flags)
+static int
+fnmatch1(pattern, string, flags)
 	const char *pattern, *string;
 	int flags;
 {
@@ -110,7 +114,7 @@ fnmatch(pattern, string, flags)
 
 			/* General case, use recursion. */
 			while ((test = *string) != EOS) {
-				if (!fnmatch(pattern, string, flags & ~FNM_PERIOD))
+				if (!fnmatch1(pattern, string, flags & ~FNM_PERIOD))
 					return (0);
 				if (test == '/' && flags & FNM_PATHNAME)
 					break;
@@ -229,4 +233,418 @@ rangematch(pattern, test, flags, newp)
 	return (ok == negate ? RANGE_NOMATCH : RANGE_MATCH);
 }
 
+/*
+ * Compiled patterns.
+ *
+ * fnmatch_compile() parses a pattern once into a list of operations:
+ * runs of literal characters, '?', bracket expressions reduced to a
+ * bitmap of the characters they accept, and '*'.  Bracket expressions
+ * are evaluated by rangematch() itself for every character, so the
+ * bitmaps reflect the collation and case mapping in effect at compile
+ * time, as with regcomp(3).
+ *
+ * fnmatch_exec() runs the list without recursion: on a mismatch it
+ * returns to the last '*' and lets it swallow one more character.  That
+ * is enough because whatever an earlier '*' could have matched instead,
+ * the last one can match as well (with FNM_PATHNAME no '*' gets past a
+ * '/', which only a literal '/' matches).  A '*' other than one at the
+ * end of the pattern or just before a '/' under FNM_PATHNAME turns off
+ * FNM_PERIOD for the rest of the pattern, exactly as the recursion in
+ * fnmatch1() does.
+ */
+#define	FNO_END		0	/* end of pattern */
+#define	FNO_LIT		1	/* literal run: len chars at lits + arg */
+#define	FNO_ONE		2	/* ? */
+#define	FNO_SET		3	/* [...]: bitmap number arg */
+#define	FNO_STAR	4	/* *, how in arg */
+
+#define	FNS_GENERAL	0	/* match anything, backtrack */
+#define	FNS_END		1	/* at the end of the pattern */
+#define	FNS_SLASH	2	/* before a '/', FNM_PATHNAME */
+
+#define	FNP_GENERAL	0	/* run the operations */
+#define	FNP_LITERAL	1	/* plain string, compare */
+#define	FNP_SUFFIX	2	/* '*' and a literal, compare the tail */
+
+#define	FN_SETBYTES	((UCHAR_MAX + 1) / CHAR_BIT)
+#define	FN_INSET(set, c) \
+	((set)[(u_char)(c) / CHAR_BIT] & (1 << ((u_char)(c) % CHAR_BIT)))
+
+struct __fnmatch_op {
+	int op;
+	int arg;
+	size_t len;
+};
+
+struct __fnmatch_pat {
+	int flags;
+	int type;		/* FNP_* */
+	struct __fnmatch_op *ops;
+	char *lits;		/* literal characters, runs NUL-terminated */
+	u_char *sets;		/* FN_SETBYTES per bracket expression */
+	u_char fold[UCHAR_MAX + 1];	/* tolower(), for FNM_CASEFOLD */
+};
+
+fnmatch_pat_t
+fnmatch_compile(pattern, flags)
+	const char *pattern;
+	int flags;
+{
+	struct __fnmatch_pat *fp;
+	struct __fnmatch_op *op;
+	size_t len, nsets;
+	const char *p;
+	char *lp, *newp;
+	u_char *set;
+	int c, t;
+
+	len = strlen(pattern);
+	for (nsets = 0, p = pattern; *p != EOS; p++)
+		if (*p == '[')
+			nsets++;
+	/* at most one op per pattern character, plus FNO_END */
+	fp = malloc(sizeof(*fp) + (len + 1) * sizeof(*op) +
+	    nsets * FN_SETBYTES + 2 * len + 1);
+	if (fp == NULL)
+		return (NULL);
+	fp->flags = flags;
+	fp->ops = (struct __fnmatch_op *)(fp + 1);
+	fp->sets = (u_char *)(fp->ops + len + 1);
+	fp->lits = (char *)(fp->sets + nsets * FN_SETBYTES);
+	for (c = 0; c <= UCHAR_MAX; c++)
+		fp->fold[c] = (flags & FNM_CASEFOLD) ? tolower(c) : c;
+
+	op = fp->ops;
+	lp = fp->lits;
+	nsets = 0;
+	p = pattern;
+	for (;;) {
+		switch (c = *p++) {
+		case EOS:
+			goto done;
+		case '?':
+			op->op = FNO_ONE;
+			op++;
+			continue;
+		case '*':
+			while (*p == '*')
+				p++;
+			op->op = FNO_STAR;
+			if (*p == EOS)
+				op->arg = FNS_END;
+			else if (*p == '/' && (flags & FNM_PATHNAME))
+				op->arg = FNS_SLASH;
+			else
+				op->arg = FNS_GENERAL;
+			op++;
+			continue;
+		case '[':
+			newp = NULL;
+			c = rangematch(p, 'a', flags, &newp);
+			if (c == RANGE_ERROR) {
+				c = '[';
+				break;
+			}
+			set = fp->sets + nsets * FN_SETBYTES;
+			memset(set, 0, FN_SETBYTES);
+			op->op = FNO_SET;
+			op->arg = nsets++;
+			op++;
+			if (c == RANGE_NOMATCH && newp == NULL) {
+				/* a '/' in it under FNM_PATHNAME: never matches */
+				goto done;
+			}
+			for (t = 1; t <= UCHAR_MAX; t++)
+				if (rangematch(p, (char)t, flags, &newp) ==
+				    RANGE_MATCH)
+					set[t / CHAR_BIT] |= 1 << (t % CHAR_BIT);
+			p = newp;
+			continue;
+		case '\\':
+			if (!(flags & FNM_NOESCAPE)) {
+				if ((c = *p++) == EOS) {
+					c = '\\';
+					--p;
+				}
+			}
+			break;
+		default:
+			break;
+		}
+		/* a literal character, extend the current run */
+		if (op == fp->ops || op[-1].op != FNO_LIT) {
+			if (lp != fp->lits)
+				*lp++ = EOS;
+			op->op = FNO_LIT;
+			op->arg = lp - fp->lits;
+			op->len = 0;
+			op++;
+		}
+		*lp++ = fp->fold[(u_char)c];
+		op[-1].len++;
+	}
+done:
+	*lp = EOS;
+	op->op = FNO_END;
+
+	fp->type = FNP_GENERAL;
+	if (!(flags & (FNM_CASEFOLD | FNM_LEADING_DIR))) {
+		op = fp->ops;
+		if (op[0].op == FNO_END ||
+		    (op[0].op == FNO_LIT && op[1].op == FNO_END))
+			fp->type = FNP_LITERAL;
+		else if (op[0].op == FNO_STAR && op[0].arg != FNS_END &&
+		    op[1].op == FNO_LIT && op[2].op == FNO_END)
+			fp->type = FNP_SUFFIX;
+	}
+	return (fp);
+}
+
+#define	ATPERIOD(s) \
+	(period && *(s) == '.' && ((s) == string || \
+	    ((flags & FNM_PATHNAME) && (s)[-1] == '/')))
+
+int
+fnmatch_exec(fp, string)
+	fnmatch_pat_t fp;
+	const char *string;
+{
+	const struct __fnmatch_op *op, *bop;
+	const char *s, *bs, *lit, *tail;
+	const u_char *fold;
+	size_t i, n;
+	int flags, period;
+
+	flags = fp->flags;
+	period = flags & FNM_PERIOD;
+	op = fp->ops;
+
+	switch (fp->type) {
+	case FNP_LITERAL:
+		return (strcmp(fp->lits, string) == 0 ? 0 : FNM_NOMATCH);
+	case FNP_SUFFIX:
+		if (ATPERIOD(string))
+			return (FNM_NOMATCH);
+		n = strlen(string);
+		if (n < op[1].len)
+			return (FNM_NOMATCH);
+		tail = string + n - op[1].len;
+		if ((flags & FNM_PATHNAME) &&
+		    memchr(string, '/', tail - string) != NULL)
+			return (FNM_NOMATCH);
+		return (memcmp(tail, fp->lits, op[1].len) == 0 ?
+		    0 : FNM_NOMATCH);
+	}
+
+	fold = fp->fold;
+	bop = NULL;
+	bs = NULL;
+	s = string;
+	for (;;) {
+		switch (op->op) {
+		case FNO_END:
+			if (*s == EOS ||
+			    ((flags & FNM_LEADING_DIR) && *s == '/'))
+				return (0);
+			goto fail;
+		case FNO_LIT:
+			lit = fp->lits + op->arg;
+			for (i = 0; i < op->len; i++)
+				if (fold[(u_char)s[i]] != (u_char)lit[i])
+					goto fail;
+			s += op->len;
+			break;
+		case FNO_ONE:
+		case FNO_SET:
+			if (*s == EOS ||
+			    (*s == '/' && (flags & FNM_PATHNAME)) ||
+			    ATPERIOD(s))
+				goto fail;
+			if (op->op == FNO_SET &&
+			    !FN_INSET(fp->sets + op->arg * FN_SETBYTES, *s))
+				goto fail;
+			s++;
+			break;
+		case FNO_STAR:
+			if (ATPERIOD(s))
+				goto fail;
+			if (op->arg == FNS_END) {
+				if (!(flags & FNM_PATHNAME) ||
+				    (flags & FNM_LEADING_DIR) ||
+				    strchr(s, '/') == NULL)
+					return (0);
+				goto fail;
+			}
+			if (op->arg == FNS_SLASH) {
+				if ((s = strchr(s, '/')) == NULL)
+					goto fail;
+				break;
+			}
+			if (*s == EOS)
+				goto fail;
+			period = 0;
+			bop = op + 1;
+			bs = s;
+			break;
+		}
+		op++;
+		continue;
+fail:
+		/* let the last '*' swallow one more character */
+		if (bop == NULL || *bs == EOS ||
+		    (*bs == '/' && (flags & FNM_PATHNAME)))
+			return (FNM_NOMATCH);
+		s = ++bs;
+		op = bop;
+	}
+}
+
+void
+fnmatch_free(fp)
+	fnmatch_pat_t fp;
+{
+
+	free(fp);
+}
+
+#if !defined(PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__)
+/*
+ * A few recently used patterns, kept compiled for fnmatch().  A pattern
+ * is only compiled the second time in a row it misses, so a stream of
+ * one-off patterns costs no more than a hash.  Patterns without wildcards
+ * are cheap enough to match as they are, and FNM_CASEFOLD patterns are
+ * not cached since their compiled form depends on the current locale.
+ */
+#define	FNM_NCACHE	8
+
+/*
+ * An entry stays allocated while a match runs on it, even if another
+ * thread replaces it in the cache meanwhile, so that the lock is only
+ * held for the lookup and not for the match.
+ */
+struct fnmatch_cent {
+	int refs;		/* the cache's and those of running matches */
+	int flags;
+	int collate;		/* __collate_load_error when compiled */
+	char *pattern;
+	fnmatch_pat_t fp;
+};
+
+static struct fnmatch_cent *fnmatch_cache[FNM_NCACHE];
+static int fnmatch_next;	/* slot to replace next */
+static unsigned long fnmatch_missed;	/* hash of the last miss */
+
+#ifndef __SINGLE_THREAD__
+__LOCK_INIT(static, __fnmatch_lock);
+#endif
+
+static unsigned long
+fnmatch_hash(pattern, flags)
+	const char *pattern;
+	int flags;
+{
+	unsigned long h = 2166136261UL ^ (unsigned)flags;
+
+	while (*pattern != EOS)
+		h = (h ^ (u_char)*pattern++) * 16777619UL;
+	return (h | 1);
+}
+
+/* Drop a reference to an entry, with the lock held. */
+static void
+fnmatch_unref(ce)
+	struct fnmatch_cent *ce;
+{
+
+	if (--ce->refs == 0) {
+		fnmatch_free(ce->fp);
+		free(ce);
+	}
+}
+
+static int
+fnmatch_cached(pattern, string, flags)
+	const char *pattern, *string;
+	int flags;
+{
+	struct fnmatch_cent *ce;
+	const char *p;
+	unsigned long h;
+	size_t len;
+	int i, ret;
+
+	if (flags & FNM_CASEFOLD)
+		return (fnmatch1(pattern, string, flags));
+	for (p = pattern; *p != '*' && *p != '?' && *p != '['; p++)
+		if (*p == EOS)
+			return (fnmatch1(pattern, string, flags));
+
+#ifndef __SINGLE_THREAD__
+	__lock_acquire(__fnmatch_lock);
+#endif
+	for (i = 0; i < FNM_NCACHE; i++) {
+		ce = fnmatch_cache[i];
+		if (ce != NULL && ce->flags == flags &&
+		    ce->collate == __collate_load_error &&
+		    strcmp(ce->pattern, pattern) == 0)
+			goto hit;
+	}
+	h = fnmatch_hash(pattern, flags);
+	if (h != fnmatch_missed) {
+		fnmatch_missed = h;
+		goto uncached;
+	}
+	fnmatch_missed = 0;
+	len = strlen(pattern);
+	if ((ce = malloc(sizeof(*ce) + len + 1)) == NULL)
+		goto uncached;
+	ce->pattern = (char *)(ce + 1);
+	memcpy(ce->pattern, pattern, len + 1);
+	ce->flags = flags;
+	ce->collate = __collate_load_error;
+	if ((ce->fp = fnmatch_compile(pattern, flags)) == NULL) {
+		free(ce);
+		goto uncached;
+	}
+	ce->refs = 1;
+	if (fnmatch_cache[fnmatch_next] != NULL)
+		fnmatch_unref(fnmatch_cache[fnmatch_next]);
+	fnmatch_cache[fnmatch_next] = ce;
+	fnmatch_next = (fnmatch_next + 1) % FNM_NCACHE;
+hit:
+	ce->refs++;
+#ifndef __SINGLE_THREAD__
+	__lock_release(__fnmatch_lock);
+#endif
+	ret = fnmatch_exec(ce->fp, string);
+#ifndef __SINGLE_THREAD__
+	__lock_acquire(__fnmatch_lock);
+#endif
+	fnmatch_unref(ce);
+#ifndef __SINGLE_THREAD__
+	__lock_release(__fnmatch_lock);
+#endif
+	return (ret);
+
+uncached:
+#ifndef __SINGLE_THREAD__
+	__lock_release(__fnmatch_lock);
+#endif
+	return (fnmatch1(pattern, string, flags));
+}
+#endif /* !PREFER_SIZE_OVER_SPEED && !__OPTIMIZE_SIZE__ */
+
+int
+fnmatch(pattern, string, flags)
+	const char *pattern, *string;
+	int flags;
+{
+
+#if !defined(PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__)
+	return (fnmatch_cached(pattern, string, flags));
+#else
+	return (fnmatch1(pattern, string, flags));
+#endif
+}
+
 #endif /* !_NO_FNMATCH  */
@@ -132,9 +132,41 @@ typedef char Char;
 #define	M_SET		META('[')
 #define	ismeta(c)	(((c)&M_QUOTE) != 0)
 
+#ifdef DT_UNKNOWN
+#define	DTYPE(dp)	((dp)->d_type)
+#define	DTTOMODE(t)	((t) == DT_DIR ? S_IFDIR : \
+			 (t) == DT_LNK ? S_IFLNK : S_IFREG)
+#else
+#define	DT_UNKNOWN	0
+#define	DTYPE(dp)	DT_UNKNOWN
+#define	DTTOMODE(t)	0
+#endif
+#define	DT_NONE		(-1)	/* path not just read from its directory */
+
+#define	PATHV_MIN	16	/* smallest gl_pathv allocation */
+#define	DIRSTACK_MIN	8	/* smallest directory stack allocation */
+
+/*
+ * Per-call state passed down the expansion: the GLOB_LIMIT path limit
+ * and, for glob_stream(), the function the paths are handed to.
+ */
+struct glob_state {
+	int gs_limit;
+	int (*gs_func)(const char *, void *);
+	void *gs_arg;
+};
+
+/* A directory being read by glob2(). */
+struct glob_dir {
+	DIR *gd_dirp;
+	Char *gd_pathend;	/* where its entries are copied */
+	Char *gd_pattern;	/* the segment they must match */
+	Char *gd_restpattern;	/* and the rest of the pattern */
+};
 
 static int	 compare(const void *, const void *);
 static int	 g_Ctoc(const Char *, char *, u_int);
+static void	 g_closedir(DIR *, glob_t *);
 static int	 g_lstat(Char *, struct stat *, glob_t *);
 static DIR	*g_opendir(Char *, glob_t *);
 static Char	*g_strchr(Char *, int);
@@ -142,15 +174,22 @@ static Char	*g_strchr(Char *, int);
 static Char	*g_strcat(Char *, const Char *);
 #endif
 static int	 g_stat(Char *, struct stat *, glob_t *);
-static int	 glob0(const Char *, glob_t *, int *);
-static int	 glob1(Char *, glob_t *, int *);
-static int	 glob2(Char *, Char *, Char *, Char *, glob_t *, int *);
-static int	 glob3(Char *, Char *, Char *, Char *, Char *, glob_t *, int *);
-static int	 globextend(const Char *, glob_t *, int *);
+static int	 glob_internal(const char *__restrict, int,
+		    int (*)(const char *, int), glob_t *__restrict,
+		    struct glob_state *);
+static int	 glob0(const Char *, glob_t *, struct glob_state *);
+static int	 glob1(Char *, glob_t *, struct glob_state *);
+static int	 glob2(Char *, Char *, Char *, Char *, glob_t *,
+		    struct glob_state *);
+static int	 globfound(Char *, Char *, Char *, int, glob_t *,
+		    struct glob_state *);
+static int	 globextend(const Char *, glob_t *, struct glob_state *);
+static u_int	 pathvsize(u_int);
 static const Char *	
 		 globtilde(const Char *, Char *, size_t, glob_t *);
-static int	 globexp1(const Char *, glob_t *, int *);
-static int	 globexp2(const Char *, const Char *, glob_t *, int *, int *);
+static int	 globexp1(const Char *, glob_t *, struct glob_state *);
+static int	 globexp2(const Char *, const Char *, glob_t *, int *,
+		    struct glob_state *);
 static int	 match(Char *, Char *, Char *);
 #ifdef DEBUG
 static void	 qprintf(const char *, Char *);
@@ -161,9 +200,47 @@ glob(pattern, flags, errfunc, pglob)
 	const char *__restrict pattern;
 	int flags, (*errfunc)(const char *, int);
 	glob_t *__restrict pglob;
+{
+	struct glob_state gs;
+
+	gs.gs_func = NULL;
+	gs.gs_arg = NULL;
+	return (glob_internal(pattern, flags, errfunc, pglob, &gs));
+}
+
+/*
+ * Like glob(), but rather than collecting the paths in gl_pathv, hand
+ * each one to func as soon as it is found, so that a huge tree can be
+ * walked in constant memory.  The paths are not sorted and gl_pathv is
+ * left NULL; gl_pathc and gl_matchc count them as usual.  A nonzero
+ * return from func stops the walk and glob_stream() returns GLOB_ABEND.
+ */
+int
+glob_stream(pattern, flags, errfunc, func, arg, pglob)
+	const char *__restrict pattern;
+	int flags, (*errfunc)(const char *, int);
+	int (*func)(const char *, void *);
+	void *arg;
+	glob_t *__restrict pglob;
+{
+	struct glob_state gs;
+
+	gs.gs_func = func;
+	gs.gs_arg = arg;
+	flags &= ~(GLOB_APPEND | GLOB_DOOFFS);
+	return (glob_internal(pattern, flags | GLOB_NOSORT, errfunc, pglob,
+	    &gs));
+}
+
+static int
+glob_internal(pattern, flags, errfunc, pglob, gs)
+	const char *__restrict pattern;
+	int flags, (*errfunc)(const char *, int);
+	glob_t *__restrict pglob;
+	struct glob_state *gs;
 {
 	const u_char *patnext;
-	int c, limit;
+	int c;
 	Char *bufnext, *bufend, patbuf[MAXPATHLEN];
 
 	patnext = (u_char *) pattern;
@@ -174,11 +251,11 @@ glob(pattern, flags, errfunc, pglob)
 			pglob->gl_offs = 0;
 	}
 	if (flags & GLOB_LIMIT) {
-		limit = pglob->gl_matchc;
-		if (limit == 0)
-			limit = ARG_MAX;
+		gs->gs_limit = pglob->gl_matchc;
+		if (gs->gs_limit == 0)
+			gs->gs_limit = ARG_MAX;
 	} else
-		limit = 0;
+		gs->gs_limit = 0;
 	pglob->gl_flags = flags & ~GLOB_MAGCHAR;
 	pglob->gl_errfunc = errfunc;
 	pglob->gl_matchc = 0;
@@ -204,9 +281,9 @@ glob(pattern, flags, errfunc, pglob)
 	*bufnext = EOS;
 
 	if (flags & GLOB_BRACE)
-	    return globexp1(patbuf, pglob, &limit);
+	    return globexp1(patbuf, pglob, gs);
 	else
-	    return glob0(patbuf, pglob, &limit);
+	    return glob0(patbuf, pglob, gs);
 }
 
 /*
@@ -215,23 +292,23 @@ glob(pattern, flags, errfunc, pglob)
  * characters
  */
 static int
-globexp1(pattern, pglob, limit)
+globexp1(pattern, pglob, gs)
 	const Char *pattern;
 	glob_t *pglob;
-	int *limit;
+	struct glob_state *gs;
 {
 	const Char* ptr = pattern;
 	int rv;
 
 	/* Protect a single {}, for find(1), like csh */
 	if (pattern[0] == LBRACE && pattern[1] == RBRACE && pattern[2] == EOS)
-		return glob0(pattern, pglob, limit);
+		return glob0(pattern, pglob, gs);
 
 	while ((ptr = (const Char *) g_strchr((Char *) ptr, LBRACE)) != NULL)
-		if (!globexp2(ptr, pattern, pglob, &rv, limit))
+		if (!globexp2(ptr, pattern, pglob, &rv, gs))
 			return rv;
 
-	return glob0(pattern, pglob, limit);
+	return glob0(pattern, pglob, gs);
 }
 
 
@@ -241,10 +318,11 @@ globexp1(pattern, pglob, limit)
  * If it fails then it tries to glob the rest of the pattern and returns.
  */
 static int
-globexp2(ptr, pattern, pglob, rv, limit)
+globexp2(ptr, pattern, pglob, rv, gs)
 	const Char *ptr, *pattern;
 	glob_t *pglob;
-	int *rv, *limit;
+	int *rv;
+	struct glob_state *gs;
 {
 	int     i;
 	Char   *lm, *ls;
@@ -281,7 +359,7 @@ globexp2(ptr, pattern, pglob, rv, limit)
 
 	/* Non matching braces; just glob the pattern */
 	if (i != 0 || *pe == EOS) {
-		*rv = glob0(patbuf, pglob, limit);
+		*rv = glob0(patbuf, pglob, gs);
 		return 0;
 	}
 
@@ -328,7 +406,7 @@ globexp2(ptr, pattern, pglob, rv, limit)
 #ifdef DEBUG
 				qprintf("globexp2:", patbuf);
 #endif
-				*rv = globexp1(patbuf, pglob, limit);
+				*rv = globexp1(patbuf, pglob, gs);
 
 				/* move after the comma, to the next string */
 				pl = pm + 1;
@@ -428,10 +506,10 @@ globtilde(pattern, patbuf, patbuf_len, pglob)
  * to find no matches.
  */
 static int
-glob0(pattern, pglob, limit)
+glob0(pattern, pglob, gs)
 	const Char *pattern;
 	glob_t *pglob;
-	int *limit;
+	struct glob_state *gs;
 {
 	const Char *qpatnext;
 	int c, err, oldpathc;
@@ -493,7 +571,7 @@ glob0(pattern, pglob, limit)
 	qprintf("glob0:", patbuf);
 #endif
 
-	if ((err = glob1(patbuf, pglob, limit)) != 0)
+	if ((err = glob1(patbuf, pglob, gs)) != 0)
 		return(err);
 
 	/*
@@ -506,7 +584,7 @@ glob0(pattern, pglob, limit)
 	    ((pglob->gl_flags & GLOB_NOCHECK) ||
 	      ((pglob->gl_flags & GLOB_NOMAGIC) &&
 	       !(pglob->gl_flags & GLOB_MAGCHAR))))
-		return(globextend(pattern, pglob, limit));
+		return(globextend(pattern, pglob, gs));
 	else if (!(pglob->gl_flags & GLOB_NOSORT))
 		qsort(pglob->gl_pathv + pglob->gl_offs + oldpathc,
 		    pglob->gl_pathc - oldpathc, sizeof(char *), compare);
@@ -521,10 +599,10 @@ compare(p, q)
 }
 
 static int
-glob1(pattern, pglob, limit)
+glob1(pattern, pglob, gs)
 	Char *pattern;
 	glob_t *pglob;
-	int *limit;
+	struct glob_state *gs;
 {
 	Char pathbuf[MAXPATHLEN];
 
@@ -532,83 +610,31 @@ glob1(pattern, pglob, limit)
 	if (*pattern == EOS)
 		return(0);
 	return(glob2(pathbuf, pathbuf, pathbuf + MAXPATHLEN - 1,
-	    pattern, pglob, limit));
+	    pattern, pglob, gs));
 }
 
 /*
- * The functions glob2 and glob3 are mutually recursive; there is one level
- * of recursion for each segment in the pattern that contains one or more
- * meta characters.
+ * Walk the pattern one segment at a time: segments without meta
+ * characters are copied to the path as they are, and each segment that
+ * has them is matched against the entries of the directory named by the
+ * path so far.  Rather than recursing for every such segment, the open
+ * directories are kept on a stack; whenever a path is complete, or a
+ * directory can't be read, the walk carries on with the next matching
+ * entry of the innermost directory still open.
  */
 static int
-glob2(pathbuf, pathend, pathend_last, pattern, pglob, limit)
+glob2(pathbuf, pathend, pathend_last, pattern, pglob, gs)
 	Char *pathbuf, *pathend, *pathend_last, *pattern;
 	glob_t *pglob;
-	int *limit;
-{
-	struct stat sb;
-	Char *p, *q;
-	int anymeta;
-
-	/*
-	 * Loop over pattern segments until end of pattern or until
-	 * segment with meta character found.
-	 */
-	for (anymeta = 0;;) {
-		if (*pattern == EOS) {		/* End of pattern? */
-			*pathend = EOS;
-			if (g_lstat(pathbuf, &sb, pglob))
-				return(0);
-
-			if (((pglob->gl_flags & GLOB_MARK) &&
-			    pathend[-1] != SEP) && (S_ISDIR(sb.st_mode)
-			    || (S_ISLNK(sb.st_mode) &&
-			    (g_stat(pathbuf, &sb, pglob) == 0) &&
-			    S_ISDIR(sb.st_mode)))) {
-				if (pathend + 1 > pathend_last)
-					return (1);
-				*pathend++ = SEP;
-				*pathend = EOS;
-			}
-			++pglob->gl_matchc;
-			return(globextend(pathbuf, pglob, limit));
-		}
-
-		/* Find end of next segment, copy tentatively to pathend. */
-		q = pathend;
-		p = pattern;
-		while (*p != EOS && *p != SEP) {
-			if (ismeta(*p))
-				anymeta = 1;
-			if (q + 1 > pathend_last)
-				return (1);
-			*q++ = *p++;
-		}
-
-		if (!anymeta) {		/* No expansion, do next segment. */
-			pathend = q;
-			pattern = p;
-			while (*pattern == SEP) {
-				if (pathend + 1 > pathend_last)
-					return (1);
-				*pathend++ = *pattern++;
-			}
-		} else			/* Need expansion, recurse. */
-			return(glob3(pathbuf, pathend, pathend_last, pattern, p,
-			    pglob, limit));
-	}
-	/* NOTREACHED */
-}
-
-static int
-glob3(pathbuf, pathend, pathend_last, pattern, restpattern, pglob, limit)
-	Char *pathbuf, *pathend, *pathend_last, *pattern, *restpattern;
-	glob_t *pglob;
-	int *limit;
+	struct glob_state *gs;
 {
+	struct glob_dir *stack, *gd;
+	int depth, nalloc;
 	struct dirent *dp;
 	DIR *dirp;
-	int err;
+	Char *p, *q, *dc;
+	u_char *sc;
+	int anymeta, dtype, err;
 	char buf[MAXPATHLEN];
 
 	/*
@@ -619,66 +645,177 @@ glob3(pathbuf, pathend, pathend_last, pattern, restpattern, pglob, limit)
 	 */
 	struct dirent *(*readdirfunc)();
 
-	if (pathend > pathend_last)
-		return (1);
-	*pathend = EOS;
-	errno = 0;
-
-	if ((dirp = g_opendir(pathbuf, pglob)) == NULL) {
-		/* TODO: don't call for ENOENT or ENOTDIR? */
-		if (pglob->gl_errfunc) {
-			if (g_Ctoc(pathbuf, buf, sizeof(buf)))
-				return (GLOB_ABEND);
-			if (pglob->gl_errfunc(buf, errno) ||
-			    pglob->gl_flags & GLOB_ERR)
-				return (GLOB_ABEND);
-		}
-		return(0);
-	}
-
-	err = 0;
-
-	/* Search directory for matching names. */
 	if (pglob->gl_flags & GLOB_ALTDIRFUNC)
 		readdirfunc = pglob->gl_readdir;
 	else
 		readdirfunc = readdir;
-	while ((dp = (*readdirfunc)(dirp))) {
-		u_char *sc;
-		Char *dc;
-
-		/* Initial DOT must be matched literally. */
-		if (dp->d_name[0] == DOT && *pattern != DOT)
-			continue;
-		dc = pathend;
-		sc = (u_char *) dp->d_name;
-		while (dc < pathend_last && (*dc++ = *sc++) != EOS)
-			;
-		if (!match(pathend, pattern, restpattern)) {
+
+	stack = NULL;
+	depth = nalloc = 0;
+	dtype = DT_NONE;
+	err = 0;
+	for (;;) {
+		/*
+		 * Loop over pattern segments until end of pattern or until
+		 * segment with meta character found.
+		 */
+		for (anymeta = 0;;) {
+			if (*pattern == EOS) {		/* End of pattern? */
+				*pathend = EOS;
+				err = globfound(pathbuf, pathend, pathend_last,
+				    dtype, pglob, gs);
+				break;
+			}
+
+			/* Find end of next segment, copy tentatively to pathend. */
+			q = pathend;
+			p = pattern;
+			while (*p != EOS && *p != SEP) {
+				if (ismeta(*p))
+					anymeta = 1;
+				if (q + 1 > pathend_last) {
+					err = 1;
+					goto out;
+				}
+				*q++ = *p++;
+			}
+
+			if (!anymeta) {		/* No expansion, do next segment. */
+				pathend = q;
+				pattern = p;
+				dtype = DT_NONE;
+				while (*pattern == SEP) {
+					if (pathend + 1 > pathend_last) {
+						err = 1;
+						goto out;
+					}
+					*pathend++ = *pattern++;
+				}
+				continue;
+			}
+
+			/* Need expansion, open the directory. */
 			*pathend = EOS;
-			continue;
+			errno = 0;
+			if ((dirp = g_opendir(pathbuf, pglob)) == NULL) {
+				/* TODO: don't call for ENOENT or ENOTDIR? */
+				if (pglob->gl_errfunc) {
+					if (g_Ctoc(pathbuf, buf, sizeof(buf)) ||
+					    pglob->gl_errfunc(buf, errno) ||
+					    pglob->gl_flags & GLOB_ERR)
+						err = GLOB_ABEND;
+				}
+				break;
+			}
+			if (depth == nalloc) {
+				nalloc = nalloc ? 2 * nalloc : DIRSTACK_MIN;
+				gd = realloc(stack, nalloc * sizeof(*stack));
+				if (gd == NULL) {
+					g_closedir(dirp, pglob);
+					err = GLOB_NOSPACE;
+					goto out;
+				}
+				stack = gd;
+			}
+			gd = &stack[depth++];
+			gd->gd_dirp = dirp;
+			gd->gd_pathend = pathend;
+			gd->gd_pattern = pattern;
+			gd->gd_restpattern = p;
+			break;
 		}
-		err = glob2(pathbuf, --dc, pathend_last, restpattern,
-		    pglob, limit);
 		if (err)
+			goto out;
+
+		/* Search the innermost directory for the next matching name. */
+		for (;;) {
+			if (depth == 0)
+				goto out;
+			gd = &stack[depth - 1];
+			if ((dp = (*readdirfunc)(gd->gd_dirp)) == NULL) {
+				g_closedir(gd->gd_dirp, pglob);
+				depth--;
+				continue;
+			}
+
+			/* Initial DOT must be matched literally. */
+			if (dp->d_name[0] == DOT && *gd->gd_pattern != DOT)
+				continue;
+			dc = gd->gd_pathend;
+			sc = (u_char *) dp->d_name;
+			while (dc < pathend_last && (*dc++ = *sc++) != EOS)
+				;
+			if (!match(gd->gd_pathend, gd->gd_pattern,
+			    gd->gd_restpattern)) {
+				*gd->gd_pathend = EOS;
+				continue;
+			}
+			pathend = --dc;
+			pattern = gd->gd_restpattern;
+			/*
+			 * Trust the entry's type only if the name fit and it
+			 * came from readdir(3) itself.
+			 */
+			if (*dc == EOS && !(pglob->gl_flags & GLOB_ALTDIRFUNC))
+				dtype = DTYPE(dp);
+			else
+				dtype = DT_NONE;
 			break;
+		}
 	}
 
-	if (pglob->gl_flags & GLOB_ALTDIRFUNC)
-		(*pglob->gl_closedir)(dirp);
-	else
-		closedir(dirp);
+out:
+	while (depth > 0)
+		g_closedir(stack[--depth].gd_dirp, pglob);
+	free(stack);
 	return(err);
 }
 
+/*
+ * Add the complete path in pathbuf to the results.  A path whose last
+ * component was just read from its directory is known to exist, so it
+ * is only stat'ed when GLOB_MARK needs to know whether it is a directory
+ * and the directory entry did not say.
+ */
+static int
+globfound(pathbuf, pathend, pathend_last, dtype, pglob, gs)
+	Char *pathbuf, *pathend, *pathend_last;
+	int dtype;
+	glob_t *pglob;
+	struct glob_state *gs;
+{
+	struct stat sb;
+	mode_t mode;
+	int mark;
+
+	mark = (pglob->gl_flags & GLOB_MARK) && pathend[-1] != SEP;
+	if (dtype == DT_NONE || (mark && dtype == DT_UNKNOWN)) {
+		if (g_lstat(pathbuf, &sb, pglob))
+			return(0);
+		mode = sb.st_mode;
+	} else
+		mode = DTTOMODE(dtype);
+
+	if (mark && (S_ISDIR(mode) || (S_ISLNK(mode) &&
+	    (g_stat(pathbuf, &sb, pglob) == 0) &&
+	    S_ISDIR(sb.st_mode)))) {
+		if (pathend + 1 > pathend_last)
+			return (1);
+		*pathend++ = SEP;
+		*pathend = EOS;
+	}
+	++pglob->gl_matchc;
+	return(globextend(pathbuf, pglob, gs));
+}
+
 
 /*
  * Extend the gl_pathv member of a glob_t structure to accomodate a new item,
- * add the new item, and update gl_pathc.
+ * add the new item, and update gl_pathc.  For glob_stream() the item is
+ * passed to the caller's function instead.
  *
- * This assumes the BSD realloc, which only copies the block when its size
- * crosses a power-of-two boundary; for v7 realloc, this would cause quadratic
- * behavior.
+ * gl_pathv is always allocated to pathvsize() of the slots in use, so it
+ * only needs to be reallocated when that doubles.
  *
  * Return 0 if new item added, error code if memory couldn't be allocated.
  *
@@ -687,41 +824,54 @@ glob3(pathbuf, pathend, pathend_last, pattern, restpattern, pglob, limit)
  *	gl_pathv points to (gl_offs + gl_pathc + 1) items.
  */
 static int
-globextend(path, pglob, limit)
+globextend(path, pglob, gs)
 	const Char *path;
 	glob_t *pglob;
-	int *limit;
+	struct glob_state *gs;
 {
 	char **pathv;
 	int i;
-	u_int newsize, len;
+	u_int used, newsize, len;
 	char *copy;
 	const Char *p;
+	char buf[MAXPATHLEN];
 
-	if (*limit && pglob->gl_pathc > *limit) {
+	if (gs->gs_limit && pglob->gl_pathc > gs->gs_limit) {
 		errno = 0;
 		return (GLOB_NOSPACE);
 	}
 
-	newsize = sizeof(*pathv) * (2 + pglob->gl_pathc + pglob->gl_offs);
-	pathv = pglob->gl_pathv ?
-		    realloc((char *)pglob->gl_pathv, newsize) :
-		    malloc(newsize);
-	if (pathv == NULL) {
-		if (pglob->gl_pathv) {
-			free(pglob->gl_pathv);
-			pglob->gl_pathv = NULL;
-		}
-		return(GLOB_NOSPACE);
+	if (gs->gs_func != NULL) {
+		if (g_Ctoc(path, buf, sizeof(buf)))
+			return (GLOB_NOSPACE);
+		pglob->gl_pathc++;
+		return ((*gs->gs_func)(buf, gs->gs_arg) ? GLOB_ABEND : 0);
 	}
 
-	if (pglob->gl_pathv == NULL && pglob->gl_offs > 0) {
-		/* first time around -- clear initial gl_offs items */
-		pathv += pglob->gl_offs;
-		for (i = pglob->gl_offs; --i >= 0; )
-			*--pathv = NULL;
-	}
-	pglob->gl_pathv = pathv;
+	used = pglob->gl_offs + pglob->gl_pathc + 1;
+	if (pglob->gl_pathv == NULL ||
+	    pathvsize(used + 1) != pathvsize(used)) {
+		newsize = sizeof(*pathv) * pathvsize(used + 1);
+		pathv = pglob->gl_pathv ?
+			    realloc((char *)pglob->gl_pathv, newsize) :
+			    malloc(newsize);
+		if (pathv == NULL) {
+			if (pglob->gl_pathv) {
+				free(pglob->gl_pathv);
+				pglob->gl_pathv = NULL;
+			}
+			return(GLOB_NOSPACE);
+		}
+
+		if (pglob->gl_pathv == NULL && pglob->gl_offs > 0) {
+			/* first time around -- clear initial gl_offs items */
+			pathv += pglob->gl_offs;
+			for (i = pglob->gl_offs; --i >= 0; )
+				*--pathv = NULL;
+		}
+		pglob->gl_pathv = pathv;
+	} else
+		pathv = pglob->gl_pathv;
 
 	for (p = path; *p++;)
 		continue;
@@ -738,8 +888,23 @@ globextend(path, pglob, limit)
 }
 
 /*
- * pattern matching function for filenames.  Each occurrence of the *
- * pattern causes a recursion level.
+ * Number of gl_pathv slots allocated while n of them are in use.
+ */
+static u_int
+pathvsize(n)
+	u_int n;
+{
+	u_int size;
+
+	for (size = PATHV_MIN; size < n; size <<= 1)
+		continue;
+	return (size);
+}
+
+/*
+ * pattern matching function for filenames.  A * only ever needs to
+ * remember the latest place to resume from: if what follows it fails
+ * to match, let the * swallow one more character and try again.
  */
 static int
 match(name, pat, patend)
@@ -747,49 +912,59 @@ match(name, pat, patend)
 {
 	int ok, negate_range;
 	Char c, k;
-
-	while (pat < patend) {
-		c = *pat++;
-		switch (c & M_MASK) {
-		case M_ALL:
-			if (pat == patend)
-				return(1);
-			do
-			    if (match(name, pat, patend))
-				    return(1);
-			while (*name++ != EOS);
-			return(0);
-		case M_ONE:
-			if (*name++ == EOS)
-				return(0);
-			break;
-		case M_SET:
-			ok = 0;
-			if ((k = *name++) == EOS)
-				return(0);
-			if ((negate_range = ((*pat & M_MASK) == M_NOT)) != EOS)
-				++pat;
-			while (((c = *pat++) & M_MASK) != M_END)
-				if ((*pat & M_MASK) == M_RNG) {
-					if (__collate_load_error ?
-					    CHAR(c) <= CHAR(k) && CHAR(k) <= CHAR(pat[1]) :
-					       __collate_range_cmp(CHAR(c), CHAR(k)) <= 0
-					    && __collate_range_cmp(CHAR(k), CHAR(pat[1])) <= 0
-					   )
+	Char *nextp, *nextn;
+
+	nextp = nextn = NULL;
+	for (;;) {
+		while (pat < patend) {
+			c = *pat++;
+			switch (c & M_MASK) {
+			case M_ALL:
+				if (pat == patend)
+					return(1);
+				if (*name == EOS)
+					return(0);
+				nextn = name + 1;
+				nextp = pat - 1;
+				break;
+			case M_ONE:
+				if (*name++ == EOS)
+					goto fail;
+				break;
+			case M_SET:
+				ok = 0;
+				if ((k = *name++) == EOS)
+					goto fail;
+				if ((negate_range = ((*pat & M_MASK) == M_NOT)) != EOS)
+					++pat;
+				while (((c = *pat++) & M_MASK) != M_END)
+					if ((*pat & M_MASK) == M_RNG) {
+						if (__collate_load_error ?
+						    CHAR(c) <= CHAR(k) && CHAR(k) <= CHAR(pat[1]) :
+						       __collate_range_cmp(CHAR(c), CHAR(k)) <= 0
+						    && __collate_range_cmp(CHAR(k), CHAR(pat[1])) <= 0
+						   )
+							ok = 1;
+						pat += 2;
+					} else if (c == k)
 						ok = 1;
-					pat += 2;
-				} else if (c == k)
-					ok = 1;
-			if (ok == negate_range)
-				return(0);
-			break;
-		default:
-			if (*name++ != c)
-				return(0);
-			break;
+				if (ok == negate_range)
+					goto fail;
+				break;
+			default:
+				if (*name++ != c)
+					goto fail;
+				break;
+			}
 		}
+		if (*name == EOS)
+			return(1);
+fail:
+		if (nextn == NULL)
+			return(0);
+		pat = nextp;
+		name = nextn;
 	}
-	return(*name == EOS);
 }
 
 /* Free allocated data belonging to a glob_t structure. */
@@ -830,6 +1005,18 @@ g_opendir(str, pglob)
 	return(opendir(buf));
 }
 
+static void
+g_closedir(dirp, pglob)
+	DIR *dirp;
+	glob_t *pglob;
+{
+
+	if (pglob->gl_flags & GLOB_ALTDIRFUNC)
+		(*pglob->gl_closedir)(dirp);
+	else
+		closedir(dirp);
+}
+
 static int
 g_lstat(fn, sb, pglob)
 	Char *fn;
@@ -122,8 +122,8 @@ static void enlarge(struct parse *p, sopno size);
 static void stripsnug(struct parse *p, struct re_guts *g);
 static void findmust(struct parse *p, struct re_guts *g);
 static int altoffset(sop *scan, int offset, int mccs);
-static void computejumps(struct parse *p, struct re_guts *g);
-static void computematchjumps(struct parse *p, struct re_guts *g);
+static void findfirst(struct parse *p, struct re_guts *g);
+static int firstset(struct re_guts *g, sopno start, sopno stop, uch *map);
 static sopno pluscount(struct parse *p, struct re_guts *g);
 
 #ifdef __cplusplus
@@ -169,9 +169,6 @@ static int never = 0;		/* for use in asserts; shuts lint up */
 #define	never	0		/* some <assert.h>s have bugs too */
 #endif
 
-/* Macro used by computejump()/computematchjump() */
-#define MIN(a,b)	((a)<(b)?(a):(b))
-
 /*
  - regcomp - interface for parser and compilation
  = extern int regcomp(regex_t *__restrict, const char *__restrict, int);
@@ -245,9 +242,10 @@ int cflags;
 	g->neol = 0;
 	g->must = NULL;
 	g->moffset = -1;
-	g->charjump = NULL;
-	g->matchjump = NULL;
 	g->mlen = 0;
+	g->firstmap = NULL;
+	g->nfirst = 0;
+	g->firstch = 0;
 	g->nsub = 0;
 	g->ncategories = 1;	/* category 0 is "everything else" */
 	g->categories = &g->catspace[-(CHAR_MIN)];
@@ -270,17 +268,7 @@ int cflags;
 	categorize(p, g);
 	stripsnug(p, g);
 	findmust(p, g);
-	/* only use Boyer-Moore algorithm if the pattern is bigger
-	 * than three characters
-	 */
-	if(g->mlen > 3) {
-		computejumps(p, g);
-		computematchjumps(p, g);
-		if(g->matchjump == NULL && g->charjump != NULL) {
-			free(g->charjump);
-			g->charjump = NULL;
-		}
-	}
+	findfirst(p, g);
 	g->nplus = pluscount(p, g);
 	g->magic = MAGIC2;
 	preg->re_nsub = g->nsub;
@@ -1921,132 +1909,134 @@ int mccs;
 }
 
 /*
- - computejumps - compute char jumps for BM scan
- == static void computejumps(struct parse *p, struct re_guts *g);
- *
- * This algorithm assumes g->must exists and is has size greater than
- * zero. It's based on the algorithm found on Computer Algorithms by
- * Sara Baase.
+ - findfirst - find the characters that can begin a match
+ == static void findfirst(struct parse *p, struct re_guts *g);
  *
- * A char jump is the number of characters one needs to jump based on
- * the value of the character from the text that was mismatched.
+ * regexec() uses the result to skip, with memchr() where it can, over
+ * text that cannot start a match before running the automaton.
  */
 static void
-computejumps(p, g)
+findfirst(p, g)
 struct parse *p;
 struct re_guts *g;
 {
-	int ch;
-	int mindex;
+	uch *map;
+	int c;
 
-	/* Avoid making errors worse */
+	/* avoid making error situations worse */
 	if (p->error != 0)
 		return;
 
-	g->charjump = (int*) malloc((NC + 1) * sizeof(int));
-	if (g->charjump == NULL)	/* Not a fatal error */
+	map = (uch *)calloc(NC, sizeof(uch));
+	if (map == NULL)	/* not a fatal error */
+		return;
+	if (firstset(g, g->firststate+1, g->laststate, map) != 0) {
+		/* the match may be empty, or we could not tell */
+		free(map);
 		return;
-	/* Adjust for signed chars, if necessary */
-	g->charjump = &g->charjump[-(CHAR_MIN)];
-
-	/* If the character does not exist in the pattern, the jump
-	 * is equal to the number of characters in the pattern.
-	 */
-	for (ch = CHAR_MIN; ch < (CHAR_MAX + 1); ch++)
-		g->charjump[ch] = g->mlen;
-
-	/* If the character does exist, compute the jump that would
-	 * take us to the last character in the pattern equal to it
-	 * (notice that we match right to left, so that last character
-	 * is the first one that would be matched).
-	 */
-	for (mindex = 0; mindex < g->mlen; mindex++)
-		g->charjump[(unsigned char) g->must[mindex]] = g->mlen - mindex - 1;
+	}
+
+	g->nfirst = 0;
+	for (c = 0; c < NC; c++)
+		if (map[c]) {
+			g->firstch = c;
+			g->nfirst++;
+		}
+	if (g->nfirst == 0 || g->nfirst == NC) {
+		/* nothing to gain */
+		free(map);
+		g->nfirst = 0;
+		return;
+	}
+	g->firstmap = map;
 }
 
 /*
- - computematchjumps - compute match jumps for BM scan
- == static void computematchjumps(struct parse *p, struct re_guts *g);
- *
- * This algorithm assumes g->must exists and is has size greater than
- * zero. It's based on the algorithm found on Computer Algorithms by
- * Sara Baase.
+ - firstset - add the characters that can begin [start, stop) to map
+ == static int firstset(struct re_guts *g, sopno start, sopno stop, \
+ ==	uch *map);
  *
- * A match jump is the number of characters one needs to advance based
- * on the already-matched suffix.
- * Notice that all values here are minus (g->mlen-1), because of the way
- * the search algorithm works.
+ * Returns 0 if every match of the segment consumes a character first,
+ * 1 if the segment can match the empty string (so whatever follows it
+ * contributes too), and -1 if the characters can't be determined.
  */
-static void
-computematchjumps(p, g)
-struct parse *p;
+static int
+firstset(g, start, stop, map)
 struct re_guts *g;
+sopno start;
+sopno stop;
+uch *map;
 {
-	int mindex;		/* General "must" iterator */
-	int suffix;		/* Keeps track of matching suffix */
-	int ssuffix;		/* Keeps track of suffixes' suffix */
-	int* pmatches;		/* pmatches[k] points to the next i
-				 * such that i+1...mlen is a substring
-				 * of k+1...k+mlen-i-1
-				 */
-
-	/* Avoid making errors worse */
-	if (p->error != 0)
-		return;
-
-	pmatches = (int*) malloc(g->mlen * sizeof(unsigned int));
-	if (pmatches == NULL) {
-		g->matchjump = NULL;
-		return;
-	}
-
-	g->matchjump = (int*) malloc(g->mlen * sizeof(unsigned int));
-	if (g->matchjump == NULL)	/* Not a fatal error */
-		return;
-
-	/* Set maximum possible jump for each character in the pattern */
-	for (mindex = 0; mindex < g->mlen; mindex++)
-		g->matchjump[mindex] = 2*g->mlen - mindex - 1;
-
-	/* Compute pmatches[] */
-	for (mindex = g->mlen - 1, suffix = g->mlen; mindex >= 0;
-	    mindex--, suffix--) {
-		pmatches[mindex] = suffix;
+	sopno pc;
+	sopno ssub;		/* start of current branch */
+	sopno esub;		/* its OOR2 or the O_CH */
+	sop s;
+	cset *cs;
+	int c;
+	int r;
+	int nullable;
 
-		/* If a mismatch is found, interrupting the substring,
-		 * compute the matchjump for that position. If no
-		 * mismatch is found, then a text substring mismatched
-		 * against the suffix will also mismatch against the
-		 * substring.
-		 */
-		while (suffix < g->mlen
-		    && g->must[mindex] != g->must[suffix]) {
-			g->matchjump[suffix] = MIN(g->matchjump[suffix],
-			    g->mlen - mindex - 1);
-			suffix = pmatches[suffix];
+	pc = start;
+	while (pc < stop) {
+		s = g->strip[pc];
+		switch (OP(s)) {
+		case OCHAR:
+			map[(uch)OPND(s)] = 1;
+			return(0);
+		case OANYOF:
+			cs = &g->sets[OPND(s)];
+			if (cs->multis != NULL)
+				return(-1);
+			for (c = 0; c < g->csetsize; c++)
+				if (CHIN(cs, c))
+					map[c] = 1;
+			return(0);
+		case OBOL:
+		case OEOL:
+		case OBOW:
+		case OEOW:
+		case OLPAREN:
+		case ORPAREN:
+			pc++;
+			break;
+		case OPLUS_:
+			/* the body runs at least once */
+			r = firstset(g, pc+1, pc+OPND(s), map);
+			if (r != 1)
+				return(r);
+			pc += OPND(s) + 1;
+			break;
+		case OQUEST_:
+			/* the body may be skipped */
+			if (firstset(g, pc+1, pc+OPND(s), map) < 0)
+				return(-1);
+			pc += OPND(s) + 1;
+			break;
+		case OCH_:
+			nullable = 0;
+			ssub = pc + 1;
+			esub = pc + OPND(s);
+			for (;;) {
+				r = firstset(g, ssub, (OP(g->strip[esub]) == OOR2) ?
+							esub - 1 : esub, map);
+				if (r < 0)
+					return(-1);
+				nullable |= r;
+				if (OP(g->strip[esub]) == O_CH)
+					break;
+				assert(OP(g->strip[esub]) == OOR2);
+				ssub = esub + 1;
+				esub += OPND(g->strip[esub]);
+			}
+			if (!nullable)
+				return(0);
+			pc = esub + 1;
+			break;
+		default:		/* OANY, backrefs, ... */
+			return(-1);
 		}
 	}
-
-	/* Compute the matchjump up to the last substring found to jump
-	 * to the beginning of the largest must pattern prefix matching
-	 * it's own suffix.
-	 */
-	for (mindex = 0; mindex <= suffix; mindex++)
-		g->matchjump[mindex] = MIN(g->matchjump[mindex],
-		    g->mlen + suffix - mindex);
-
-        ssuffix = pmatches[suffix];
-        while (suffix < g->mlen) {
-                while (suffix <= ssuffix && suffix < g->mlen) {
-                        g->matchjump[suffix] = MIN(g->matchjump[suffix],
-			    g->mlen + ssuffix - suffix);
-                        suffix++;
-                }
-		if (suffix < g->mlen)
-                	ssuffix = pmatches[ssuffix];
-        }
-
-	free(pmatches);
+	return(1);
 }
 
 /*
@@ -158,9 +158,10 @@ struct re_guts {
 	cat_t *categories;	/* ->catspace[-CHAR_MIN] */
 	char *must;		/* match must contain this string */
 	int moffset;		/* latest point at which must may be located */
-	int *charjump;		/* Boyer-Moore char jump table */
-	int *matchjump;		/* Boyer-Moore match jump table */
 	int mlen;		/* length of must */
+	uch *firstmap;		/* -> uch[NC], chars that can begin a match */
+	int nfirst;		/* number of chars in firstmap */
+	int firstch;		/* the only one, if nfirst == 1 */
 	size_t nsub;		/* copy of re_nsub */
 	int backrefs;		/* does it use back references? */
 	sopno nplus;		/* how deep does it nest +s? */
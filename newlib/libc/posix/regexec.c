@@ -84,6 +84,10 @@ static int nope = 0;		/* for use in asserts; shuts lint up */
 #define	FWD(dst, src, n)	((dst) |= ((unsigned long)(src)&(here)) << (n))
 #define	BACK(dst, src, n)	((dst) |= ((unsigned long)(src)&(here)) >> (n))
 #define	ISSETBACK(v, n)	(((v) & ((unsigned long)here >> (n))) != 0)
+/* copying to and from the DFA state cache */
+#define	STATEBYTES(m)	sizeof(long)
+#define	SAVESTATE(k, v)	memcpy(k, &(v), sizeof(long))
+#define	LOADSTATE(v, k)	memcpy(&(v), k, sizeof(long))
 /* function names */
 #define SNAMES			/* engine.c looks after details */
 
@@ -108,6 +112,9 @@ static int nope = 0;		/* for use in asserts; shuts lint up */
 #undef	FWD
 #undef	BACK
 #undef	ISSETBACK
+#undef	STATEBYTES
+#undef	SAVESTATE
+#undef	LOADSTATE
 #undef	SNAMES
 
 /* macros for manipulating states, large version */
@@ -133,6 +140,10 @@ static int nope = 0;		/* for use in asserts; shuts lint up */
 #define	FWD(dst, src, n)	((dst)[here+(n)] |= (src)[here])
 #define	BACK(dst, src, n)	((dst)[here-(n)] |= (src)[here])
 #define	ISSETBACK(v, n)	((v)[here - (n)])
+/* copying to and from the DFA state cache */
+#define	STATEBYTES(m)	((size_t)(m)->g->nstates)
+#define	SAVESTATE(k, v)	memcpy(k, v, m->g->nstates)
+#define	LOADSTATE(v, k)	memcpy(v, k, m->g->nstates)
 /* function names */
 #define	LNAMES			/* flag */
 
@@ -148,6 +159,7 @@ static int nope = 0;		/* for use in asserts; shuts lint up */
  = #define	REG_TRACE	00400	// tracing of execution
  = #define	REG_LARGE	01000	// force large representation
  = #define	REG_BACKR	02000	// force use of backref code
+ = #define	REG_NODFA	04000	// don't use the lazy DFA
  *
  * We put this here so we can exploit knowledge of the state representation
  * when choosing which matcher to call.  Also, by this point the matchers
@@ -165,7 +177,7 @@ int eflags;
 #ifdef REDEBUG
 #	define	GOODFLAGS(f)	(f)
 #else
-#	define	GOODFLAGS(f)	((f)&(REG_NOTBOL|REG_NOTEOL|REG_STARTEND))
+#	define	GOODFLAGS(f)	((f)&(REG_NOTBOL|REG_NOTEOL|REG_STARTEND|REG_NODFA))
 #endif
 
 	if (preg->re_magic != MAGIC1 || g->magic != MAGIC2)
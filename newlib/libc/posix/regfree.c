@@ -76,10 +76,8 @@ regex_t *preg;
 		free((char *)g->setbits);
 	if (g->must != NULL)
 		free(g->must);
-	if (g->charjump != NULL)
-		free(&g->charjump[CHAR_MIN]);
-	if (g->matchjump != NULL)
-		free(g->matchjump);
+	if (g->firstmap != NULL)
+		free(g->firstmap);
 	free((char *)g);
 }
 
@@ -682,7 +682,8 @@ _VFPRINTF_R (struct _reent *data,
 	const char *grouping = NULL;
 #endif
 #ifdef FLOATING_POINT
-	char *decimal_point = _localeconv_r (data)->decimal_point;
+	char *decimal_point = __locale_is_C (LC_NUMERIC) ? (char *) "."
+			      : _localeconv_r (data)->decimal_point;
 	size_t decp_len = strlen (decimal_point);
 	char softsign;		/* temporary negative sign for floats */
 	union { int i; _PRINTF_FLOAT_TYPE fp; } _double_ = {0};
@@ -716,6 +717,7 @@ _VFPRINTF_R (struct _reent *data,
 #ifdef _MB_CAPABLE
 	wchar_t wc;
 	mbstate_t state;        /* mbtowc calls from library must not change state */
+	int c_ctype = __locale_is_C (LC_CTYPE); /* each byte is a character */
 #endif
 	char *malloc_buf = NULL;/* handy pointer for malloced buffers */
 
@@ -899,6 +901,12 @@ _VFPRINTF_R (struct _reent *data,
 	for (;;) {
 	        cp = fmt;
 #ifdef _MB_CAPABLE
+		if (c_ctype) {
+			while (*fmt != '\0' && *fmt != '%')
+				fmt += 1;
+			n = *fmt != '\0';
+		}
+		else
 	        while ((n = __MBTOWC (data, &wc, fmt, MB_CUR_MAX,
 				      &state)) != 0) {
 		    if (n < 0) {
@@ -948,6 +956,9 @@ rflag:		ch = *fmt++;
 reswitch:	switch (ch) {
 #ifdef _WANT_IO_C99_FORMATS
 		case '\'':
+			/* No grouping in the "C" locale. */
+			if (__locale_is_C (LC_NUMERIC))
+			  goto rflag;
 			thousands_sep = _localeconv_r (data)->thousands_sep;
 			thsnd_len = strlen (thousands_sep);
 			grouping = _localeconv_r (data)->grouping;
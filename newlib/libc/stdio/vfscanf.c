@@ -424,6 +424,7 @@ __SVFSCANF_R (struct _reent *rptr,
   size_t mbslen = 0;            /* length of converted multibyte sequence */
 #ifdef _MB_CAPABLE
   mbstate_t state;              /* value to keep track of multibyte state */
+  int c_ctype = __locale_is_C (LC_CTYPE); /* ASCII bytes are characters */
 #endif
 #ifdef _WANT_IO_C99_FORMATS
 #define _WANT_IO_POSIX_EXTENSIONS
@@ -601,8 +602,13 @@ __SVFSCANF_R (struct _reent *rptr,
 #ifndef _MB_CAPABLE
       wc = *fmt;
 #else
-      nbytes = __MBTOWC (rptr, &wc, (char *) fmt, MB_CUR_MAX, &state);
-      if (nbytes < 0) {
+      if (c_ctype && *fmt < 0x80)
+	{
+	  wc = *fmt;
+	  nbytes = 1;
+	}
+      else if ((nbytes = __MBTOWC (rptr, &wc, (char *) fmt, MB_CUR_MAX,
+				   &state)) < 0) {
 	wc = 0xFFFD; /* Unicode replacement character */
 	nbytes = 1;
 	memset (&state, 0, sizeof (state));
@@ -1550,7 +1556,8 @@ __SVFSCANF_R (struct _reent *rptr,
 	  unsigned width_left = 0;
 	  char nancount = 0;
 	  char infcount = 0;
-	  const char *decpt = _localeconv_r (rptr)->decimal_point;
+	  const char *decpt = __locale_is_C (LC_NUMERIC) ? "."
+			      : _localeconv_r (rptr)->decimal_point;
 #ifdef _MB_CAPABLE
 	  int decptpos = 0;
 #endif
@@ -0,0 +1,131 @@
+/* Helpers shared by the long double conversions in ldtoa.c and strtold.c.
+
+   A long double is handled as a significand of up to 128 bits, kept in two
+   64-bit words, and a binary exponent.  Products of 64-bit words are formed
+   with a 128-bit integer type where the compiler has one.  */
+
+#ifndef _LDCONV_H_
+#define _LDCONV_H_
+
+#include <stdint.h>
+#include <float.h>
+#include <ieeefp.h>
+
+#ifndef _LDBL_EQ_DBL
+
+/* Whether the leading bit of the significand is stored (x87 extended).  */
+#define LD_EXPLICIT_BIT	(LDBL_MANT_DIG == EXT_FRACBITS)
+
+/* Exponent of the least significant bit of a denormal.  */
+#define LD_EMIN		(1 - EXT_EXP_BIAS - (LDBL_MANT_DIG - 1))
+
+#define LD_FINITE	0
+#define LD_NAN		1
+#define LD_INFINITE	2
+
+/* Split X into its sign and, if it is finite, |X| = (*HI * 2^64 + *LO)
+   * 2^*E with the significand below 2^LDBL_MANT_DIG.  Return LD_FINITE,
+   LD_NAN or LD_INFINITE.  */
+static inline int
+__ld_unpack (long double x, int *sign, uint64_t *hi, uint64_t *lo, int *e)
+{
+  ieee_ext_u u;
+  int exp;
+
+  u.extu_ld = x;
+  *sign = u.extu_ext.ext_sign;
+  exp = u.extu_ext.ext_exp;
+#if EXT_FRACLBITS == 64
+  *hi = u.extu_ext.ext_frach;
+  *lo = u.extu_ext.ext_fracl;
+#else
+  *hi = 0;
+  *lo = (uint64_t) u.extu_ext.ext_frach << EXT_FRACLBITS
+	| u.extu_ext.ext_fracl;
+#endif
+  if (exp == EXT_EXP_INFNAN)
+    {
+#if LD_EXPLICIT_BIT
+      if ((*hi | *lo << 1) != 0)
+#else
+      if ((*hi | *lo) != 0)
+#endif
+	return LD_NAN;
+      return LD_INFINITE;
+    }
+  *e = LD_EMIN;
+  if (exp != 0)
+    {
+#if !LD_EXPLICIT_BIT
+# if EXT_FRACBITS >= 64
+      *hi |= (uint64_t) 1 << (EXT_FRACBITS - 64);
+# else
+      *lo |= (uint64_t) 1 << EXT_FRACBITS;
+# endif
+#endif
+      *e += exp - 1;
+    }
+  return LD_FINITE;
+}
+
+/* Return the long double with the given SIGN and the significand HI:LO,
+   which has its leading bit set, times 2^(EXP - LDBL_MANT_DIG + 1).  EXP
+   must be in the normal range.  */
+static inline long double
+__ld_pack (int sign, uint64_t hi, uint64_t lo, int exp)
+{
+  ieee_ext_u u;
+
+  u.extu_ext.ext_sign = sign;
+  u.extu_ext.ext_exp = exp + EXT_EXP_BIAS;
+#if EXT_FRACLBITS == 64
+  u.extu_ext.ext_fracl = lo;
+  u.extu_ext.ext_frach = hi;
+#else
+  u.extu_ext.ext_fracl = lo;
+  u.extu_ext.ext_frach = lo >> EXT_FRACLBITS;
+#endif
+  return u.extu_ld;
+}
+
+#endif /* !_LDBL_EQ_DBL */
+
+/* Return the high half of X * Y and store the low half in *LO.  */
+static inline uint64_t
+__mul_64x64 (uint64_t x, uint64_t y, uint64_t *lo)
+{
+#ifdef __SIZEOF_INT128__
+  unsigned __int128 p = (unsigned __int128) x * y;
+
+  *lo = (uint64_t) p;
+  return p >> 64;
+#else
+  uint64_t x0 = x & 0xffffffff, x1 = x >> 32;
+  uint64_t y0 = y & 0xffffffff, y1 = y >> 32;
+  uint64_t p00 = x0 * y0, p01 = x0 * y1, p10 = x1 * y0, p11 = x1 * y1;
+  uint64_t mid = (p00 >> 32) + (p01 & 0xffffffff) + (p10 & 0xffffffff);
+
+  *lo = mid << 32 | (p00 & 0xffffffff);
+  return p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+#endif
+}
+
+/* Number of leading zero bits of the non-zero X.  */
+static inline int
+__clz_64 (uint64_t x)
+{
+#ifdef __GNUC__
+  return __builtin_clzll (x);
+#else
+  int n = 0;
+
+  while (!(x & 0x8000000000000000ULL))
+    {
+      x <<= 1;
+      n++;
+    }
+  return n;
+#endif
+}
+
+#endif /* _LDCONV_H_ */
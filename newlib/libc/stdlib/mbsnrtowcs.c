@@ -68,7 +68,98 @@ PORTABILITY
 #include <wchar.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <errno.h>
+#include "local.h"
+
+#if !defined(PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__) \
+    && defined(_MB_CAPABLE)
+#define UTF8_FAST
+
+#define ONES     ((unsigned long) -1 / 0xff)
+#define HIGHBITS (ONES * 0x80)
+
+/* Convert the longest prefix of S made of complete UTF-8 characters other
+   than NUL which __utf8_mbtowc accepts, reading at most NMS bytes and
+   producing at most LEN wide characters, stored into DST unless it is
+   NULL.  Runs of ASCII are handled a word at a time.  Returns the number
+   of bytes used and stores the number of wide characters into *COUNT.  */
+static size_t
+utf8_run (wchar_t *dst,
+	const unsigned char *s,
+	size_t nms,
+	size_t len,
+	size_t *count)
+{
+  const unsigned char *p = s;
+  const unsigned char *end = s + nms;
+  size_t n = 0;
+  unsigned long w;
+  wint_t wc;
+  int ch, l, i;
+
+  while (n < len && p < end)
+    {
+      ch = *p;
+      if (ch >= 0x01 && ch <= 0x7f)
+	{
+	  if (len - n >= sizeof (w) && (size_t) (end - p) >= sizeof (w))
+	    {
+	      /* Bytes 0x01 to 0x7f have neither their own high bit set nor
+		 the one of their value minus one.  */
+	      memcpy (&w, p, sizeof (w));
+	      if (((w | (w - ONES)) & HIGHBITS) == 0)
+		{
+		  if (dst != NULL)
+		    for (i = 0; i < (int) sizeof (w); i++)
+		      dst[n + i] = p[i];
+		  p += sizeof (w);
+		  n += sizeof (w);
+		  continue;
+		}
+	    }
+	  wc = ch;
+	  l = 1;
+	}
+      else if (ch >= 0xc2 && ch <= 0xdf)
+	{
+	  if (end - p < 2 || (p[1] & 0xc0) != 0x80)
+	    break;
+	  wc = ((ch & 0x1f) << 6) | (p[1] & 0x3f);
+	  l = 2;
+	}
+      else if (ch >= 0xe0 && ch <= 0xef)
+	{
+	  if (end - p < 3 || (p[1] & 0xc0) != 0x80 || (p[2] & 0xc0) != 0x80
+	      || (ch == 0xe0 && p[1] < 0xa0))
+	    break;
+	  wc = ((ch & 0x0f) << 12) | ((p[1] & 0x3f) << 6) | (p[2] & 0x3f);
+	  l = 3;
+	}
+      else if (ch >= 0xf0 && ch <= 0xf4 && sizeof (wchar_t) > 2)
+	{
+	  /* UTF-16 wchar_t needs the surrogate pair state of __utf8_mbtowc */
+	  if (end - p < 4 || (p[1] & 0xc0) != 0x80 || (p[2] & 0xc0) != 0x80
+	      || (p[3] & 0xc0) != 0x80
+	      || (ch == 0xf0 && p[1] < 0x90) || (ch == 0xf4 && p[1] >= 0x90))
+	    break;
+	  wc = ((wint_t) (ch & 0x07) << 18) | ((wint_t) (p[1] & 0x3f) << 12)
+	       | ((p[2] & 0x3f) << 6) | (p[3] & 0x3f);
+	  l = 4;
+	}
+      else
+	break;
+
+      if (dst != NULL)
+	dst[n] = (wchar_t) wc;
+      n++;
+      p += l;
+    }
+
+  *count = n;
+  return p - s;
+}
+#endif /* UTF8_FAST */
 
 size_t
 _mbsnrtowcs_r (struct _reent *r,
@@ -83,6 +174,9 @@ _mbsnrtowcs_r (struct _reent *r,
   size_t max;
   size_t count = 0;
   int bytes;
+#ifdef UTF8_FAST
+  int utf8 = __MBTOWC == __utf8_mbtowc;
+#endif
 
 #ifdef _MB_CAPABLE
   if (ps == NULL)
@@ -104,6 +198,22 @@ _mbsnrtowcs_r (struct _reent *r,
   max = len;
   while (len > 0)
     {
+#ifdef UTF8_FAST
+      if (utf8 && ps->__count == 0)
+	{
+	  size_t used, done;
+
+	  used = utf8_run (ptr, (const unsigned char *) *src, nms, len, &done);
+	  *src += used;
+	  nms -= used;
+	  count += done;
+	  len -= done;
+	  if (dst != NULL)
+	    ptr += done;
+	  if (len == 0)
+	    break;
+	}
+#endif
       bytes = _mbrtowc_r (r, ptr, *src, nms, ps);
       if (bytes > 0)
 	{
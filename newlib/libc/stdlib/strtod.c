@@ -263,7 +263,8 @@ _strtod_l (struct _reent *ptr, const char *__restrict s00, char **__restrict se,
 #ifdef Honor_FLT_ROUNDS
 	int rounding;
 #endif
-	const char *decimal_point = __get_numeric_locale(loc)->decimal_point;
+	const char *decimal_point = __locale_is_C_l (loc, LC_NUMERIC) ? "."
+				    : __get_numeric_locale(loc)->decimal_point;
 	int dec_len = strlen (decimal_point);
 
 	delta = bs = bd = NULL;
@@ -344,7 +345,8 @@ _strtod_l (struct _reent *ptr, const char *__restrict s00, char **__restrict se,
 		else
 			z = 10*z + c - '0';
 	nd0 = nd;
-	if (strncmp (s, decimal_point, dec_len) == 0)
+	if (*s == *decimal_point
+	    && (dec_len == 1 || strncmp (s, decimal_point, dec_len) == 0))
 		{
 		decpt = 1;
 		c = *(s += dec_len);
@@ -159,6 +159,22 @@ trailz (_Bigint *b)
 	return n;
 	}
 
+/* Is b a power of two?  Unlike the bits counted by rvbits, this
+ * does not depend on how b is normalized.
+ */
+static int
+pow2 (_Bigint *b)
+{
+	__ULong *x, *xe;
+
+	x = b->_x;
+	xe = x + b->_wds - 1;
+	for(; x < xe; x++)
+		if (*x)
+			return 0;
+	return *x && !(*x & (*x - 1));
+	}
+
 _Bigint *
 increment (struct _reent *p, _Bigint *b)
 {
@@ -428,7 +444,8 @@ _strtodg_l (struct _reent *p, const char *s00, char **se, FPI *fpi, Long *exp,
 	Long L;
 	__ULong y, z;
 	_Bigint *ab, *bb, *bb1, *bd, *bd0, *bs, *delta, *rvb, *rvb0;
-	const char *decimal_point = __get_numeric_locale(loc)->decimal_point;
+	const char *decimal_point = __locale_is_C_l (loc, LC_NUMERIC) ? "."
+				    : __get_numeric_locale(loc)->decimal_point;
 	int dec_len = strlen (decimal_point);
 
 	irv = STRTOG_Zero;
@@ -488,7 +505,8 @@ _strtodg_l (struct _reent *p, const char *s00, char **se, FPI *fpi, Long *exp,
 			z = 10*z + c - '0';
 	nd0 = nd;
 #ifdef USE_LOCALE
-	if (strncmp (s, decimal_point, dec_len) == 0)
+	if (*s == *decimal_point
+	    && (dec_len == 1 || strncmp (s, decimal_point, dec_len) == 0))
 #else
 	if (c == '.')
 #endif
@@ -770,6 +788,15 @@ _strtodg_l (struct _reent *p, const char *s00, char **se, FPI *fpi, Long *exp,
 					rvb->_x[0] = 0;
 					*exp = emin;
 					irv = STRTOG_Underflow | STRTOG_Inexlo;
+					if (rd == 2 && !sudden_underflow) {
+						/* Rounding away from zero gives
+						 * the smallest denormal.
+						 */
+						rvb->_wds = rvb->_x[0] = 1;
+						irv = STRTOG_Denormal
+							| STRTOG_Underflow
+							| STRTOG_Inexhi;
+						}
 #ifndef NO_ERRNO
 					errno = ERANGE;
 #endif
@@ -861,19 +888,20 @@ _strtodg_l (struct _reent *p, const char *s00, char **se, FPI *fpi, Long *exp,
 					goto adj1;
 					}
 				irv |= STRTOG_Inexlo;
-				if (rve1 == emin)
-					goto adj1;
-				for(i = 0, j = nbits; j >= ULbits;
-						i++, j -= ULbits) {
-					if (rvb->_x[i] & ALL_ON)
-						goto adj1;
-					}
-				if (j > 1 && lo0bits(rvb->_x + i) < j - 1)
+				if (rve1 == emin || !pow2(rvb))
 					goto adj1;
 				rve = rve1 - 1;
 				rvb = set_ones(p, rvb, rvbits = nbits);
 				break;
 				}
+			if (!dsign && i == 0 && rve1 != emin && pow2(rvb)) {
+				/* rv is a power of two and the value is the
+				 * representable number just below it.
+				 */
+				rve = rve1 - 1;
+				rvb = set_ones(p, rvb, rvbits = nbits);
+				break;
+				}
 			irv |= dsign ? STRTOG_Inexlo : STRTOG_Inexhi;
 			break;
 			}
@@ -917,7 +945,10 @@ _strtodg_l (struct _reent *p, const char *s00, char **se, FPI *fpi, Long *exp,
 						sudden_underflow = 1;
 					break;
 					}
-				rve -= nbits;
+				/* rvb is a power of two, but need not be a
+				 * single bit: after an adjustment it has nbits.
+				 */
+				rve = rve1 - 1;
 				rvb = set_ones(p, rvb, rvbits = nbits);
 				break;
 				}
@@ -952,6 +983,12 @@ _strtodg_l (struct _reent *p, const char *s00, char **se, FPI *fpi, Long *exp,
 				rvb->_wds = 0;
 				rve = emin;
 				irv = STRTOG_Underflow | STRTOG_Inexlo;
+				if (rd == 2) {
+					rvb->_wds = rvb->_x[0] = 1;
+					irv = STRTOG_Denormal
+						| STRTOG_Underflow
+						| STRTOG_Inexhi;
+					}
 #ifndef NO_ERRNO
 				errno = ERANGE;
 #endif
@@ -1049,7 +1086,8 @@ _strtodg_l (struct _reent *p, const char *s00, char **se, FPI *fpi, Long *exp,
 			break;
 
 		z = rve + rvbits;
-		if (y == z && L) {
+		/* Not below a power of two, where the ulp halves. */
+		if (y == z && L && !(asub && pow2(rvb))) {
 			/* Can we stop now? */
 			tol = dval(adj) * 5e-16; /* > max rel error */
 			dval(adj) = adj0 - .5;
@@ -1090,6 +1128,15 @@ _strtodg_l (struct _reent *p, const char *s00, char **se, FPI *fpi, Long *exp,
 #ifndef NO_ERRNO
 		errno = ERANGE;
 #endif
+		if (rd == 1) {
+			/* Rounding toward zero gives the largest
+			 * finite number.
+			 */
+			rvb = set_ones(p, rvb, rvbits = nbits);
+			*exp = fpi->emax;
+			irv = STRTOG_Normal | STRTOG_Overflow | STRTOG_Inexlo;
+			goto ret;
+			}
  infnanexp:
 		*exp = fpi->emax + 1;
 		}
@@ -29,8 +29,14 @@ POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
 #include "local.h"
 #include "mprec.h"
+#include "gdtoa.h"
+#include "ldconv.h"
+#include "../locale/setlocale.h"
 #undef FLT_ROUNDS
 
 #ifdef _HAVE_LONG_DOUBLE
@@ -55,51 +61,462 @@ __flt_rounds(void)
 }
 #define FLT_ROUNDS __flt_rounds()
 #else
-#define FLT_ROUNDS 0
+#define FLT_ROUNDS FPI_Round_near
 #endif
 
-long double
-_strtold_r (struct _reent *ptr, const char *__restrict s00,
-	    char **__restrict se)
-{
-#ifdef _LDBL_EQ_DBL
-  /* On platforms where long double is as wide as double.  */
-  return _strtod_l (ptr, s00, se, __get_current_locale ());
+#if !defined (_LDBL_EQ_DBL) && (LDBL_MANT_DIG == 64 || LDBL_MANT_DIG == 113)
+
+/* Decimal to long double conversion.
+
+   Up to 38 significant digits are collected into a 128-bit integer M, and
+   the value M * 10^E is approximated from below by a 128-bit product with
+   a 128-bit power of ten, which is within LD_ERR units of its last bit of
+   the exact value.  This decides the correctly rounded result unless the
+   discarded bits are within LD_ERR of a rounding boundary, or the result
+   is not normal.  Those rare inputs, hexadecimal numbers, infinities and
+   NaNs are left to the exact gdtoa conversion.  Small integers times
+   exact powers of ten are converted with one long double operation, and
+   decimal exponents far outside the range overflow or underflow at once,
+   in the direction of the current rounding mode.  */
+
+#define LD_ERR		128
+
+/* Powers of ten up to 10^LD_EXACT_POW are exact long doubles, and values
+   below 10^LD_TINY_10_EXP are less than half the smallest denormal.  */
+#if LDBL_MANT_DIG == 64
+# define LD_EXACT_POW	27
+# define LD_TINY_10_EXP	(-4951)
 #else
-  long double result;
+# define LD_EXACT_POW	48
+# define LD_TINY_10_EXP	(-4966)
+#endif
 
-  _strtorx_l (ptr, s00, se, FLT_ROUNDS, &result, __get_current_locale ());
-  return result;
+/* 10^K is (HI * 2^64 + LO) * 2^E, rounded down.  */
+struct ld_pow10
+{
+  uint64_t hi, lo;
+  int e;
+};
+
+static const struct ld_pow10 pow10_small[32] = {
+  { 0x8000000000000000ULL, 0x0000000000000000ULL, -127 },	/* 1e0 */
+  { 0xa000000000000000ULL, 0x0000000000000000ULL, -124 },	/* 1e1 */
+  { 0xc800000000000000ULL, 0x0000000000000000ULL, -121 },	/* 1e2 */
+  { 0xfa00000000000000ULL, 0x0000000000000000ULL, -118 },	/* 1e3 */
+  { 0x9c40000000000000ULL, 0x0000000000000000ULL, -114 },	/* 1e4 */
+  { 0xc350000000000000ULL, 0x0000000000000000ULL, -111 },	/* 1e5 */
+  { 0xf424000000000000ULL, 0x0000000000000000ULL, -108 },	/* 1e6 */
+  { 0x9896800000000000ULL, 0x0000000000000000ULL, -104 },	/* 1e7 */
+  { 0xbebc200000000000ULL, 0x0000000000000000ULL, -101 },	/* 1e8 */
+  { 0xee6b280000000000ULL, 0x0000000000000000ULL, -98 },	/* 1e9 */
+  { 0x9502f90000000000ULL, 0x0000000000000000ULL, -94 },	/* 1e10 */
+  { 0xba43b74000000000ULL, 0x0000000000000000ULL, -91 },	/* 1e11 */
+  { 0xe8d4a51000000000ULL, 0x0000000000000000ULL, -88 },	/* 1e12 */
+  { 0x9184e72a00000000ULL, 0x0000000000000000ULL, -84 },	/* 1e13 */
+  { 0xb5e620f480000000ULL, 0x0000000000000000ULL, -81 },	/* 1e14 */
+  { 0xe35fa931a0000000ULL, 0x0000000000000000ULL, -78 },	/* 1e15 */
+  { 0x8e1bc9bf04000000ULL, 0x0000000000000000ULL, -74 },	/* 1e16 */
+  { 0xb1a2bc2ec5000000ULL, 0x0000000000000000ULL, -71 },	/* 1e17 */
+  { 0xde0b6b3a76400000ULL, 0x0000000000000000ULL, -68 },	/* 1e18 */
+  { 0x8ac7230489e80000ULL, 0x0000000000000000ULL, -64 },	/* 1e19 */
+  { 0xad78ebc5ac620000ULL, 0x0000000000000000ULL, -61 },	/* 1e20 */
+  { 0xd8d726b7177a8000ULL, 0x0000000000000000ULL, -58 },	/* 1e21 */
+  { 0x878678326eac9000ULL, 0x0000000000000000ULL, -54 },	/* 1e22 */
+  { 0xa968163f0a57b400ULL, 0x0000000000000000ULL, -51 },	/* 1e23 */
+  { 0xd3c21bcecceda100ULL, 0x0000000000000000ULL, -48 },	/* 1e24 */
+  { 0x84595161401484a0ULL, 0x0000000000000000ULL, -44 },	/* 1e25 */
+  { 0xa56fa5b99019a5c8ULL, 0x0000000000000000ULL, -41 },	/* 1e26 */
+  { 0xcecb8f27f4200f3aULL, 0x0000000000000000ULL, -38 },	/* 1e27 */
+  { 0x813f3978f8940984ULL, 0x4000000000000000ULL, -34 },	/* 1e28 */
+  { 0xa18f07d736b90be5ULL, 0x5000000000000000ULL, -31 },	/* 1e29 */
+  { 0xc9f2c9cd04674edeULL, 0xa400000000000000ULL, -28 },	/* 1e30 */
+  { 0xfc6f7c4045812296ULL, 0x4d00000000000000ULL, -25 }	/* 1e31 */
+};
+
+static const struct ld_pow10 pow10_pos[8] = {
+  { 0x9dc5ada82b70b59dULL, 0xf020000000000000ULL, -21 },	/* 1e32 */
+  { 0xc2781f49ffcfa6d5ULL, 0x3cbf6b71c76b25fbULL, 85 },	/* 1e64 */
+  { 0x93ba47c980e98cdfULL, 0xc66f336c36b10137ULL, 298 },	/* 1e128 */
+  { 0xaa7eebfb9df9de8dULL, 0xddbb901b98feeab7ULL, 723 },	/* 1e256 */
+  { 0xe319a0aea60e91c6ULL, 0xcc655c54bc5058f8ULL, 1573 },	/* 1e512 */
+  { 0xc976758681750c17ULL, 0x650d3d28f18b50ceULL, 3274 },	/* 1e1024 */
+  { 0x9e8b3b5dc53d5de4ULL, 0xa74d28ce329ace52ULL, 6676 },	/* 1e2048 */
+  { 0xc46052028a20979aULL, 0xc94c153f804a4a92ULL, 13479 }	/* 1e4096 */
+};
+
+static const struct ld_pow10 pow10_neg[8] = {
+  { 0xcfb11ead453994baULL, 0x67de18eda5814af2ULL, -234 },	/* 1e-32 */
+  { 0xa87fea27a539e9a5ULL, 0x3f2398d747b36224ULL, -340 },	/* 1e-64 */
+  { 0xddd0467c64bce4a0ULL, 0xac7cb3f6d05ddbdeULL, -553 },	/* 1e-128 */
+  { 0xc0314325637a1939ULL, 0xfa911155fefb5308ULL, -978 },	/* 1e-256 */
+  { 0x9049ee32db23d21cULL, 0x7132d332e3f204d4ULL, -1828 },	/* 1e-512 */
+  { 0xa2a682a5da57c0bdULL, 0x87a601586bd3f698ULL, -3529 },	/* 1e-1024 */
+  { 0xceae534f34362de4ULL, 0x492512d4f2ead2cbULL, -6931 },	/* 1e-2048 */
+  { 0xa6dd04c8d2ce9fdeULL, 0x2de38123a1c3cffcULL, -13734 }	/* 1e-4096 */
+};
+
+static const uint64_t pow10_64[20] = {
+  1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+  10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+  100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+  100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+  100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+};
+
+static const long double pow10_ld[LD_EXACT_POW + 1] = {
+  1e0L, 1e1L, 1e2L, 1e3L, 1e4L, 1e5L, 1e6L, 1e7L, 1e8L, 1e9L,
+  1e10L, 1e11L, 1e12L, 1e13L, 1e14L, 1e15L, 1e16L, 1e17L, 1e18L, 1e19L,
+  1e20L, 1e21L, 1e22L, 1e23L, 1e24L, 1e25L, 1e26L, 1e27L
+#if LD_EXACT_POW > 27
+  , 1e28L, 1e29L, 1e30L, 1e31L, 1e32L, 1e33L, 1e34L, 1e35L, 1e36L, 1e37L,
+  1e38L, 1e39L, 1e40L, 1e41L, 1e42L, 1e43L, 1e44L, 1e45L, 1e46L, 1e47L,
+  1e48L
 #endif
+};
+
+/* Store the 256-bit product of A1:A0 and B1:B0 to R[3]:R[2]:R[1]:R[0].  */
+static void
+mul_128x128 (uint64_t a1, uint64_t a0, uint64_t b1, uint64_t b0, uint64_t *r)
+{
+  uint64_t x0, x1, y0, y1, z0, z1, w0, w1, t, c;
+
+  x1 = __mul_64x64 (a0, b0, &x0);
+  y1 = __mul_64x64 (a0, b1, &y0);
+  z1 = __mul_64x64 (a1, b0, &z0);
+  w1 = __mul_64x64 (a1, b1, &w0);
+  r[0] = x0;
+  t = x1 + y0;
+  c = t < y0;
+  t += z0;
+  c += t < z0;
+  r[1] = t;
+  t = w0 + c;
+  c = t < c;
+  t += y1;
+  c += t < y1;
+  t += z1;
+  c += t < z1;
+  r[2] = t;
+  r[3] = w1 + c;
 }
 
-long double
-strtold_l (const char *__restrict s00, char **__restrict se, locale_t loc)
+/* Set *HI:*LO with its top bit set and *E so that *HI:*LO * 2^*E is at
+   most 10^K, and within 2 * popcount (K / 32) units of the last bit.
+   Return whether it is exact.  */
+static int
+pow10_128 (int k, uint64_t *hi, uint64_t *lo, int *e)
+{
+  const struct ld_pow10 *big;
+  uint64_t r[4];
+  int q, j, exact;
+
+  if (k >= 0)
+    {
+      q = k >> 5;
+      k -= q << 5;
+      big = pow10_pos;
+    }
+  else
+    {
+      q = (-k + 31) >> 5;
+      k += q << 5;
+      big = pow10_neg;
+    }
+  *hi = pow10_small[k].hi;
+  *lo = pow10_small[k].lo;
+  *e = pow10_small[k].e;
+  exact = big == pow10_pos && q <= 1;
+  for (j = 0; q != 0; j++, q >>= 1)
+    if (q & 1)
+      {
+	mul_128x128 (*hi, *lo, big[j].hi, big[j].lo, r);
+	*e += big[j].e + 128;
+	if (!(r[3] >> 63))
+	  {
+	    r[3] = r[3] << 1 | r[2] >> 63;
+	    r[2] = r[2] << 1 | r[1] >> 63;
+	    r[1] <<= 1;
+	    *e -= 1;
+	  }
+	exact &= (r[1] | r[0]) == 0;
+	*hi = r[3];
+	*lo = r[2];
+      }
+  return exact;
+}
+
+static long double
+strtold_slow (struct _reent *ptr, const char *s00, char **se, int rounding,
+	      locale_t loc)
 {
-#ifdef _LDBL_EQ_DBL
-  /* On platforms where long double is as wide as double.  */
-  return _strtod_l (_REENT, s00, se, loc);
-#else
   long double result;
 
-  _strtorx_l (_REENT, s00, se, FLT_ROUNDS, &result, loc);
-  return result;
+#if LDBL_MANT_DIG == 64
+  _strtorx_l (ptr, s00, se, rounding, &result, loc);
+#else
+  _strtorQ_l (ptr, s00, se, rounding, &result, loc);
 #endif
+  return result;
 }
 
-long double
-strtold (const char *__restrict s00, char **__restrict se)
+static long double
+strtold_overflow (struct _reent *ptr, int sign, int rounding)
+{
+  ptr->_errno = ERANGE;
+  if (rounding == FPI_Round_near
+      || rounding == (sign ? FPI_Round_down : FPI_Round_up))
+    return sign ? -HUGE_VALL : HUGE_VALL;
+  return sign ? -LDBL_MAX : LDBL_MAX;
+}
+
+static long double
+strtold_fast (struct _reent *ptr, const char *__restrict s00,
+	      char **__restrict se, locale_t loc)
 {
-#ifdef _LDBL_EQ_DBL
-  /* On platforms where long double is as wide as double.  */
-  return _strtod_l (_REENT, s00, se, __get_current_locale ());
+  const char *decimal_point = __locale_is_C_l (loc, LC_NUMERIC) ? "."
+			      : __get_numeric_locale (loc)->decimal_point;
+  const char *s = s00, *t;
+  uint64_t a = 0, b = 0, hi, lo, ph, pl, mh, ml, rest, half, r[4];
+  int sign = 0, any = 0, trunc = 0, nd = 0, nb = 0, dexp = 0, exp = 0;
+  int dec_len, esign, n, e, pexact, exact, err, up, rounding, c;
+
+  rounding = FLT_ROUNDS;
+  while (*s == ' ' || (*s >= '\t' && *s <= '\r'))
+    s++;
+  if (*s == '-')
+    {
+      sign = 1;
+      s++;
+    }
+  else if (*s == '+')
+    s++;
+  if (*s == '0' && (s[1] == 'x' || s[1] == 'X'))
+    return strtold_slow (ptr, s00, se, rounding, loc);
+
+  /* Collect the significant digits into A (the first 19) and B (the next
+     19), and count the digits dropped after them in DEXP.  */
+  for (; (c = *s - '0') >= 0 && c <= 9; s++)
+    {
+      any = 1;
+      if (nd < 19)
+	{
+	  a = a * 10 + c;
+	  nd += nd > 0 || c > 0;
+	}
+      else if (nd < 38)
+	{
+	  b = b * 10 + c;
+	  nb++;
+	  nd++;
+	}
+      else
+	{
+	  trunc |= c;
+	  dexp++;
+	}
+    }
+  dec_len = strlen (decimal_point);
+  if (*s == *decimal_point
+      && (dec_len == 1 || strncmp (s, decimal_point, dec_len) == 0))
+    for (s += dec_len; (c = *s - '0') >= 0 && c <= 9; s++)
+      {
+	any = 1;
+	if (nd < 19)
+	  {
+	    a = a * 10 + c;
+	    nd += nd > 0 || c > 0;
+	    dexp--;
+	  }
+	else if (nd < 38)
+	  {
+	    b = b * 10 + c;
+	    nb++;
+	    nd++;
+	    dexp--;
+	  }
+	else
+	  trunc |= c;
+      }
+  if (!any)
+    return strtold_slow (ptr, s00, se, rounding, loc);
+
+  if (*s == 'e' || *s == 'E')
+    {
+      t = s + 1;
+      esign = 0;
+      if (*t == '-')
+	{
+	  esign = 1;
+	  t++;
+	}
+      else if (*t == '+')
+	t++;
+      if (*t >= '0' && *t <= '9')
+	{
+	  for (; *t >= '0' && *t <= '9'; t++)
+	    if (exp < 100000)
+	      exp = exp * 10 + *t - '0';
+	  if (esign)
+	    exp = -exp;
+	  s = t;
+	}
+    }
+  if (se)
+    *se = (char *) s;
+
+  if ((a | b) == 0)
+    return sign ? -0.0L : 0.0L;
+  e = dexp + exp;
+  if (e + nd > LDBL_MAX_10_EXP + 1)
+    return strtold_overflow (ptr, sign, rounding);
+  if (e + nd <= LD_TINY_10_EXP)
+    {
+      ptr->_errno = ERANGE;
+      if (rounding == (sign ? FPI_Round_down : FPI_Round_up))
+	return sign ? -LDBL_MIN * LDBL_EPSILON : LDBL_MIN * LDBL_EPSILON;
+      return sign ? -0.0L : 0.0L;
+    }
+  if (e + nd < LDBL_MIN_10_EXP)
+    return strtold_slow (ptr, s00, se, rounding, loc);
+
+  /* M = A * 10^NB + B.  */
+  hi = __mul_64x64 (a, pow10_64[nb], &lo);
+  lo += b;
+  hi += lo < b;
+
+  if (hi == 0 && !trunc && e >= -LD_EXACT_POW && e <= LD_EXACT_POW)
+    {
+      long double x = sign ? -(long double) lo : (long double) lo;
+
+      return e < 0 ? x / pow10_ld[-e] : x * pow10_ld[e];
+    }
+
+  n = hi ? __clz_64 (hi) : 64 + __clz_64 (lo);
+  if (n >= 64)
+    {
+      hi = lo << (n - 64);
+      lo = 0;
+    }
+  else if (n > 0)
+    {
+      hi = hi << n | lo >> (64 - n);
+      lo <<= n;
+    }
+  pexact = pow10_128 (e, &ph, &pl, &e);
+  mul_128x128 (hi, lo, ph, pl, r);
+  e += 128 - n;
+  if (!(r[3] >> 63))
+    {
+      r[3] = r[3] << 1 | r[2] >> 63;
+      r[2] = r[2] << 1 | r[1] >> 63;
+      r[1] <<= 1;
+      e--;
+    }
+  exact = pexact && !trunc && (r[1] | r[0]) == 0;
+  err = exact ? 0 : LD_ERR;
+
+  /* The value is R[3]:R[2] * 2^E.  Split it into the significand MH:ML
+     and the REST below it.  */
+#if LDBL_MANT_DIG == 64
+  mh = 0;
+  ml = r[3];
+  rest = r[2];
+  half = 0x8000000000000000ULL;
 #else
+  mh = r[3] >> 15;
+  ml = r[3] << 49 | r[2] >> 15;
+  rest = r[2] & 0x7fff;
+  half = 0x4000;
+#endif
+  e += 127;
+
+  /* A rest more than ERR below the next unit cannot carry into it.  */
+  if (rest > 2 * half - 1 - err)
+    return strtold_slow (ptr, s00, se, rounding, loc);
+  if (rounding == FPI_Round_near)
+    {
+      if (rest < half - err)
+	up = 0;
+      else if (rest > half)
+	up = 1;
+      else if (exact && rest == half)
+	up = ml & 1;
+      else
+	return strtold_slow (ptr, s00, se, rounding, loc);
+    }
+  else if (rounding == FPI_Round_zero
+	   || rounding == (sign ? FPI_Round_up : FPI_Round_down))
+    up = 0;
+  else if (rest != 0)
+    up = 1;
+  else if (exact)
+    up = 0;
+  else
+    return strtold_slow (ptr, s00, se, rounding, loc);
+
+  if (up)
+    {
+#if LDBL_MANT_DIG == 64
+      if (++ml == 0)
+	{
+	  ml = 0x8000000000000000ULL;
+	  e++;
+	}
+#else
+      if (++ml == 0 && ++mh >> 49)
+	{
+	  mh >>= 1;
+	  e++;
+	}
+#endif
+    }
+  if (e > EXT_EXP_BIAS)
+    return strtold_overflow (ptr, sign, rounding);
+  if (e < 1 - EXT_EXP_BIAS)
+    return strtold_slow (ptr, s00, se, rounding, loc);
+  return __ld_pack (sign, mh, ml, e);
+}
+
+#define STRTOLD(ptr, s00, se, loc) strtold_fast (ptr, s00, se, loc)
+
+#elif !defined (_LDBL_EQ_DBL)
+
+static long double
+strtold_rx (struct _reent *ptr, const char *__restrict s00,
+	    char **__restrict se, locale_t loc)
+{
   long double result;
 
-  _strtorx_l (_REENT, s00, se, FLT_ROUNDS, &result, __get_current_locale ());
+  _strtorx_l (ptr, s00, se, FLT_ROUNDS, &result, loc);
   return result;
+}
+
+#define STRTOLD(ptr, s00, se, loc) strtold_rx (ptr, s00, se, loc)
+
+#else
+
+/* On platforms where long double is as wide as double.  */
+#define STRTOLD(ptr, s00, se, loc) _strtod_l (ptr, s00, se, loc)
+
 #endif
+
+long double
+_strtold_r (struct _reent *ptr, const char *__restrict s00,
+	    char **__restrict se)
+{
+  return STRTOLD (ptr, s00, se, __get_current_locale ());
 }
 
-#endif /* _HAVE_LONG_DOUBLE */
+long double
+strtold_l (const char *__restrict s00, char **__restrict se, locale_t loc)
+{
+  return STRTOLD (_REENT, s00, se, loc);
+}
+
+long double
+strtold (const char *__restrict s00, char **__restrict se)
+{
+  return STRTOLD (_REENT, s00, se, __get_current_locale ());
+}
 
+#endif /* _HAVE_LONG_DOUBLE */
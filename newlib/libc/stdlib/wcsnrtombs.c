@@ -72,6 +72,102 @@ PORTABILITY
 #include "local.h"
 #include "../locale/setlocale.h"
 
+#if !defined(PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__) \
+    && defined(_MB_CAPABLE)
+#define UTF8_FAST
+
+/* Convert the longest prefix of S made of wide characters other than NUL
+   which __utf8_wctomb converts without keeping state, reading at most NWC
+   of them and producing at most LEN bytes, stored into DST unless it is
+   NULL.  Runs of ASCII are checked eight characters at a time.  Returns
+   the number of wide characters used and stores the number of bytes into
+   *COUNT.  */
+static size_t
+utf8_run (char *dst,
+	const wchar_t *s,
+	size_t nwc,
+	size_t len,
+	size_t *count)
+{
+  unsigned char *p = (unsigned char *) dst;
+  size_t i = 0;
+  size_t n = 0;
+  wint_t wc;
+  int k, ascii;
+
+  while (i < nwc && n < len)
+    {
+      if (nwc - i >= 8 && len - n >= 8)
+	{
+	  ascii = 1;
+	  for (k = 0; k < 8; k++)
+	    ascii &= s[i + k] != 0 && (wint_t) s[i + k] <= 0x7f;
+	  if (ascii)
+	    {
+	      if (p != NULL)
+		for (k = 0; k < 8; k++)
+		  p[n + k] = (unsigned char) s[i + k];
+	      i += 8;
+	      n += 8;
+	      continue;
+	    }
+	}
+
+      wc = s[i];
+      if (wc != 0 && wc <= 0x7f)
+	{
+	  if (p != NULL)
+	    p[n] = wc;
+	  n += 1;
+	}
+      else if (wc >= 0x80 && wc <= 0x7ff)
+	{
+	  if (len - n < 2)
+	    break;
+	  if (p != NULL)
+	    {
+	      p[n] = 0xc0 | (wc >> 6);
+	      p[n + 1] = 0x80 | (wc & 0x3f);
+	    }
+	  n += 2;
+	}
+      else if (wc >= 0x800 && wc <= 0xffff)
+	{
+	  /* UTF-16 surrogates need the state kept by __utf8_wctomb */
+	  if (len - n < 3 || (sizeof (wchar_t) == 2 && wc >= 0xd800
+			      && wc <= 0xdfff))
+	    break;
+	  if (p != NULL)
+	    {
+	      p[n] = 0xe0 | (wc >> 12);
+	      p[n + 1] = 0x80 | ((wc >> 6) & 0x3f);
+	      p[n + 2] = 0x80 | (wc & 0x3f);
+	    }
+	  n += 3;
+	}
+      else if (wc >= 0x10000 && wc <= 0x10ffff)
+	{
+	  if (len - n < 4)
+	    break;
+	  if (p != NULL)
+	    {
+	      p[n] = 0xf0 | (wc >> 18);
+	      p[n + 1] = 0x80 | ((wc >> 12) & 0x3f);
+	      p[n + 2] = 0x80 | ((wc >> 6) & 0x3f);
+	      p[n + 3] = 0x80 | (wc & 0x3f);
+	    }
+	  n += 4;
+	}
+      else
+	break;
+      i++;
+    }
+
+  *count = n;
+  return i;
+}
+#endif /* UTF8_FAST */
+
 size_t
 _wcsnrtombs_l (struct _reent *r, char *dst, const wchar_t **src, size_t nwc,
 	       size_t len, mbstate_t *ps, struct __locale_t *loc)
@@ -97,11 +193,34 @@ _wcsnrtombs_l (struct _reent *r, char *dst, const wchar_t **src, size_t nwc,
   n = 0;
   pwcs = (wchar_t *)(*src);
 
-  while (n < len && nwc-- > 0)
+  while (n < len && nwc > 0)
     {
-      int count = ps->__count;
-      wint_t wch = ps->__value.__wch;
-      int bytes = loc->wctomb (r, buff, *pwcs, ps);
+      int count;
+      wint_t wch;
+      int bytes;
+
+#ifdef UTF8_FAST
+      if (loc->wctomb == __utf8_wctomb && ps->__count == 0)
+	{
+	  size_t used, done;
+
+	  used = utf8_run (ptr, pwcs, nwc, len - n, &done);
+	  pwcs += used;
+	  nwc -= used;
+	  n += done;
+	  if (dst)
+	    {
+	      ptr += done;
+	      *src += used;
+	    }
+	  if (n == len || nwc == 0)
+	    break;
+	}
+#endif
+      count = ps->__count;
+      wch = ps->__value.__wch;
+      nwc--;
+      bytes = loc->wctomb (r, buff, *pwcs, ps);
       if (bytes == -1)
 	{
 	  r->_errno = EILSEQ;
@@ -0,0 +1,216 @@
+/*
+FUNCTION
+	<<strcollsort>>, <<strcollsort_l>>---sort strings in collation order
+
+INDEX
+	strcollsort
+
+INDEX
+	strcollsort_l
+
+SYNOPSIS
+	#include <string.h>
+	int strcollsort(const char **<[array]>, size_t <[n]>);
+
+	int strcollsort_l(const char **<[array]>, size_t <[n]>,
+			  locale_t <[locale]>);
+
+DESCRIPTION
+	<<strcollsort>> sorts the <[n]> strings pointed to by the elements
+	of <[array]> into the collation order of the current locale, as if
+	by <<qsort>> with a comparison function calling <<strcoll>>.  Only
+	the pointers in <[array]> are moved.  Strings that collate equal
+	may end up in any order.
+
+	<<strcollsort_l>> is like <<strcollsort>> but uses the locale
+	<[locale]>.  If <[locale]> is LC_GLOBAL_LOCALE or not a valid
+	locale object, the behaviour is undefined.
+
+	The <<strxfrm_l>> key of each string is computed only once, and
+	the keys are sorted by their first eight bytes before the rest
+	is compared.
+
+RETURNS
+	0 on success.  If memory cannot be allocated, -1 is returned and
+	<[array]> is unchanged.
+
+PORTABILITY
+<<strcollsort>> and <<strcollsort_l>> are newlib extensions.
+
+<<strcollsort>> requires no supporting OS subroutines.  It uses
+<<malloc>>, <<qsort>> and <<strxfrm_l>> from elsewhere in this library.
+
+QUICKREF
+	strcollsort pure
+*/
+
+#include <reent.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "../locale/setlocale.h"
+
+/*
+   Sorting by sort keys.  The strxfrm_l key of every string is computed
+   once, and the first eight key bytes are packed into an integer.  The
+   keys are radix sorted by that integer, then only runs of keys sharing
+   the first eight bytes are sorted by comparing the rest with memcmp.
+ */
+
+struct sortkey
+{
+  uint64_t prefix;		/* first 8 key bytes, big-endian, 0 padded */
+  size_t len;
+  const unsigned char *key;
+  const char *str;
+};
+
+static int
+sortkey_cmp (const void *a, const void *b)
+{
+  const struct sortkey *ka = (const struct sortkey *) a;
+  const struct sortkey *kb = (const struct sortkey *) b;
+  size_t len;
+  int ret;
+
+  if (ka->prefix != kb->prefix)
+    return ka->prefix < kb->prefix ? -1 : 1;
+  /* Keys don't contain NUL bytes, so a key shorter than 8 bytes is a
+     prefix of the other one */
+  len = ka->len < kb->len ? ka->len : kb->len;
+  if (len > 8 && (ret = memcmp (ka->key + 8, kb->key + 8, len - 8)) != 0)
+    return ret;
+  return ka->len < kb->len ? -1 : ka->len > kb->len;
+}
+
+#if !defined(PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__)
+/* below this, qsort is faster than the radix sort passes */
+#define RADIX_MIN 64
+
+/* LSD radix sort of 'keys' by prefix, skipping the bytes which are the
+   same in all keys.  Returns -1 if out of memory.  */
+static int
+radix_sort (struct _reent *ptr, struct sortkey *keys, size_t n)
+{
+  size_t (*count)[256];
+  struct sortkey *tmp, *src = keys, *dst, *t;
+  size_t i, c, k, sum;
+  int b;
+
+  if (n > (SIZE_MAX - sizeof (size_t[8][256])) / sizeof *keys
+      || (count = (size_t (*)[256])
+		  _malloc_r (ptr, sizeof (size_t[8][256])
+			     + n * sizeof *keys)) == NULL)
+    return -1;
+  tmp = (struct sortkey *) (count + 8);
+
+  memset (count, 0, sizeof (size_t[8][256]));
+  for (i = 0; i < n; i++)
+    for (b = 0; b < 8; b++)
+      count[b][(keys[i].prefix >> (8 * b)) & 0xff]++;
+
+  dst = tmp;
+  for (b = 0; b < 8; b++)
+    {
+      if (count[b][(keys[0].prefix >> (8 * b)) & 0xff] == n)
+	continue;
+      for (sum = 0, c = 0; c < 256; c++)
+	{
+	  k = count[b][c];
+	  count[b][c] = sum;
+	  sum += k;
+	}
+      for (i = 0; i < n; i++)
+	dst[count[b][(src[i].prefix >> (8 * b)) & 0xff]++] = src[i];
+      t = src;
+      src = dst;
+      dst = t;
+    }
+  if (src != keys)
+    memcpy (keys, src, n * sizeof *keys);
+  _free_r (ptr, count);
+  return 0;
+}
+#endif
+
+/* Sort the 'n' strings of 'array' in the collation order of 'locale', as
+   if by qsort with strcoll_l.  Returns 0, or -1 if out of memory, leaving
+   'array' unchanged.  */
+int
+strcollsort_l (const char **array, size_t n, struct __locale_t *locale)
+{
+  struct _reent *ptr = _REENT;
+  struct sortkey *keys;
+  unsigned char *buf = NULL, *p;
+  size_t i, j, total = 0;
+
+  if (n < 2)
+    return 0;
+  if (n > SIZE_MAX / sizeof *keys
+      || (keys = (struct sortkey *) _malloc_r (ptr, n * sizeof *keys)) == NULL)
+    return -1;
+
+  /* In the "C" locale the strings are their own keys. */
+  if (__locale_is_C_l (locale, LC_COLLATE))
+    for (i = 0; i < n; i++)
+      {
+	keys[i].key = (const unsigned char *) array[i];
+	keys[i].len = strlen (array[i]);
+      }
+  else
+    {
+      for (i = 0; i < n; i++)
+	{
+	  keys[i].len = strxfrm_l (NULL, array[i], 0, locale);
+	  total += keys[i].len + 1;
+	}
+      if ((buf = (unsigned char *) _malloc_r (ptr, total)) == NULL)
+	{
+	  _free_r (ptr, keys);
+	  return -1;
+	}
+      for (i = 0, p = buf; i < n; i++)
+	{
+	  strxfrm_l ((char *) p, array[i], keys[i].len + 1, locale);
+	  keys[i].key = p;
+	  p += keys[i].len + 1;
+	}
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      keys[i].str = array[i];
+      keys[i].prefix = 0;
+      for (j = 0; j < 8; j++)
+	keys[i].prefix = keys[i].prefix << 8
+			 | (j < keys[i].len ? keys[i].key[j] : 0);
+    }
+
+#if !defined(PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__)
+  if (n >= RADIX_MIN && radix_sort (ptr, keys, n) == 0)
+    {
+      for (i = 0; i < n; i = j)
+	{
+	  for (j = i + 1; j < n && keys[j].prefix == keys[i].prefix; j++)
+	    ;
+	  if (j - i > 1)
+	    qsort (keys + i, j - i, sizeof *keys, sortkey_cmp);
+	}
+    }
+  else
+#endif
+  qsort (keys, n, sizeof *keys, sortkey_cmp);
+
+  for (i = 0; i < n; i++)
+    array[i] = keys[i].str;
+  _free_r (ptr, buf);
+  _free_r (ptr, keys);
+  return 0;
+}
+
+/* Likewise in the current locale.  */
+int
+strcollsort (const char **array, size_t n)
+{
+  return strcollsort_l (array, n, __get_current_locale ());
+}
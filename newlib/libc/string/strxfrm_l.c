@@ -52,20 +52,9 @@ size_t
 strxfrm_l (char *__restrict s1, const char *__restrict s2, size_t n,
 	   struct __locale_t *locale)
 {
-  size_t res;
-  res = 0;
-  while (n-- > 0)
-    {
-      if ((*s1++ = *s2++) != '\0')
-        ++res;
-      else
-        return res;
-    }
-  while (*s2)
-    {
-      ++s2;
-      ++res;
-    }
+  size_t res = strlen (s2);
 
+  if (n > 0)
+    memcpy (s1, s2, res < n ? res + 1 : n);
   return res;
 }
@@ -35,17 +35,27 @@ QUICKREF
 #include <wchar.h>
 #include <wctype.h>
 
+/* characters folded at a time */
+#define CHUNK 32
+
 int
 wcscasecmp (const wchar_t *s1,
 	const wchar_t *s2)
 {
-  int d = 0;
+  wchar_t l1[CHUNK], l2[CHUNK];
+  size_t n, i;
+  int d;
+
   for ( ; ; )
     {
-      const int c1 = towlower (*s1++);
-      const int c2 = towlower (*s2++);
-      if (((d = c1 - c2) != 0) || (c2 == '\0'))
-        break;
+      /* fold the next chunk, up to the terminating NUL of either string */
+      n = wcsnlen (s2, wcsnlen (s1, CHUNK - 1)) + 1;
+      wmemtolower (l1, s1, n);
+      wmemtolower (l2, s2, n);
+      for (i = 0; i < n; i++)
+	if (((d = l1[i] - l2[i]) != 0) || (l2[i] == '\0'))
+	  return d;
+      s1 += n;
+      s2 += n;
     }
-  return d;
 }
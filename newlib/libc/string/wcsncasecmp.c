@@ -36,18 +36,30 @@ QUICKREF
 #include <wchar.h>
 #include <wctype.h>
 
+/* characters folded at a time */
+#define CHUNK 32
+
 int 
 wcsncasecmp (const wchar_t *s1,
 	const wchar_t *s2,
 	size_t n)
 {
-  int d = 0;
-  for ( ; n != 0; n--)
+  wchar_t l1[CHUNK], l2[CHUNK];
+  size_t m, i;
+  int d;
+
+  while (n != 0)
     {
-      const int c1 = towlower (*s1++);
-      const int c2 = towlower (*s2++);
-      if (((d = c1 - c2) != 0) || (c2 == '\0'))
-        break;
+      /* fold the next chunk, up to the terminating NUL of either string */
+      m = wcsnlen (s2, wcsnlen (s1, (n < CHUNK ? n : CHUNK) - 1)) + 1;
+      wmemtolower (l1, s1, m);
+      wmemtolower (l2, s2, m);
+      for (i = 0; i < m; i++)
+	if (((d = l1[i] - l2[i]) != 0) || (l2[i] == '\0'))
+	  return d;
+      s1 += m;
+      s2 += m;
+      n -= m;
     }
-  return d;
+  return 0;
 }
@@ -124,6 +124,25 @@ bisearch(wint_t ucs, const struct interval *table, int max)
 
   return 0;
 }
+
+#if !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+/* two-stage table of width classes of planes 0-3, see mkwidthblocks */
+#include "widthblocks.t"
+
+#define WIDTH_NORMAL	0
+#define WIDTH_AMBIGUOUS	1
+#define WIDTH_COMBINING	2
+#define WIDTH_WIDE	3
+
+static inline int
+width_class (wint_t ucs)
+{
+  unsigned char b = width_blocks[width_pages[ucs >> WIDTH_BLOCK_SHIFT]]
+				[(ucs & ((1 << WIDTH_BLOCK_SHIFT) - 1)) >> 2];
+
+  return (b >> ((ucs & 3) * 2)) & 3;
+}
+#endif
 #endif /* _MB_CAPABLE */
 
 /* The following function defines the column width of an ISO 10646
@@ -200,6 +219,22 @@ __wcwidth (const wint_t ucs)
   /* check CJK width mode (1: ambiguous-wide, 0: normal, -1: disabled) */
   int cjk_lang = __locale_cjk_lang ();
 
+#ifdef WIDTH_LIMIT
+  /* table lookup replacing the searches below */
+  if (ucs < WIDTH_LIMIT)
+    switch (width_class (ucs))
+      {
+      case WIDTH_AMBIGUOUS:
+	return cjk_lang > 0 ? 2 : 1;
+      case WIDTH_COMBINING:
+	return 0;
+      case WIDTH_WIDE:
+	return cjk_lang >= 0 ? 2 : 1;
+      default:
+	return 1;
+      }
+#endif
+
   /* binary search in table of ambiguous characters */
   if (cjk_lang > 0
       && bisearch(ucs, ambiguous,
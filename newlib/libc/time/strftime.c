@@ -25,6 +25,12 @@ INDEX
 INDEX
 	strftime_l
 
+INDEX
+	strftime_compile
+
+INDEX
+	strftime_exec
+
 SYNOPSIS
 	#include <time.h>
 	size_t strftime(char *restrict <[s]>, size_t <[maxsize]>,
@@ -34,6 +40,13 @@ SYNOPSIS
 			  const char *restrict <[format]>,
 			  const struct tm *restrict <[timp]>,
 			  locale_t <[locale]>);
+	strftime_plan_t strftime_compile(const char *restrict <[format]>);
+	strftime_plan_t strftime_compile_l(const char *restrict <[format]>,
+					   locale_t <[locale]>);
+	size_t strftime_exec(char *restrict <[s]>, size_t <[maxsize]>,
+			     strftime_plan_t <[plan]>,
+			     const struct tm *restrict <[timp]>);
+	void strftime_free(strftime_plan_t <[plan]>);
 
 DESCRIPTION
 <<strftime>> converts a <<struct tm>> representation of the time (at
@@ -44,6 +57,14 @@ no more than <[maxsize]> characters.
 as expected in locale <[locale]>.  If <[locale]> is LC_GLOBAL_LOCALE or
 not a valid locale object, the behaviour is undefined.
 
+<<strftime_compile>> and <<strftime_compile_l>> parse <[format]> once
+and return a plan, or NULL if <[format]> is invalid or memory is
+exhausted.  <<strftime_exec>> formats <[timp]> according to such a plan
+with the same result <<strftime>> (respectively <<strftime_l>>) would
+produce for the original format, without parsing the format again.
+<<strftime_free>> releases a plan.  Plans are read-only after creation
+and may be shared between threads.
+
 You control the format of the output using the string at <[format]>.
 <<*<[format]>>> can contain two kinds of specifications: text to be
 copied literally into the formatted string, and time conversion
@@ -263,6 +284,9 @@ This implementation does not support <<s>> being NULL, nor overlapping
 
 <<strftime_l>> is POSIX-1.2008.
 
+<<strftime_compile>>, <<strftime_compile_l>>, <<strftime_exec>> and
+<<strftime_free>> are newlib extensions.
+
 <<strftime>> and <<strftime_l>> require no supporting OS subroutines.
 
 BUGS
@@ -1466,8 +1490,511 @@ strftime_l (CHAR *__restrict s, size_t maxsize, const CHAR *__restrict format,
 #endif /* !_WANT_C99_TIME_FORMATS */
 }
 
+#if !defined (MAKE_WCSFTIME)
+/* Precompiled strftime formats.
+
+   strftime_compile() parses FORMAT once and turns it into a short list of
+   operations: literal text spans (%n, %t and %% are folded into them),
+   fixed-width numeric fields written without going through sniprintf,
+   locale name lookups, and, for everything else, a per-conversion call
+   into __strftime.  The composite conversions %D, %F, %R and %T are
+   expanded at compile time.  strftime_exec() then runs the list against a
+   struct tm and returns exactly what strftime() would have returned for the
+   same format, time and locale.
+
+   A plan built by strftime_compile() uses the locale current at the time of
+   each strftime_exec() call; a plan built by strftime_compile_l() is bound to
+   LOCALE, which must stay valid until the plan is freed. */
+
+enum __strftime_op_type {
+  SFP_LITERAL,		/* Copy len chars starting at pool[off].  */
+  SFP_NUM,		/* Numeric field, see enum __strftime_field.  */
+  SFP_NAME,		/* Locale name, see enum __strftime_field.  */
+  SFP_YEAR,		/* 4-digit %Y, falls back to pool[off] otherwise.  */
+  SFP_GENERIC		/* __strftime on the single conversion pool[off].  */
+};
+
+enum __strftime_field {
+  SFF_MDAY, SFF_HOUR, SFF_HOUR12, SFF_MIN, SFF_SEC, SFF_MON, SFF_YDAY,
+  SFF_YEAR2, SFF_WDAY, SFF_WDAY1,
+  SFF_ABDAY, SFF_DAY, SFF_ABMON, SFF_MONTH, SFF_AMPM, SFF_AMPM_LOWER
+};
+
+struct __strftime_op {
+  unsigned char type;		/* enum __strftime_op_type */
+  unsigned char field;		/* enum __strftime_field */
+  unsigned char digits;		/* Minimum number of digits (SFP_NUM) */
+  char fill;			/* '0' or ' ' (SFP_NUM) */
+  unsigned int off;		/* Offset into pool */
+  unsigned int len;		/* Length of literal */
+};
+
+struct __strftime_plan {
+  struct __locale_t *locale;	/* NULL means current locale */
+  size_t nops;
+  struct __strftime_op *ops;
+  char *pool;			/* Literal text and NUL-terminated specs */
+};
+
+/* Worst case number of ops and pool bytes for a format of length N: every
+   conversion spec is at least two characters and expands into at most five
+   ops plus one literal run (%D, %R, %T, %F), and the largest pool use per
+   conversion is %F with its seven bytes ("%+4Y\0--"). */
+#define SFP_MAX_OPS(n)	((n) * 3 + 1)
+#define SFP_MAX_POOL(n)	((n) * 4 + 1)
+
+static struct __strftime_op *
+sfp_add (struct __strftime_plan *plan, int type, int field, int digits,
+	 char fill)
+{
+  struct __strftime_op *op = &plan->ops[plan->nops++];
+
+  op->type = type;
+  op->field = field;
+  op->digits = digits;
+  op->fill = fill;
+  op->off = 0;
+  op->len = 0;
+  return op;
+}
+
+/* Append LEN chars of literal text, merging with a preceding literal op
+   when possible. */
+static void
+sfp_literal (struct __strftime_plan *plan, size_t *poolpos, const char *lit,
+	     size_t len)
+{
+  struct __strftime_op *op;
+
+  if (plan->nops && (op = &plan->ops[plan->nops - 1])->type == SFP_LITERAL
+      && op->off + op->len == *poolpos)
+    op->len += len;
+  else
+    {
+      op = sfp_add (plan, SFP_LITERAL, 0, 0, '\0');
+      op->off = *poolpos;
+      op->len = len;
+    }
+  memcpy (plan->pool + *poolpos, lit, len);
+  *poolpos += len;
+}
+
+/* Store a NUL-terminated conversion spec in the pool and return its
+   offset. */
+static size_t
+sfp_spec (struct __strftime_plan *plan, size_t *poolpos, const char *spec,
+	  size_t len)
+{
+  size_t off = *poolpos;
+
+  memcpy (plan->pool + off, spec, len);
+  plan->pool[off + len] = '\0';
+  *poolpos += len + 1;
+  return off;
+}
+
+static void
+sfp_num (struct __strftime_plan *plan, int field, int digits, char fill)
+{
+  sfp_add (plan, SFP_NUM, field, digits, fill);
+}
+
+static struct __strftime_plan *
+__strftime_compile (const char *format, struct __locale_t *locale)
+{
+  struct __strftime_plan *plan;
+  size_t flen = strlen (format);
+  size_t poolpos = 0;
+  const char *spec;
+
+  plan = (struct __strftime_plan *) malloc (sizeof *plan
+					      + SFP_MAX_OPS (flen)
+						* sizeof (struct __strftime_op)
+					      + SFP_MAX_POOL (flen));
+  if (!plan)
+    return NULL;
+  plan->locale = locale;
+  plan->nops = 0;
+  plan->ops = (struct __strftime_op *) (plan + 1);
+  plan->pool = (char *) (plan->ops + SFP_MAX_OPS (flen));
+
+  for (;;)
+    {
+      const char *lit = format;
+
+      while (*format && *format != '%')
+	format++;
+      if (format > lit)
+	sfp_literal (plan, &poolpos, lit, format - lit);
+      if (*format == '\0')
+	break;
+
+      /* Any pad, width or E/O modifier goes the generic way. */
+      spec = format++;
+      if (*format == '0' || *format == '+')
+	format++;
+      while (*format >= '0' && *format <= '9')
+	format++;
+      if (*format == 'E' || *format == 'O')
+	format++;
+      if (*format == '\0')
+	{
+	  /* strftime fails on a trailing incomplete conversion. */
+	  free (plan);
+	  return NULL;
+	}
+      if (format - spec > 1)
+	goto generic;
+
+      switch (*format)
+	{
+	case 'n':
+	  sfp_literal (plan, &poolpos, "\n", 1);
+	  break;
+	case 't':
+	  sfp_literal (plan, &poolpos, "\t", 1);
+	  break;
+	case '%':
+	  sfp_literal (plan, &poolpos, "%", 1);
+	  break;
+	case 'a':
+	  sfp_add (plan, SFP_NAME, SFF_ABDAY, 0, '\0');
+	  break;
+	case 'A':
+	  sfp_add (plan, SFP_NAME, SFF_DAY, 0, '\0');
+	  break;
+	case 'b':
+	case 'h':
+	  sfp_add (plan, SFP_NAME, SFF_ABMON, 0, '\0');
+	  break;
+	case 'B':
+	  sfp_add (plan, SFP_NAME, SFF_MONTH, 0, '\0');
+	  break;
+	case 'p':
+	  sfp_add (plan, SFP_NAME, SFF_AMPM, 0, '\0');
+	  break;
+	case 'P':
+	  sfp_add (plan, SFP_NAME, SFF_AMPM_LOWER, 0, '\0');
+	  break;
+	case 'd':
+	  sfp_num (plan, SFF_MDAY, 2, '0');
+	  break;
+	case 'e':
+	  sfp_num (plan, SFF_MDAY, 2, ' ');
+	  break;
+	case 'H':
+	  sfp_num (plan, SFF_HOUR, 2, '0');
+	  break;
+	case 'k':
+	  sfp_num (plan, SFF_HOUR, 2, ' ');
+	  break;
+	case 'I':
+	  sfp_num (plan, SFF_HOUR12, 2, '0');
+	  break;
+	case 'l':
+	  sfp_num (plan, SFF_HOUR12, 2, ' ');
+	  break;
+	case 'j':
+	  sfp_num (plan, SFF_YDAY, 3, '0');
+	  break;
+	case 'm':
+	  sfp_num (plan, SFF_MON, 2, '0');
+	  break;
+	case 'M':
+	  sfp_num (plan, SFF_MIN, 2, '0');
+	  break;
+	case 'S':
+	  sfp_num (plan, SFF_SEC, 2, '0');
+	  break;
+	case 'u':
+	  sfp_num (plan, SFF_WDAY1, 1, '0');
+	  break;
+	case 'w':
+	  sfp_num (plan, SFF_WDAY, 1, '0');
+	  break;
+	case 'y':
+	  sfp_num (plan, SFF_YEAR2, 2, '0');
+	  break;
+	case 'D':
+	  sfp_num (plan, SFF_MON, 2, '0');
+	  sfp_literal (plan, &poolpos, "/", 1);
+	  sfp_num (plan, SFF_MDAY, 2, '0');
+	  sfp_literal (plan, &poolpos, "/", 1);
+	  sfp_num (plan, SFF_YEAR2, 2, '0');
+	  break;
+	case 'R':
+	case 'T':
+	  sfp_num (plan, SFF_HOUR, 2, '0');
+	  sfp_literal (plan, &poolpos, ":", 1);
+	  sfp_num (plan, SFF_MIN, 2, '0');
+	  if (*format == 'T')
+	    {
+	      sfp_literal (plan, &poolpos, ":", 1);
+	      sfp_num (plan, SFF_SEC, 2, '0');
+	    }
+	  break;
+	case 'Y':
+	  {
+	    size_t off = sfp_spec (plan, &poolpos, "%Y", 2);
+	    sfp_add (plan, SFP_YEAR, 0, 0, '\0')->off = off;
+	  }
+	  break;
+	case 'F':
+	  {
+	    /* %F is "%+4Y-%m-%d". */
+	    size_t off = sfp_spec (plan, &poolpos, "%+4Y", 4);
+	    sfp_add (plan, SFP_YEAR, 0, 0, '\0')->off = off;
+	    sfp_literal (plan, &poolpos, "-", 1);
+	    sfp_num (plan, SFF_MON, 2, '0');
+	    sfp_literal (plan, &poolpos, "-", 1);
+	    sfp_num (plan, SFF_MDAY, 2, '0');
+	  }
+	  break;
+	default:
+	generic:
+	  {
+	    size_t off = sfp_spec (plan, &poolpos, spec, format + 1 - spec);
+	    sfp_add (plan, SFP_GENERIC, 0, 0, '\0')->off = off;
+	  }
+	  break;
+	}
+      format++;
+    }
+  return plan;
+}
+
+strftime_plan_t
+strftime_compile (const char *__restrict format)
+{
+  return __strftime_compile (format, NULL);
+}
+
+strftime_plan_t
+strftime_compile_l (const char *__restrict format, struct __locale_t *locale)
+{
+  return __strftime_compile (format, locale);
+}
+
+void
+strftime_free (strftime_plan_t plan)
+{
+  free (plan);
+}
+
+/* Write VAL with at least DIGITS digits, padded with FILL, exactly like
+   sniprintf "%.Nd" (FILL '0') or "%Nd" (FILL ' ') would.  Return the
+   number of chars the field needs, or -1 if VAL is negative. */
+static int
+sfp_putnum (char *s, size_t room, int val, int digits, char fill)
+{
+  char buf[12];
+  char *p = buf + sizeof buf;
+  unsigned u;
+  int len;
+
+  if (val < 0)
+    return -1;
+  u = (unsigned) val;
+  do
+    {
+      *--p = '0' + u % 10;
+      u /= 10;
+    }
+  while (u);
+  while (buf + sizeof buf - p < digits)
+    *--p = fill;
+  len = buf + sizeof buf - p;
+  if ((size_t) len < room)
+    memcpy (s, p, len);
+  return len;
+}
+
+size_t
+strftime_exec (char *__restrict s, size_t maxsize, strftime_plan_t plan,
+	       const struct tm *__restrict tim_p)
+{
+  struct __locale_t *locale = plan->locale;
+  const struct lc_time_T *tl = NULL;
+#ifdef _WANT_C99_TIME_FORMATS
+  era_info_t *era_info = NULL;
+  alt_digits_t *alt_digits = NULL;
+#endif
+  const struct __strftime_op *op = plan->ops;
+  const struct __strftime_op *end = op + plan->nops;
+  size_t count = 0;
+  int len;
+
+  if (maxsize == 0)
+    return 0;
+  for (; op < end; op++)
+    {
+      switch (op->type)
+	{
+	case SFP_LITERAL:
+	  if (op->len >= maxsize - count)
+	    goto fail;
+	  memcpy (&s[count], plan->pool + op->off, op->len);
+	  count += op->len;
+	  continue;
+	case SFP_NUM:
+	  {
+	    int val;
+
+	    switch (op->field)
+	      {
+	      case SFF_MDAY:
+		val = tim_p->tm_mday;
+		break;
+	      case SFF_HOUR:
+		val = tim_p->tm_hour;
+		break;
+	      case SFF_HOUR12:
+		val = (tim_p->tm_hour == 0 || tim_p->tm_hour == 12)
+		      ? 12 : tim_p->tm_hour % 12;
+		break;
+	      case SFF_MIN:
+		val = tim_p->tm_min;
+		break;
+	      case SFF_SEC:
+		val = tim_p->tm_sec;
+		break;
+	      case SFF_MON:
+		val = tim_p->tm_mon + 1;
+		break;
+	      case SFF_YDAY:
+		val = tim_p->tm_yday + 1;
+		break;
+	      case SFF_YEAR2:
+		val = tim_p->tm_year >= 0 ? tim_p->tm_year % 100
+		      : abs (tim_p->tm_year + YEAR_BASE) % 100;
+		break;
+	      case SFF_WDAY1:
+		val = tim_p->tm_wday == 0 ? 7 : tim_p->tm_wday;
+		break;
+	      default:
+		val = tim_p->tm_wday;
+		break;
+	      }
+	    len = sfp_putnum (&s[count], maxsize - count, val, op->digits,
+			      op->fill);
+	    if (len < 0)
+	      len = sniprintf (&s[count], maxsize - count,
+			       op->fill == ' ' ? "%*d" : "%.*d",
+			       op->digits, val);
+	    if (len < 0 || (size_t) len >= maxsize - count)
+	      goto fail;
+	    count += len;
+	  }
+	  continue;
+	case SFP_NAME:
+	  {
+	    const char *name;
+
+	    if (!tl)
+	      tl = __get_time_locale (locale ? locale
+					     : __get_current_locale ());
+	    switch (op->field)
+	      {
+	      case SFF_ABDAY:
+		name = tl->wday[tim_p->tm_wday];
+		break;
+	      case SFF_DAY:
+		name = tl->weekday[tim_p->tm_wday];
+		break;
+	      case SFF_ABMON:
+		name = tl->mon[tim_p->tm_mon];
+		break;
+	      case SFF_MONTH:
+		name = tl->month[tim_p->tm_mon];
+		break;
+	      default:
+		name = tl->am_pm[tim_p->tm_hour < 12 ? 0 : 1];
+		break;
+	      }
+	    len = strlen (name);
+	    if ((size_t) len >= maxsize - count)
+	      goto fail;
+	    if (op->field == SFF_AMPM_LOWER)
+	      {
+		int i;
+
+		for (i = 0; i < len; i++)
+		  s[count + i] = TOLOWER (name[i]);
+	      }
+	    else
+	      memcpy (&s[count], name, len);
+	    count += len;
+	  }
+	  continue;
+	case SFP_YEAR:
+	  {
+	    unsigned year = (unsigned) tim_p->tm_year + (unsigned) YEAR_BASE;
+
+	    if (tim_p->tm_year >= -YEAR_BASE && year >= 1000 && year <= 9999)
+	      {
+		if (4 >= maxsize - count)
+		  goto fail;
+		s[count + 3] = '0' + year % 10;
+		year /= 10;
+		s[count + 2] = '0' + year % 10;
+		year /= 10;
+		s[count + 1] = '0' + year % 10;
+		s[count] = '0' + year / 10;
+		count += 4;
+		continue;
+	      }
+	  }
+	  /*FALLTHRU*/
+	case SFP_GENERIC:
+	  {
+	    size_t ret;
+	    const char *spec = plan->pool + op->off;
+
+	    if (!locale)
+	      locale = __get_current_locale ();
+	    ret = __strftime (&s[count], maxsize - count, spec, tim_p, locale,
+			      &era_info, &alt_digits);
+	    if (ret == 0)
+	      {
+		/* __strftime returns 0 both for an empty expansion (e.g. %Z
+		   with tm_isdst < 0) and for running out of room.  Tell the
+		   two apart on a scratch buffer. */
+		char scratch[64];
+
+		scratch[0] = '\1';
+		if (__strftime (scratch, sizeof scratch, spec, tim_p, locale,
+				&era_info, &alt_digits) != 0
+		    || scratch[0] != '\0')
+		  goto fail;
+	      }
+	    count += ret;
+	  }
+	  continue;
+	}
+    }
+  s[count] = '\0';
+#ifdef _WANT_C99_TIME_FORMATS
+  if (era_info)
+    free_era_info (era_info);
+  if (alt_digits)
+    free_alt_digits (alt_digits);
+#endif
+  return count;
+
+fail:
+#ifdef _WANT_C99_TIME_FORMATS
+  if (era_info)
+    free_era_info (era_info);
+  if (alt_digits)
+    free_alt_digits (alt_digits);
+#endif
+  return 0;
+}
+#endif /* !MAKE_WCSFTIME */
+
 /* The remainder of this file can serve as a regression test.  Compile
- *  with -D_REGRESSION_TEST.  */
+ *  with -D_REGRESSION_TEST, and additionally with -DBENCHMARK_LOOPS=<n> to
+ *  time strftime_exec against strftime.  */
 #if defined(_REGRESSION_TEST)	/* [Test code:  */
 
 /* This test code relies on ANSI C features, in particular on the ability
@@ -1889,6 +2416,57 @@ for(l=0; l<sizeof(List)/sizeof(List[0]); l++)  {
 	}
     }
 
+#if !defined(MAKE_WCSFTIME)
+/* Run all of the exact-length tests through a compiled plan--results should
+ * match, and a plan should fail where strftime fails.  */
+for(l=0; l<sizeof(List)/sizeof(List[0]); l++)  {
+    const struct list  *test = &List[l];
+    for(i=0; i<test->cnt; i++)  {
+	strftime_plan_t  plan = strftime_compile(test->vec[i].fmt);
+	tot++;	/* Keep track of number of tests */
+	ret = plan ? strftime_exec(out, test->vec[i].max, plan, test->tms) : 0;
+	if(ret != test->vec[i].ret || strncmp(out, test->vec[i].out,
+					      test->vec[i].max-1))  {
+	    errr++;
+	    fprintf(stderr,
+		"ERROR:  plan \"%s\" (%d) != \"%s\" expected for List[%d].vec[%d]\n",
+				ret ? out : "", ret, test->vec[i].out, l, i);
+	    }
+	tot++;
+	if(plan && strftime_exec(out, test->vec[i].max-1, plan, test->tms))  {
+	    errr++;
+	    fprintf(stderr,
+		"ERROR:  plan return != 0 expected for List[%d].vec[%d]\n",
+									l, i);
+	    }
+	strftime_free(plan);
+	}
+    }
+
+#if defined(BENCHMARK_LOOPS)
+/* Compare the cost of strftime and of a compiled plan for a typical log
+ * timestamp format.  */
+{
+const char  *bfmt = "%Y-%m-%d %H:%M:%S";
+strftime_plan_t  plan = strftime_compile(bfmt);
+clock_t  t0, t1, t2;
+long  n;
+
+t0 = clock();
+for(n=0; n<BENCHMARK_LOOPS; n++)
+    strftime(out, OUTSIZE, bfmt, &tm0);
+t1 = clock();
+for(n=0; n<BENCHMARK_LOOPS; n++)
+    strftime_exec(out, OUTSIZE, plan, &tm0);
+t2 = clock();
+strftime_free(plan);
+printf("\"%s\":  strftime %.1f ns/call, strftime_exec %.1f ns/call\n", bfmt,
+       (double) (t1 - t0) * 1e9 / CLOCKS_PER_SEC / BENCHMARK_LOOPS,
+       (double) (t2 - t1) * 1e9 / CLOCKS_PER_SEC / BENCHMARK_LOOPS);
+}
+#endif /* BENCHMARK_LOOPS */
+#endif /* !MAKE_WCSFTIME */
+
 /* Run all of the special year test cases */
 for(l=0; l<sizeof(ListYr)/sizeof(ListYr[0]); l++)  {
     const struct list  *test = &ListYr[l];
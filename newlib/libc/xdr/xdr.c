@@ -36,6 +36,7 @@
  * xdr.
  */
 
+#include <limits.h>
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
@@ -592,6 +593,7 @@ xdr_opaque (XDR * xdrs,
 	u_int cnt)
 {
   u_int rndup;
+  char *buf;
   static char crud[BYTES_PER_XDR_UNIT];
 
   /*
@@ -617,6 +619,14 @@ xdr_opaque (XDR * xdrs,
       return XDR_GETBYTES (xdrs, (caddr_t) crud, rndup);
 
     case XDR_ENCODE:
+      /* store data and padding at once if possible */
+      if (rndup > 0
+          && (buf = (char *) XDR_INLINE (xdrs, cnt + rndup)) != NULL)
+        {
+          memcpy (buf, cp, cnt);
+          memset (buf + cnt, 0, rndup);
+          return TRUE;
+        }
       if (!XDR_PUTBYTES (xdrs, cp, cnt))
         return FALSE;
       if (rndup == 0)
@@ -685,6 +695,58 @@ xdr_bytes (XDR * xdrs,
   return FALSE;
 }
 
+/*
+ * XDR opaque data in place, without copying it.
+ * On XDR_DECODE *cpp is set to the cnt bytes inside the stream buffer,
+ * on XDR_ENCODE cnt bytes (and their padding) are reserved in the stream
+ * and *cpp is set to where the caller has to store them.  This needs
+ * direct access to the stream buffer, see XDR_INLINE, so it is meant for
+ * memory streams; FALSE is returned if there isn't.
+ */
+bool_t
+xdr_opaque_inline (XDR * xdrs,
+	char ** cpp,
+	u_int cnt)
+{
+  u_int rndup;
+  char *buf;
+
+  if (xdrs->x_op == XDR_FREE)
+    return TRUE;
+  if (cnt > UINT_MAX - BYTES_PER_XDR_UNIT)
+    return FALSE;
+  rndup = RNDUP (cnt);
+  if (rndup == 0)
+    buf = NULL;
+  else if ((buf = (char *) XDR_INLINE (xdrs, rndup)) == NULL)
+    return FALSE;
+  if (xdrs->x_op == XDR_ENCODE && rndup > cnt)
+    memset (buf + cnt, 0, rndup - cnt);
+  *cpp = buf;
+  return TRUE;
+}
+
+/*
+ * XDR counted bytes in place, see xdr_opaque_inline.
+ * *sizep is the count; it is set on XDR_DECODE.
+ */
+bool_t
+xdr_bytes_inline (XDR * xdrs,
+	char ** cpp,
+	u_int * sizep,
+	u_int maxsize)
+{
+  if (xdrs->x_op == XDR_FREE)
+    return TRUE;
+  if (xdrs->x_op == XDR_ENCODE && *sizep > maxsize)
+    return FALSE;
+  if (!xdr_u_int (xdrs, sizep))
+    return FALSE;
+  if (*sizep > maxsize)
+    return FALSE;
+  return xdr_opaque_inline (xdrs, cpp, *sizep);
+}
+
 /*
  * Implemented here due to commonality of the object.
  */
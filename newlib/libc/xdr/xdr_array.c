@@ -46,6 +46,123 @@
 
 #include "xdr_private.h"
 
+#ifndef ntohl
+# define ntohl(x) xdr_ntohl(x)
+#endif
+#ifndef htonl
+# define htonl(x) xdr_htonl(x)
+#endif
+
+/*
+ * Arrays of fixed size primitives are converted in one go inside the
+ * stream buffer, if the stream gives access to it (see XDR_INLINE),
+ * instead of calling the element filter for every element.
+ */
+
+/* kinds of primitive elements, see prim_kind */
+#define PRIM_NONE	0
+#define PRIM_32		1	/* one XDR unit */
+#define PRIM_64		2	/* 64-bit integer, two units */
+#define PRIM_DOUBLE	3	/* double, two units */
+
+static int
+prim_kind (xdrproc_t elproc,
+	u_int elsize)
+{
+  if (elsize == 4
+      && (elproc == (xdrproc_t) xdr_int
+          || elproc == (xdrproc_t) xdr_u_int
+          || elproc == (xdrproc_t) xdr_int32_t
+          || elproc == (xdrproc_t) xdr_u_int32_t
+          || elproc == (xdrproc_t) xdr_uint32_t
+#if defined(__IEEE_LITTLE_ENDIAN) || defined(__IEEE_BIG_ENDIAN)
+          || elproc == (xdrproc_t) xdr_float
+#endif
+         ))
+    return PRIM_32;
+  if (elsize == 8
+      && (elproc == (xdrproc_t) xdr_int64_t
+          || elproc == (xdrproc_t) xdr_u_int64_t
+          || elproc == (xdrproc_t) xdr_uint64_t
+          || elproc == (xdrproc_t) xdr_hyper
+          || elproc == (xdrproc_t) xdr_u_hyper
+          || elproc == (xdrproc_t) xdr_longlong_t
+          || elproc == (xdrproc_t) xdr_u_longlong_t))
+    return PRIM_64;
+#if (defined(__IEEE_LITTLE_ENDIAN) || defined(__IEEE_BIG_ENDIAN)) \
+    && !defined(_DOUBLE_IS_32BITS)
+  if (elsize == 8 && elproc == (xdrproc_t) xdr_double)
+    return PRIM_DOUBLE;
+#endif
+  return PRIM_NONE;
+}
+
+/*
+ * xdr_prim_bulk():
+ *
+ * XDR nelem primitive elements of the given kind at basep in the stream
+ * buffer.  Returns FALSE without touching the stream if there is no
+ * direct access to nelem elements.
+ */
+static bool_t
+xdr_prim_bulk (XDR * xdrs,
+	char *basep,
+	u_int nelem,
+	int kind)
+{
+  u_int32_t *w = (u_int32_t *) (void *) basep;
+  u_int32_t *buf;
+  u_int i, nw;
+  int hi;
+
+  if (kind == PRIM_NONE
+      || (xdrs->x_op != XDR_ENCODE && xdrs->x_op != XDR_DECODE))
+    return FALSE;
+  nw = kind == PRIM_32 ? 1 : 2;
+  if (nelem > UINT_MAX / BYTES_PER_XDR_UNIT / nw
+      || (buf = (u_int32_t *) XDR_INLINE (xdrs,
+                                          nelem * nw * BYTES_PER_XDR_UNIT))
+         == NULL)
+    return FALSE;
+  nw *= nelem;
+
+  if (kind == PRIM_32)
+    {
+      if (xdrs->x_op == XDR_ENCODE)
+        for (i = 0; i < nw; i++)
+          buf[i] = htonl (w[i]);
+      else
+        for (i = 0; i < nw; i++)
+          w[i] = ntohl (buf[i]);
+      return TRUE;
+    }
+
+  /* index of the most significant word of an element, sent first */
+  if (kind == PRIM_64)
+    hi = BYTE_ORDER == LITTLE_ENDIAN;
+  else
+#if defined(__IEEE_LITTLE_ENDIAN)
+    hi = 1;
+#else
+    hi = 0;
+#endif
+  if (xdrs->x_op == XDR_ENCODE)
+    for (i = 0; i < nw; i += 2)
+      {
+        buf[i] = htonl (w[i + hi]);
+        buf[i + 1] = htonl (w[i + 1 - hi]);
+      }
+  else
+    for (i = 0; i < nw; i += 2)
+      {
+        u_int32_t h = ntohl (buf[i]), l = ntohl (buf[i + 1]);
+
+        w[i + hi] = h;
+        w[i + 1 - hi] = l;
+      }
+  return TRUE;
+}
+
 /*
  * XDR an array of arbitrary elements
  * *addrp is a pointer to the array, *sizep is the number of elements.
@@ -109,6 +226,8 @@ xdr_array (XDR * xdrs,
   /*
    * now we xdr each element of array
    */
+  if (c > 0 && xdr_prim_bulk (xdrs, target, c, prim_kind (elproc, elsize)))
+    return TRUE;
   for (i = 0; (i < c) && stat; i++)
     {
       stat = (*elproc) (xdrs, target);
@@ -146,6 +265,9 @@ xdr_vector (XDR * xdrs,
   u_int i;
   char *elptr;
 
+  if (nelem > 0
+      && xdr_prim_bulk (xdrs, basep, nelem, prim_kind (xdr_elem, elemsize)))
+    return TRUE;
   elptr = basep;
   for (i = 0; i < nelem; i++)
     {
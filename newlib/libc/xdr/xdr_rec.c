@@ -121,6 +121,7 @@ typedef struct rec_strm
   int (*writeit) (void *, void *, int);
   caddr_t out_base;             /* output buffer (points to frag header) */
   caddr_t out_finger;           /* next output position */
+  caddr_t out_sent;             /* first byte not written yet */
   caddr_t out_boundry;          /* data cannot up to this address */
   u_int32_t *frag_header;       /* beginning of curren fragment */
   bool_t frag_sent;             /* true if buffer sent in middle of record */
@@ -140,9 +141,8 @@ typedef struct rec_strm
 
   bool_t nonblock;
   bool_t in_haveheader;
-  u_int32_t in_header;
-  char *in_hdrp;
-  int in_hdrlen;
+  caddr_t in_start;             /* record being assembled (non-blocking) */
+  caddr_t in_end;               /* end of the data read (non-blocking) */
   int in_reclen;
   int in_received;
   int in_maxrec;
@@ -150,11 +150,14 @@ typedef struct rec_strm
 
 static u_int fix_buf_size (u_int);
 static bool_t flush_out (RECSTREAM *, bool_t);
+static bool_t write_out (RECSTREAM *, caddr_t);
+static bool_t compact_out (RECSTREAM *);
 static bool_t fill_input_buf (RECSTREAM *);
 static bool_t get_input_bytes (RECSTREAM *, char *, size_t);
 static bool_t set_input_fragment (RECSTREAM *);
 static bool_t skip_input_bytes (RECSTREAM *, long);
 static bool_t realloc_stream (RECSTREAM *, int);
+static void compact_in (RECSTREAM *);
 
 bool_t __xdrrec_getrec (XDR *, enum xprt_stat *, bool_t);
 bool_t __xdrrec_setnonblock (XDR *, int);
@@ -163,6 +166,7 @@ bool_t __xdrrec_setnonblock (XDR *, int);
  * Create an xdr handle for xdrrec
  * xdrrec_create fills in xdrs.  Sendsize and recvsize are
  * send and recv buffer sizes (0 => use default), and must be <= INT_MAX.
+ * Once xdrrec_setnonblock is called both buffers may grow.
  * tcp_handle is an opaque handle that is passed as the first parameter to
  * the procedures readit and writeit.  Readit and writeit are read and
  * write respectively.   They are like the system
@@ -236,6 +240,7 @@ xdrrec_create (XDR * xdrs,
   rstrm->readit = readit;
   rstrm->writeit = writeit;
   rstrm->out_finger = rstrm->out_boundry = rstrm->out_base;
+  rstrm->out_sent = rstrm->out_base;
   rstrm->frag_header = (u_int32_t *) (void *) rstrm->out_base;
   rstrm->out_finger += sizeof (u_int32_t);
   rstrm->out_boundry += sendsize;
@@ -246,8 +251,7 @@ xdrrec_create (XDR * xdrs,
   rstrm->fbtbc = 0;
   rstrm->last_frag = TRUE;
   rstrm->in_haveheader = FALSE;
-  rstrm->in_hdrlen = 0;
-  rstrm->in_hdrp = (char *) (void *) &rstrm->in_header;
+  rstrm->in_start = rstrm->in_end = rstrm->in_base;
   rstrm->nonblock = FALSE;
   rstrm->in_reclen = 0;
   rstrm->in_received = 0;
@@ -377,7 +381,7 @@ xdrrec_getpos (XDR * xdrs)
       {
 
       case XDR_ENCODE:
-        pos += rstrm->out_finger - rstrm->out_base;
+        pos += rstrm->out_finger - rstrm->out_sent;
         break;
 
       case XDR_DECODE:
@@ -584,6 +588,10 @@ xdrrec_eof (XDR * xdrs)
 {
   RECSTREAM *rstrm = (RECSTREAM *) (xdrs->x_private);
 
+  /* Records read ahead on a non-blocking stream are more input */
+  if (rstrm->nonblock)
+    return rstrm->in_start == rstrm->in_end;
+
   while (rstrm->fbtbc > 0 || (!rstrm->last_frag))
     {
       if (!skip_input_bytes (rstrm, rstrm->fbtbc))
@@ -628,6 +636,12 @@ xdrrec_endofrecord (XDR * xdrs,
 /*
  * Fill the stream buffer with a record for a non-blocking connection.
  * Return true if a record is available in the buffer, false if not.
+ *
+ * Each call reads at most once, as much as fits in the buffer, so that
+ * records which arrive together are handed out by the following calls
+ * without reading again.  The fragments of a record are joined in
+ * place: the record starts after its first header, and the header of
+ * each further fragment is cut out of the buffer.
  */
 bool_t
 __xdrrec_getrec (XDR * xdrs,
@@ -635,90 +649,114 @@ __xdrrec_getrec (XDR * xdrs,
 	bool_t expectdata)
 {
   RECSTREAM *rstrm = (RECSTREAM *) (xdrs->x_private);
+  u_int32_t header;
+  caddr_t data;
   ssize_t n;
-  int fraglen;
+  int fraglen, need;
+  bool_t didread = FALSE;
 
-  if (!rstrm->in_haveheader)
+  for (;;)
     {
-      n = rstrm->readit (rstrm->tcp_handle, rstrm->in_hdrp,
-                         (int) sizeof (rstrm->in_header) - rstrm->in_hdrlen);
-      if (n == 0)
+      data = rstrm->in_start + rstrm->in_received;
+      if (!rstrm->in_haveheader)
         {
-          *statp = expectdata ? XPRT_DIED : XPRT_IDLE;
-          return FALSE;
+          if (rstrm->in_end - data >= (ssize_t) sizeof (header))
+            {
+              memcpy (&header, data, sizeof (header));
+              header = ntohl (header);
+              fraglen = (int) (header & ~LAST_FRAG);
+              if (header == 0 || fraglen > rstrm->in_maxrec ||
+                  (rstrm->in_reclen + fraglen) > rstrm->in_maxrec)
+                {
+                  *statp = XPRT_DIED;
+                  return FALSE;
+                }
+              if (rstrm->in_received == 0)
+                rstrm->in_start += sizeof (header);
+              else
+                {
+                  rstrm->in_end -= sizeof (header);
+                  memmove (data, data + sizeof (header),
+                           rstrm->in_end - data);
+                }
+              rstrm->in_reclen += fraglen;
+              rstrm->last_frag = (header & LAST_FRAG) ? TRUE : FALSE;
+              rstrm->in_haveheader = TRUE;
+              continue;
+            }
         }
-      if (n < 0)
+      else if (rstrm->in_received < rstrm->in_reclen && data < rstrm->in_end)
         {
-          *statp = XPRT_DIED;
-          return FALSE;
+          n = rstrm->in_end - data;
+          if (n > rstrm->in_reclen - rstrm->in_received)
+            n = rstrm->in_reclen - rstrm->in_received;
+          rstrm->in_received += n;
+          continue;
         }
-      rstrm->in_hdrp += n;
-      rstrm->in_hdrlen += n;
-      if (rstrm->in_hdrlen < sizeof (rstrm->in_header))
+      else if (rstrm->in_received == rstrm->in_reclen)
+        {
+          rstrm->in_haveheader = FALSE;
+          if (rstrm->last_frag)
+            {
+              if ((long) rstrm->in_start % BYTES_PER_XDR_UNIT != 0)
+                compact_in (rstrm);
+              rstrm->fbtbc = rstrm->in_reclen;
+              rstrm->in_finger = rstrm->in_start;
+              rstrm->in_boundry = rstrm->in_start + rstrm->in_reclen;
+              rstrm->in_start = rstrm->in_boundry;
+              rstrm->in_reclen = rstrm->in_received = 0;
+              *statp = XPRT_MOREREQS;
+              return TRUE;
+            }
+          continue;
+        }
+
+      if (didread)
         {
           *statp = XPRT_MOREREQS;
           return FALSE;
         }
-      rstrm->in_header = ntohl (rstrm->in_header);
-      fraglen = (int) (rstrm->in_header & ~LAST_FRAG);
-      if (fraglen == 0 || fraglen > rstrm->in_maxrec ||
-          (rstrm->in_reclen + fraglen) > rstrm->in_maxrec)
+
+      /*
+       * Make room for the rest of the record: move it to the front of
+       * the buffer if it would not fit behind the records before it, and
+       * grow the buffer if it is larger than that.
+       */
+      if (rstrm->in_start == rstrm->in_end)
+        rstrm->in_start = rstrm->in_end = rstrm->in_base;
+      need = rstrm->in_haveheader ? rstrm->in_reclen
+                                  : rstrm->in_received + (int) sizeof (header);
+      if (rstrm->in_start + need > rstrm->in_base + rstrm->recvsize)
         {
-          *statp = XPRT_DIED;
+          compact_in (rstrm);
+          if (need > (int) rstrm->recvsize && !realloc_stream (rstrm, need))
+            {
+              *statp = XPRT_DIED;
+              return FALSE;
+            }
+        }
+
+      n = rstrm->readit (rstrm->tcp_handle, rstrm->in_end,
+                         (int) (rstrm->in_base + rstrm->recvsize -
+                                rstrm->in_end));
+      if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+          *statp = XPRT_IDLE;
           return FALSE;
         }
-      rstrm->in_reclen += fraglen;
-      if (rstrm->in_reclen > (int)rstrm->recvsize) /* guaranteed recvsize < INT_MAX */
-        realloc_stream (rstrm, rstrm->in_reclen);
-      if (rstrm->in_header & LAST_FRAG)
+      if (n < 0)
         {
-          rstrm->in_header &= ~LAST_FRAG;
-          rstrm->last_frag = TRUE;
+          *statp = XPRT_DIED;
+          return FALSE;
         }
-      /*
-       * We can only reasonably expect to read once from a
-       * non-blocking stream. Reading the fragment header
-       * may have drained the stream.
-       */
-      expectdata = FALSE;
-    }
-
-  n = rstrm->readit (rstrm->tcp_handle,
-                     rstrm->in_base + rstrm->in_received,
-                     (rstrm->in_reclen - rstrm->in_received));
-
-  if (n < 0)
-    {
-      *statp = XPRT_DIED;
-      return FALSE;
-    }
-
-  if (n == 0)
-    {
-      *statp = expectdata ? XPRT_DIED : XPRT_IDLE;
-      return FALSE;
-    }
-
-  rstrm->in_received += n;
-
-  if (rstrm->in_received == rstrm->in_reclen)
-    {
-      rstrm->in_haveheader = FALSE;
-      rstrm->in_hdrp = (char *) (void *) &rstrm->in_header;
-      rstrm->in_hdrlen = 0;
-      if (rstrm->last_frag)
+      if (n == 0)
         {
-          rstrm->fbtbc = rstrm->in_reclen;
-          rstrm->in_boundry = rstrm->in_base + rstrm->in_reclen;
-          rstrm->in_finger = rstrm->in_base;
-          rstrm->in_reclen = rstrm->in_received = 0;
-          *statp = XPRT_MOREREQS;
-          return TRUE;
+          *statp = expectdata ? XPRT_DIED : XPRT_IDLE;
+          return FALSE;
         }
+      rstrm->in_end += n;
+      didread = TRUE;
     }
-
-  *statp = XPRT_MOREREQS;
-  return FALSE;
 }
 
 bool_t
@@ -731,9 +769,62 @@ __xdrrec_setnonblock (XDR * xdrs,
   if (maxrec == 0)
     maxrec = rstrm->recvsize;
   rstrm->in_maxrec = maxrec;
+  rstrm->in_start = rstrm->in_end = rstrm->in_base;
+  rstrm->in_finger = rstrm->in_boundry = rstrm->in_base;
+  rstrm->fbtbc = 0;
+  rstrm->last_frag = TRUE;
   return TRUE;
 }
 
+/*
+ * Switch a record stream to non-blocking mode.  Readit and writeit may
+ * then transfer fewer bytes than asked for, or fail with EAGAIN.
+ * Incoming records of up to maxrec bytes (0 => the receive buffer size)
+ * are collected with xdrrec_getrec; the output buffer grows instead of
+ * blocking when the connection does not take it, and xdrrec_flush
+ * writes out what is left.
+ */
+bool_t
+xdrrec_setnonblock (XDR * xdrs,
+	int maxrec)
+{
+  return __xdrrec_setnonblock (xdrs, maxrec);
+}
+
+/*
+ * Read what is available on a non-blocking stream.  Returns 1 when a
+ * complete record is ready to be decoded, 0 when more input is needed,
+ * and -1 when the connection is closed or broken.
+ */
+int
+xdrrec_getrec (XDR * xdrs)
+{
+  enum xprt_stat xstat;
+
+  if (__xdrrec_getrec (xdrs, &xstat, TRUE))
+    return 1;
+  return xstat == XPRT_DIED ? -1 : 0;
+}
+
+/*
+ * Write the records ended with xdrrec_endofrecord which are still in the
+ * output buffer; together they go out in a single write.  Returns 1 when
+ * all of them have been written, 0 when a non-blocking stream could not
+ * take everything, and -1 on a write error.
+ */
+int
+xdrrec_flush (XDR * xdrs)
+{
+  RECSTREAM *rstrm = (RECSTREAM *) (xdrs->x_private);
+
+  if (!write_out (rstrm, (caddr_t) (void *) rstrm->frag_header))
+    return -1;
+  if (rstrm->out_sent != (caddr_t) (void *) rstrm->frag_header)
+    return 0;
+  (void) compact_out (rstrm);
+  return 1;
+}
+
 /*
  * Internal useful routines
  */
@@ -747,13 +838,91 @@ flush_out (RECSTREAM * rstrm,
                                sizeof (u_int32_t));
 
   *(rstrm->frag_header) = htonl (len | eormask);
-  len = (u_int32_t) ((u_long) (rstrm->out_finger) -
-                     (u_long) (rstrm->out_base));
-  if ((*(rstrm->writeit)) (rstrm->tcp_handle, rstrm->out_base, (int) len)
-      != (int) len)
+  if (!write_out (rstrm, rstrm->out_finger))
     return FALSE;
-  rstrm->frag_header = (u_int32_t *) (void *) rstrm->out_base;
-  rstrm->out_finger = (char *) rstrm->out_base + sizeof (u_int32_t);
+  rstrm->frag_header = (u_int32_t *) (void *) rstrm->out_finger;
+  rstrm->out_finger += sizeof (u_int32_t);
+  return compact_out (rstrm);
+}
+
+/*
+ * Write the finished fragments up to end.  A blocking stream must take
+ * all of them at once; a non-blocking one may take only part, and the
+ * rest stays in the buffer for the next flush.
+ */
+static bool_t
+write_out (RECSTREAM * rstrm,
+	caddr_t end)
+{
+  int len, n;
+
+  while (rstrm->out_sent < end)
+    {
+      len = (int) (end - rstrm->out_sent);
+      n = (*(rstrm->writeit)) (rstrm->tcp_handle, rstrm->out_sent, len);
+      if (!rstrm->nonblock)
+        {
+          if (n != len)
+            return FALSE;
+        }
+      else if (n <= 0)
+        {
+          if (n == 0 || errno == EAGAIN || errno == EWOULDBLOCK)
+            break;
+          return FALSE;
+        }
+      rstrm->out_sent += n;
+    }
+  return TRUE;
+}
+
+/*
+ * Move the unsent part of the output buffer to its front.  Once only the
+ * current fragment is left it starts the buffer again; otherwise the
+ * alignment of the data is kept.  A non-blocking stream grows the buffer
+ * if less than half of it is left for new data.
+ */
+static bool_t
+compact_out (RECSTREAM * rstrm)
+{
+  ptrdiff_t shift = rstrm->out_sent - rstrm->out_base;
+  u_int size;
+  char *buf;
+  char *buf_algn;
+
+  if (rstrm->out_sent != (caddr_t) (void *) rstrm->frag_header)
+    shift &= ~(ptrdiff_t) (BYTES_PER_XDR_UNIT - 1);
+  if (shift != 0)
+    {
+      memmove (rstrm->out_sent - shift, rstrm->out_sent,
+               rstrm->out_finger - rstrm->out_sent);
+      rstrm->out_sent -= shift;
+      rstrm->out_finger -= shift;
+      rstrm->frag_header = (u_int32_t *) (void *)
+                           ((caddr_t) (void *) rstrm->frag_header - shift);
+    }
+  if (!rstrm->nonblock ||
+      rstrm->out_boundry - rstrm->out_finger >= (ptrdiff_t) rstrm->sendsize / 2)
+    return TRUE;
+
+  size = rstrm->sendsize * 2;
+  if (size >= (u_int) INT_MAX)
+    return FALSE;
+  buf = realloc (rstrm->out_buffer, (size_t) (size + BYTES_PER_XDR_UNIT));
+  if (buf == NULL)
+    return FALSE;
+  for (buf_algn = buf;
+       (long) buf_algn % BYTES_PER_XDR_UNIT != 0; buf_algn++)
+    ;
+  shift = buf_algn - rstrm->out_base;
+  rstrm->out_sent += shift;
+  rstrm->out_finger += shift;
+  rstrm->frag_header = (u_int32_t *) (void *)
+                       ((caddr_t) (void *) rstrm->frag_header + shift);
+  rstrm->out_base = buf_algn;
+  rstrm->out_buffer = buf;
+  rstrm->out_boundry = buf_algn + size;
+  rstrm->sendsize = size;
   return TRUE;
 }
 
@@ -892,9 +1061,11 @@ realloc_stream (RECSTREAM * rstrm,
         ;
       diff = buf_algn - rstrm->in_base;
       rstrm->in_finger += diff;
+      rstrm->in_boundry += diff;
+      rstrm->in_start += diff;
+      rstrm->in_end += diff;
       rstrm->in_base = buf_algn;
       rstrm->in_buffer = buf;
-      rstrm->in_boundry = buf_algn + size;
       rstrm->recvsize = size;
       rstrm->in_size = size;
     }
@@ -902,3 +1073,23 @@ realloc_stream (RECSTREAM * rstrm,
   return TRUE;
 }
 
+/*
+ * Move the record being assembled on a non-block stream, and what was
+ * read after it, to the front of the input buffer.  The record handed
+ * out before is dropped.
+ */
+static void
+compact_in (RECSTREAM * rstrm)
+{
+  ptrdiff_t shift = rstrm->in_start - rstrm->in_base;
+
+  if (shift != 0)
+    {
+      memmove (rstrm->in_base, rstrm->in_start,
+               rstrm->in_end - rstrm->in_start);
+      rstrm->in_start -= shift;
+      rstrm->in_end -= shift;
+    }
+  rstrm->in_finger = rstrm->in_boundry = rstrm->in_base;
+  rstrm->fbtbc = 0;
+}
@@ -0,0 +1,46 @@
+/* Double-precision acos function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "invtrig.h"
+
+#define PI_HI (2.0 * PIO2_HI)
+
+/* The algorithm of e_acos.c with the polynomial of asin: acos (x) =
+   pi/2 - asin (x) for |x| < 0.5, otherwise acos (x) = 2 * asin (s) and
+   acos (-x) = pi - 2 * asin (s) with s = sqrt ((1 - |x|) / 2).  Worst-case
+   error is about 0.7 ULP.  */
+double
+acos (double x)
+{
+  uint32_t ix = abstop32 (x);
+  double z, s, r, f, c;
+
+  if (ix < 0x3fe00000)
+    {
+      if (unlikely (ix <= 0x3c600000))
+	return PIO2_HI + PIO2_LO;
+      z = x * x;
+      r = z * asin_poly (z);
+      return PIO2_HI - (x - (PIO2_LO - x * r));
+    }
+  if (unlikely (ix >= 0x3ff00000))
+    {
+      if (ix == 0x3ff00000 && (uint32_t) asuint64 (x) == 0)
+	return x > 0 ? 0.0 : PI_HI + 2.0 * PIO2_LO;
+      return __math_invalid (x);
+    }
+  z = (1.0 - asdouble (asuint64 (x) & 0x7fffffffffffffff)) * 0.5;
+  s = sqrt_inline (z);
+  r = z * asin_poly (z);
+  if (x < 0)
+    return PI_HI - 2.0 * (s + (r * s - PIO2_LO));
+  /* s = f + c to twice the precision.  */
+  f = trunc32 (s);
+  c = (z - f * f) / (s + f);
+  return 2.0 * (f + (r * s + c));
+}
+
+#endif /* !__OBSOLETE_MATH */
@@ -0,0 +1,32 @@
+/* Single-precision acos function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "invtrig.h"
+
+/* acos (x) = pi/2 - asin (x) for |x| < 0.5, otherwise acos (x) =
+   2 * asin (s) and acos (-x) = pi - 2 * asin (s) with
+   s = sqrt ((1 - |x|) / 2), with the polynomial of asinf and computed in
+   double precision.  Worst-case error is about 0.51 ULP.  */
+float
+acosf (float x)
+{
+  uint32_t ia = asuint (x) & 0x7fffffff;
+  double z, s;
+
+  if (ia < 0x3f000000)
+    {
+      z = (double) x * x;
+      return PIO2_HI - (x + x * z * asinf_poly (z));
+    }
+  if (unlikely (ia > 0x3f800000))
+    return __math_invalidf (x);
+  z = (1.0 - asfloat (ia)) * 0.5;
+  s = sqrt_inline (z);
+  s += s * z * asinf_poly (z);
+  return x < 0 ? 2.0 * PIO2_HI - 2.0 * s : 2.0 * s;
+}
+
+#endif /* !__OBSOLETE_MATH */
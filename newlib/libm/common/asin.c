@@ -0,0 +1,59 @@
+/* Double-precision asin function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "invtrig.h"
+
+#define PIO4_HI (0.5 * PIO2_HI)
+
+/* The algorithm of e_asin.c, with its rational approximation replaced by
+   a polynomial: asin (x) = x + x * z * P (z) with z = x * x for |x| < 0.5,
+   otherwise asin (|x|) = pi/2 - 2 * (s + s * z * P (z)) with
+   z = (1 - |x|) / 2 and s = sqrt (z).  Worst-case error is about
+   0.7 ULP.  */
+double
+asin (double x)
+{
+  uint32_t ix = abstop32 (x);
+  double z, s, r, f, c, p, q, y;
+
+  if (ix < 0x3fe00000)
+    {
+      if (unlikely (ix < 0x3e500000))
+	{
+	  if (ix < 0x00100000)
+	    /* Force underflow for tiny x.  */
+	    force_eval_double (x * x);
+	  return x;
+	}
+      z = x * x;
+      return x + x * (z * asin_poly (z));
+    }
+  if (unlikely (ix >= 0x3ff00000))
+    {
+      if (ix == 0x3ff00000 && (uint32_t) asuint64 (x) == 0)
+	/* asin (+-1) = +-pi/2 with inexact.  */
+	return x * PIO2_HI + x * PIO2_LO;
+      return __math_invalid (x);
+    }
+  z = (1.0 - asdouble (asuint64 (x) & 0x7fffffffffffffff)) * 0.5;
+  s = sqrt_inline (z);
+  r = z * asin_poly (z);
+  if (ix >= 0x3fef3333)
+    /* |x| > 0.975: the rounding error of s is small enough.  */
+    y = PIO2_HI - (2.0 * (s + s * r) - PIO2_LO);
+  else
+    {
+      /* s = f + c to twice the precision, and pi/4 - 2 * f is exact.  */
+      f = trunc32 (s);
+      c = (z - f * f) / (s + f);
+      p = 2.0 * s * r - (PIO2_LO - 2.0 * c);
+      q = PIO4_HI - 2.0 * f;
+      y = PIO4_HI - (p - q);
+    }
+  return asdouble (asuint64 (y) | (asuint64 (x) & 0x8000000000000000));
+}
+
+#endif /* !__OBSOLETE_MATH */
@@ -0,0 +1,41 @@
+/* Single-precision asin function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "invtrig.h"
+
+/* asin (x) = x + x * z * P (z) with z = x * x for |x| < 0.5, otherwise
+   asin (|x|) = pi/2 - 2 * (s + s * z * P (z)) with z = (1 - |x|) / 2 and
+   s = sqrt (z), computed in double precision so that none of the
+   corrections of the double variant are needed.  Worst-case error is about
+   0.51 ULP.  */
+float
+asinf (float x)
+{
+  uint32_t ix = asuint (x);
+  uint32_t ia = ix & 0x7fffffff;
+  double z, s, y;
+
+  if (ia < 0x3f000000)
+    {
+      if (unlikely (ia < 0x39800000))
+	{
+	  if (ia < 0x00800000)
+	    /* Force underflow for tiny x.  */
+	    force_eval_float (x * x);
+	  return x;
+	}
+      z = (double) x * x;
+      return x + x * z * asinf_poly (z);
+    }
+  if (unlikely (ia > 0x3f800000))
+    return __math_invalidf (x);
+  z = (1.0 - asfloat (ia)) * 0.5;
+  s = sqrt_inline (z);
+  y = PIO2_HI - 2.0 * (s + s * z * asinf_poly (z));
+  return ix >> 31 ? (float) -y : (float) y;
+}
+
+#endif /* !__OBSOLETE_MATH */
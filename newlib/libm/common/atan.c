@@ -0,0 +1,55 @@
+/* Double-precision atan function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "invtrig.h"
+
+/* Table based atan.  For |x| in [2^-5, 2^6) atan (x) = atan (c) +
+   atan (t) with t = (x - c) / (1 + x * c), where c is the middle of the
+   interval of x with 3 leading mantissa bits and x - c is exact, so
+   |t| <= 2^-5 and a short polynomial is enough.  Smaller |x| use the
+   polynomial directly and larger ones atan (x) = pi/2 - atan (1/x).
+   Worst-case error is about 0.6 ULP.  */
+double
+atan (double x)
+{
+  uint64_t ix = asuint64 (x);
+  uint64_t sign = ix & 0x8000000000000000;
+  uint32_t e = (ix >> 52) & 0x7ff;
+  double ax = asdouble (ix ^ sign);
+  double c, t, u, z, y;
+  int i;
+
+  if (likely (e - ATAN_TAB_MIN < ATAN_TAB_MAX - ATAN_TAB_MIN))
+    {
+      i = atan_tab_index (ax, &c);
+      t = (ax - c) / (1.0 + ax * c);
+      y = AT[i].hi + (t + (atan_poly (t, t * t) + AT[i].lo));
+    }
+  else if (e < ATAN_TAB_MIN)
+    {
+      if (unlikely (e < 0x3ff - 27))
+	{
+	  if (e == 0)
+	    /* Force underflow for tiny x.  */
+	    force_eval_double (x * x);
+	  return x;
+	}
+      y = ax + atan_poly (ax, ax * ax);
+    }
+  else if (e < 0x3ff + 54)
+    {
+      u = 1.0 / ax;
+      z = u * u;
+      y = PIO2_HI - (u - (PIO2_LO - atan_poly (u, z)));
+    }
+  else if (e == 0x7ff && (ix << 12) != 0)
+    return x + x;
+  else
+    y = PIO2_HI + PIO2_LO;
+  return asdouble (asuint64 (y) ^ sign);
+}
+
+#endif /* !__OBSOLETE_MATH */
@@ -0,0 +1,139 @@
+/* Double-precision atan2 function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "invtrig.h"
+
+#define PI_HI (2.0 * PIO2_HI)
+#define PI_LO (2.0 * PIO2_LO)
+
+/* 0, pi/2, pi and pi/2 as hi + lo.  */
+static const double Off[4][2] = {
+  {0.0, 0.0},
+  {0x1.921fb54442d18p+0, 0x1.1a62633145c07p-54},
+  {0x1.921fb54442d18p+1, 0x1.1a62633145c07p-53},
+  {0x1.921fb54442d18p+0, 0x1.1a62633145c07p-54},
+};
+
+/* Zero, infinite or NaN arguments.  */
+static inline double
+specialcase (double y, double x, uint64_t ix, uint64_t iy)
+{
+  uint64_t iax = ix & 0x7fffffffffffffff;
+  uint64_t iay = iy & 0x7fffffffffffffff;
+  double r;
+
+  if (iax > 0x7ff0000000000000 || iay > 0x7ff0000000000000)
+    return x + y;
+  if (iay == 0)
+    {
+      /* atan2 (+-0, +x) = +-0 and atan2 (+-0, -x) = +-pi.  */
+      if ((ix >> 63) == 0)
+	return y;
+      r = PI_HI + PI_LO;
+    }
+  else if (iax == 0x7ff0000000000000)
+    {
+      if (iay == 0x7ff0000000000000)
+	r = ix >> 63 ? 0x1.2d97c7f3321d2p+1 : 0.5 * PIO2_HI + 0.5 * PIO2_LO;
+      else
+	r = ix >> 63 ? PI_HI + PI_LO : 0.0;
+    }
+  else
+    /* x is zero or y is infinite.  */
+    r = PIO2_HI + PIO2_LO;
+  return asdouble (asuint64 (r) | (iy & 0x8000000000000000));
+}
+
+/* A - R * B, where R = A / B rounded, to about 2^-25 relative precision.  */
+static inline double
+residual (double a, double r, double b)
+{
+#if HAVE_FAST_FMA
+  return fma (-r, b, a);
+#else
+  double rh = asdouble (asuint64 (r) & 0xfffffffff8000000);
+  double bh = asdouble (asuint64 (b) & 0xfffffffff8000000);
+
+  /* The first subtraction is exact.  */
+  return (a - rh * bh) - (rh * (b - bh) + (r - rh) * b);
+#endif
+}
+
+/* atan (a / b) for 0 < a <= b is computed like atan, but the quotient
+   r = a / b is only used to select c and t is computed directly as
+   (a - c * b) / (b + c * a), so the rounding error of r does not add to
+   the error of the result.  Below the table r is corrected by the
+   residual a - r * b instead.  The angle is then moved to the right
+   quadrant by adding a multiple of pi/2, with the rounding error of that
+   addition kept.  Worst-case error is about 0.6 ULP.  */
+double
+atan2 (double y, double x)
+{
+  uint64_t ix = asuint64 (x);
+  uint64_t iy = asuint64 (y);
+  uint64_t iax = ix & 0x7fffffffffffffff;
+  uint64_t iay = iy & 0x7fffffffffffffff;
+  uint64_t sign;
+  double a, b, bh, r, c, t, hi, lo, sum;
+  uint32_t ea, eb;
+  int k, i;
+
+  if (unlikely (iax - 1 >= 0x7ff0000000000000 - 1
+		|| iay - 1 >= 0x7ff0000000000000 - 1))
+    return specialcase (y, x, ix, iy);
+
+  /* a <= b, and k selects one of atan (a/b), pi/2 - atan (a/b),
+     pi - atan (a/b) and pi/2 + atan (a/b).  */
+  k = ((ix >> 62) & 2) | (iay > iax);
+  a = asdouble (iay > iax ? iax : iay);
+  b = asdouble (iay > iax ? iay : iax);
+  ea = asuint64 (a) >> 52;
+  eb = asuint64 (b) >> 52;
+  if (unlikely (eb - ea > 60))
+    {
+      /* a/b < 2^-59 is the result up to a rounding error below 2^-118.  */
+      hi = a / b;
+      lo = 0.0;
+    }
+  else
+    {
+      if (unlikely (ea < 0x3ff - 960 || eb > 0x3ff + 960))
+	{
+	  /* Keep the residual and b + c * a in range.  */
+	  double s = ea < 0x3ff - 960 ? 0x1p600 : 0x1p-600;
+	  a *= s;
+	  b *= s;
+	}
+      r = a / b;
+      if (asuint64 (r) >> 52 < ATAN_TAB_MIN)
+	{
+	  hi = r;
+	  lo = residual (a, r, b) / b + atan_poly (r, r * r);
+	}
+      else
+	{
+	  /* r only selects c, which has 5 significant bits, so c * bh and
+	     c * (b - bh) are exact when bh has 48, and a - c * bh is exact
+	     as well.  */
+	  i = atan_tab_index (r, &c);
+	  bh = asdouble (asuint64 (b) & -32ULL);
+	  t = ((a - c * bh) - c * (b - bh)) / (b + c * a);
+	  hi = AT[i].hi;
+	  lo = t + (atan_poly (t, t * t) + AT[i].lo);
+	}
+    }
+
+  /* Negate the angle for k = 1 and k = 2 and add the offset.  */
+  sign = (uint64_t) ((k ^ (k >> 1)) & 1) << 63;
+  hi = asdouble (asuint64 (hi) ^ sign);
+  lo = asdouble (asuint64 (lo) ^ sign);
+  sum = Off[k][0] + hi;
+  /* |hi| <= pi/4, so this is the exact rounding error of the sum.  */
+  lo += (Off[k][0] - sum + hi) + Off[k][1];
+  return asdouble (asuint64 (sum + lo) ^ (iy & 0x8000000000000000));
+}
+
+#endif /* !__OBSOLETE_MATH */
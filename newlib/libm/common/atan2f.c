@@ -0,0 +1,73 @@
+/* Single-precision atan2 function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "invtrig.h"
+
+/* Zero, infinite or NaN arguments.  */
+static inline float
+specialcase (float y, float x, uint32_t ix, uint32_t iy)
+{
+  uint32_t iax = ix & 0x7fffffff;
+  uint32_t iay = iy & 0x7fffffff;
+  float r;
+
+  if (iax > 0x7f800000 || iay > 0x7f800000)
+    return x + y;
+  if (iay == 0)
+    {
+      /* atan2f (+-0, +x) = +-0 and atan2f (+-0, -x) = +-pi.  */
+      if ((ix >> 31) == 0)
+	return y;
+      r = 0x1.921fb6p+1f;
+    }
+  else if (iax == 0x7f800000)
+    {
+      if (iay == 0x7f800000)
+	r = ix >> 31 ? 0x1.2d97c8p+1f : 0x1.921fb6p-1f;
+      else
+	r = ix >> 31 ? 0x1.921fb6p+1f : 0.0f;
+    }
+  else
+    /* x is zero or y is infinite.  */
+    r = 0x1.921fb6p+0f;
+  return asfloat (asuint (r) | (iy & 0x80000000));
+}
+
+/* atan of the quotient of the smaller and the larger magnitude, computed in
+   double precision like atanf, then moved to the right quadrant.
+   Worst-case error is about 0.51 ULP.  */
+float
+atan2f (float y, float x)
+{
+  uint32_t ix = asuint (x);
+  uint32_t iy = asuint (y);
+  uint32_t iax = ix & 0x7fffffff;
+  uint32_t iay = iy & 0x7fffffff;
+  double a, b, r, c, t, z;
+  int i;
+
+  if (unlikely (iax - 1 >= 0x7f800000 - 1 || iay - 1 >= 0x7f800000 - 1))
+    return specialcase (y, x, ix, iy);
+
+  a = asfloat (iay > iax ? iax : iay);
+  b = asfloat (iay > iax ? iay : iax);
+  r = a / b;
+  if (r < 0x1p-5)
+    z = r + atanf_poly (r, r * r);
+  else
+    {
+      i = atan_tab_index (r, &c);
+      t = (r - c) / (1.0 + r * c);
+      z = AT[i].hi + (t + atanf_poly (t, t * t));
+    }
+  if (iay > iax)
+    z = PIO2_HI - z;
+  if (ix >> 31)
+    z = 2.0 * PIO2_HI - z;
+  return iy >> 31 ? (float) -z : (float) z;
+}
+
+#endif /* !__OBSOLETE_MATH */
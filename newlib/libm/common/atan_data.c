@@ -0,0 +1,113 @@
+/* Data for atan, atan2, atanf and atan2f.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "math_config.h"
+
+const struct atan_data __atan_data = {
+.pio2_hi = 0x1.921fb54442d18p+0,
+.pio2_lo = 0x1.1a62633145c07p-54,
+// Coefficients of atan(t) ~= t + t*z*poly(z), z = t*t, for |t| <= 2^-5.
+// Relative error: 2^-62.1
+.poly = {
+-0x1.55555555554eep-2,
+0x1.99999997a1aeap-3,
+-0x1.2492315b9cfa7p-3,
+0x1.c639dd0bf5cfp-4,
+},
+// tab[i] = atan(c) rounded to hi + lo, where c = 2^e * (1 + (j + 0.5)/8)
+// is the middle of the interval of x with i = 8*(e+5) + j.
+.tab = {
+{0x1.0fe66da9b94eep-5, -0x1.164e77d4eb175p-60},
+{0x1.2fdc4e3737dddp-5, -0x1.1e5e438d0ba04p-59},
+{0x1.4fcfd072dff79p-5, 0x1.6d85bec38d078p-59},
+{0x1.6fc0b4f27d5bbp-5, 0x1.119ab07e9c009p-62},
+{0x1.8faebc6b17abap-5, 0x1.adf473cc8d797p-59},
+{0x1.af99a7b3dd42fp-5, 0x1.a756ffaab786ep-59},
+{0x1.cf8137c90a177p-5, 0x1.e0567596f063fp-59},
+{0x1.ef652dceca4dcp-5, -0x1.4eb116f8ea623p-61},
+{0x1.0f99ea71d52a7p-4, -0x1.2069feec3624fp-61},
+{0x1.2f719318a4a9ap-4, 0x1.3fd1779b9801fp-63},
+{0x1.4f3fd677292fbp-4, 0x1.008d36264979ep-59},
+{0x1.6f03bdcea4b0dp-4, -0x1.3f00e512fa17dp-60},
+{0x1.8ebc54478fb28p-4, 0x1.732880cad24ccp-59},
+{0x1.ae68a71c722b8p-4, 0x1.c014e6910b9dbp-59},
+{0x1.ce07c5c3cca32p-4, 0x1.138e6425918a7p-59},
+{0x1.ed98c2190043bp-4, -0x1.3a598592c7b13p-61},
+{0x1.0e6adccf40882p-3, -0x1.d71a31bb98d0dp-57},
+{0x1.2dcbdb2fba1ffp-3, 0x1.8f28705561534p-58},
+{0x1.4d087a9da4f17p-3, 0x1.1f323f1adf158p-57},
+{0x1.6c1d4898933d9p-3, -0x1.2954a7603c427p-58},
+{0x1.8b06ee2879c29p-3, -0x1.118cd30308c4fp-57},
+{0x1.a9c231b403279p-3, 0x1.0e8bbe89cca85p-57},
+{0x1.c84bf8a742e6ep-3, -0x1.95bdd0682ea26p-58},
+{0x1.e6a148e96ec4dp-3, 0x1.866b22029f765p-57},
+{0x1.09dc597d86362p-2, 0x1.62e47390cb865p-56},
+{0x1.278372057ef46p-2, -0x1.077cdd36dfc81p-56},
+{0x1.44aa436c2af0ap-2, -0x1.5d5e43c55b3bap-56},
+{0x1.614840309cfe2p-2, -0x1.a725715711fp-56},
+{0x1.7d5604b63b3f7p-2, 0x1.69c885c2b249ap-56},
+{0x1.98cd5454d6b18p-2, 0x1.9e6c988fd0a77p-56},
+{0x1.b3a911da65c6cp-2, 0x1.ae187b1ca504p-56},
+{0x1.cde53432c1351p-2, -0x1.a2cfa4418f1adp-56},
+{0x1.f40dd0b541418p-2, -0x1.a3992dc382a23p-57},
+{0x1.1255d9bfbd2a9p-1, -0x1.2bdaee1c0ee35p-58},
+{0x1.2958e59308e31p-1, -0x1.09e73b0c6c087p-56},
+{0x1.3f13fb89e96f4p-1, 0x1.ecf8b492644fp-56},
+{0x1.538f57b89061fp-1, -0x1.1bb74abda520cp-55},
+{0x1.66d663923e087p-1, -0x1.6ea6febe8bbbap-56},
+{0x1.78f6bbd5d315ep-1, 0x1.406a08980374p-55},
+{0x1.89ff5ff57f1f8p-1, -0x1.55b9a5e177a1bp-55},
+{0x1.a1a25f2c82506p-1, -0x1.8b4c3611182fcp-57},
+{0x1.bde70ed439fe7p-1, -0x1.a2b56372c05efp-56},
+{0x1.d6e57cf4f0acap-1, -0x1.763b9456ae66ep-55},
+{0x1.ed0d97c9041c9p-1, -0x1.2629e3b5da49p-58},
+{0x1.006132e34d617p+0, 0x1.b343dfa868d93p-54},
+{0x1.092ce471853ccp+0, 0x1.269f9b3e200c2p-55},
+{0x1.110eb007f39f7p+0, -0x1.12b2ff85e55p-54},
+{0x1.1825f074030d9p+0, -0x1.9523f0af0d3b5p-58},
+{0x1.21862f3fade36p+0, 0x1.4887628d68748p-54},
+{0x1.2c1a241d66dc3p+0, 0x1.82b2d58b6a8e9p-54},
+{0x1.34f1fbb19eb09p+0, 0x1.80d79b4cf61d5p-55},
+{0x1.3c6e650b38047p+0, 0x1.6b63b358e746dp-54},
+{0x1.42d70411f9ec1p+0, 0x1.2b08db7f10896p-55},
+{0x1.4861b4cfbe71p+0, -0x1.567d3d25932d1p-57},
+{0x1.4d378c1999a0dp+0, -0x1.c857a639541c8p-57},
+{0x1.51784fa1544bap+0, -0x1.236e3c857c019p-54},
+{0x1.56f6f33a3e6a7p+0, -0x1.df6edd6f1ec3bp-56},
+{0x1.5d013c41adabdp+0, 0x1.f82bba194dd5dp-54},
+{0x1.61f06c6a92b89p+0, -0x1.487d50bceb1a5p-55},
+{0x1.660b02c736a06p+0, -0x1.acb6afb332a0fp-56},
+{0x1.698213a9d5053p+0, -0x1.b9839085189e3p-54},
+{0x1.6c78c7edeb195p+0, 0x1.9239ad620ffe2p-54},
+{0x1.6f08f07435fecp+0, -0x1.957a7170df016p-55},
+{0x1.7145eac2088a4p+0, -0x1.fda5797b32a0bp-54},
+{0x1.7424de90454d4p+0, -0x1.3a75d182e1a5fp-54},
+{0x1.77467e364f601p+0, -0x1.bfda44f3537b8p-54},
+{0x1.79d0f3fad1c92p+0, 0x1.38727dc4fb7d1p-55},
+{0x1.7beb396c5699ap+0, -0x1.3dc969c7e2365p-55},
+{0x1.7daff85a63058p+0, 0x1.1ee9bcca84eb2p-54},
+{0x1.7f320a0f9f587p+0, 0x1.38dbb20936502p-56},
+{0x1.807f2112987c7p+0, 0x1.178e474ec8c66p-54},
+{0x1.81a16e43f190bp+0, -0x1.e6b0733383ad4p-54},
+{0x1.831516233f561p+0, -0x1.7927ffec5f9dcp-54},
+{0x1.84a99fe25186bp+0, 0x1.494c8619d0bbcp-54},
+{0x1.85f14d43d81bep+0, 0x1.bf8770a76afafp-58},
+{0x1.87001c35928d4p+0, -0x1.b4ba860ada728p-54},
+{0x1.87e3aa32878aep+0, -0x1.9b0e3c3bbc6cfp-54},
+{0x1.88a58ec949d14p+0, 0x1.b07443dd06ad8p-54},
+{0x1.894cbdb6bedfcp+0, -0x1.ffb5195f35c01p-60},
+{0x1.89de605acdbb3p+0, -0x1.e2ac570eac042p-54},
+{0x1.8a98bbf307aa8p+0, -0x1.d90abd3cb737ap-54},
+{0x1.8b63797517bb5p+0, -0x1.bf3ab273b6cep-55},
+{0x1.8c079f3350d26p+0, 0x1.838f674c6574dp-54},
+{0x1.8c8f3c9e38564p+0, 0x1.f0c61f67df753p-54},
+{0x1.8d0129acd6d1cp+0, 0x1.66034aec68494p-55},
+{0x1.8d623796f0778p+0, 0x1.db4574d87445p-54},
+{0x1.8db5e3944965ep+0, 0x1.ddf03d7d94a94p-54},
+{0x1.8dfec478573ap+0, 0x1.48a5f6312c3fap-54},
+},
+};
+#endif /* !__OBSOLETE_MATH */
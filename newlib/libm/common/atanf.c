@@ -0,0 +1,50 @@
+/* Single-precision atan function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "invtrig.h"
+
+/* atan with the table of the double variant and a shorter polynomial,
+   computed in double precision.  Worst-case error is about 0.51 ULP.  */
+float
+atanf (float x)
+{
+  uint32_t ix = asuint (x);
+  uint32_t ia = ix & 0x7fffffff;
+  double ax = asfloat (ia);
+  double c, t, u, y;
+  int i;
+
+  /* 2^-5 <= |x| < 2^6.  */
+  if (likely (ia - 0x3d000000 < 0x42800000 - 0x3d000000))
+    {
+      i = atan_tab_index (ax, &c);
+      t = (ax - c) / (1.0 + ax * c);
+      y = AT[i].hi + (t + atanf_poly (t, t * t));
+    }
+  else if (ia < 0x3d000000)
+    {
+      if (unlikely (ia < 0x39800000))
+	{
+	  if (ia < 0x00800000)
+	    /* Force underflow for tiny x.  */
+	    force_eval_float (x * x);
+	  return x;
+	}
+      y = ax + atanf_poly (ax, ax * ax);
+    }
+  else if (ia < 0x4c800000)
+    {
+      u = 1.0 / ax;
+      y = PIO2_HI - (u + atanf_poly (u, u * u));
+    }
+  else if (ia > 0x7f800000)
+    return x + x;
+  else
+    y = PIO2_HI;
+  return ix >> 31 ? (float) -y : (float) y;
+}
+
+#endif /* !__OBSOLETE_MATH */
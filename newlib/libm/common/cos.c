@@ -0,0 +1,38 @@
+/* Double-precision cosine function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "sincos.h"
+
+/* Polynomial based cos, with the range reduction of sin.  */
+double
+cos (double x)
+{
+  double y, tail, r[2];
+  uint32_t ix = abstop32 (x);
+  int n;
+
+  if (ix <= TOP_PIO4)
+    {
+      if (unlikely (ix < TOP_TINY))
+	return 1.0;
+      return sincos_poly (x, 0.0, 1);
+    }
+  if (likely (ix < TOP_FAST))
+    y = reduce_pio2 (x, &tail, &n);
+  else if (ix < 0x7ff00000)
+    {
+      n = __ieee754_rem_pio2 (x, r);
+      y = r[0];
+      tail = r[1];
+    }
+  else
+    return __math_invalid (x);
+
+  /* cos (x) = sin (x + pi/2).  */
+  return sincos_poly (y, tail, n + 1);
+}
+
+#endif /* !__OBSOLETE_MATH */
@@ -0,0 +1,40 @@
+/* Double-precision cosh function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "hyperbolic.h"
+
+/* Up to 22, e^|x| and e^-|x| are both computed to about 2^-60 relative
+   precision with the tables of exp and added without rounding error, which
+   replaces the expm1 and exp calls of e_cosh.c.  Above 709 e^|x| / 2 is
+   formed without overflow by exp_half_big.  Worst-case error is about
+   0.52 ULP.  */
+double
+cosh (double x)
+{
+  uint32_t abstop = (asuint64 (x) >> 52) & 0x7ff;
+  double ax = asdouble (asuint64 (x) & 0x7fffffffffffffff);
+  double e, el, f, fl, s;
+
+  if (likely (ax < 22.0))
+    {
+      e = exp_hilo (ax, &el);
+      f = exp_hilo (-ax, &fl);
+      s = e + f;
+      return 0.5 * (s + ((e - s + f) + (el + fl)));
+    }
+  if (ax < 709.0)
+    {
+      e = exp_hilo (ax, &el);
+      return 0.5 * (e + el);
+    }
+  if (ax <= 0x1.633ce8fb9f87dp+9)
+    return check_oflow (exp_half_big (ax));
+  if (abstop == 0x7ff)
+    return x * x;
+  return __math_oflow (0);
+}
+
+#endif /* !__OBSOLETE_MATH */
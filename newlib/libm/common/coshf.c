@@ -0,0 +1,30 @@
+/* Single-precision cosh function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "hyperbolic.h"
+
+/* cosh (x) = (e^x + e^-x) / 2 computed in double precision with the
+   tables of exp.  Worst-case error is about 0.51 ULP.  */
+float
+coshf (float x)
+{
+  uint32_t ia = asuint (x) & 0x7fffffff;
+  double ax = asfloat (ia);
+  double e, el, f, fl;
+
+  /* The result overflows above log (2 * FLT_MAX).  */
+  if (likely (ia <= 0x42b2d4fc))
+    {
+      e = exp_hilo (ax, &el);
+      f = exp_hilo (-ax, &fl);
+      return 0.5 * ((e + f) + (el + fl));
+    }
+  if (ia >= 0x7f800000)
+    return x * x;
+  return __math_oflowf (0);
+}
+
+#endif /* !__OBSOLETE_MATH */
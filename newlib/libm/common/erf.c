@@ -0,0 +1,131 @@
+/* Double-precision error function and its complement.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "gamma.h"
+
+#define ONE_BOUND 0x1.7afb48dc96627p+2
+#define UFLOW_BOUND 0x1.b39dc41e48bfcp+4
+
+/* Return erfc (X) for 0.375 <= X < UFLOW_BOUND as g (x) * e^-x^2, where
+   g has a table of polynomials up to 6.125 and an asymptotic expansion in
+   1/x^2 above.  Both factors and their product keep a low part, so the
+   result is rounded once, except in the subnormal range.  */
+static inline double
+erfc_large (double x)
+{
+  double gh, gl, p, q, r, rl, x2, x2l, e, el, hi, lo, sl;
+  int i;
+
+  if (x < 6.125)
+    {
+      const double *c;
+
+      i = (x - 0.375) * 4;
+      c = __erf_data.erfc_tab[i];
+      p = erf_tab_poly (c, x - (i * 0.25 + 0.5));
+      gh = c[0] + p;
+      gl = c[0] - gh + p;
+    }
+  else
+    {
+      const double *c = __erf_data.asym;
+
+      p = erfc_asym_poly (1.0 / (x * x));
+      q = c[0] + p;
+      /* g = q / x with one correction step.  */
+      gh = q / x;
+      r = mul_hilo (gh, x, &rl);
+      gl = ((q - r) - rl + (c[0] - q + p)) / x;
+    }
+
+  x2 = mul_hilo (x, x, &x2l);
+  if (likely (x2 < 700.0))
+    {
+      e = exp_hilo_tail (-x2, -x2l, &el);
+      hi = mul_hilo (e, gh, &lo);
+      return hi + (lo + el * gh + e * gl);
+    }
+  /* Scale by 2^512 to stay in the range of exp_hilo_tail.  */
+  x2 = add_hilo (-x2, LN2X512_HI, &sl);
+  e = exp_hilo_tail (x2, sl + (LN2X512_LO - x2l), &el);
+  hi = mul_hilo (e, gh, &lo);
+  return check_uflow ((hi + (lo + el * gh + e * gl)) * 0x1p-512);
+}
+
+/* Below 0.625 erf (x) = x + x * poly (x^2).  Up to 6.125 a table of
+   polynomials around the middles of intervals of width 1/4 gives erf and
+   e^x^2 * erfc (x), and erfc above uses an asymptotic expansion in 1/x^2.
+   Worst-case error is about 0.85 ULP for erf and 0.75 ULP for erfc.  */
+double
+erf (double x)
+{
+  uint64_t ix = asuint64 (x);
+  uint64_t ia = ix & 0x7fffffffffffffff;
+  double ax, y, c0;
+
+  if (ia < asuint64 (0.625))
+    {
+      if (unlikely (ia < asuint64 (0x1p-28)))
+	{
+	  /* Scaled to avoid spurious underflow for subnormal x.  */
+	  if (ia < 0x0010000000000000)
+	    return 0.125 * (8.0 * x + (8.0 * __erf_data.poly[0]) * x);
+	  return x + __erf_data.poly[0] * x;
+	}
+      return x + erf_small (x);
+    }
+  if (unlikely (ia >= asuint64 (ONE_BOUND)))
+    {
+      if (ia > 0x7ff0000000000000)
+	return x + x;
+      /* Rounds to +-1, inexact unless x is infinite.  */
+      y = ia == 0x7ff0000000000000 ? 1.0 : 1.0 - 0x1p-1022;
+      return (ix >> 63) ? -y : y;
+    }
+  ax = asdouble (ia);
+  y = erf_mid (ax, &c0);
+  y = c0 + y;
+  return (ix >> 63) ? -y : y;
+}
+
+double
+erfc (double x)
+{
+  uint64_t ix = asuint64 (x);
+  uint64_t ia = ix & 0x7fffffffffffffff;
+  double hi, e, c0, p;
+
+  if (ix < asuint64 (0.375) || (ix >> 63 && ia < asuint64 (0.625)))
+    {
+      /* 1 - x - small (x), with no cancellation in the last step.  */
+      if (unlikely (ia < asuint64 (0x1p-56)))
+	return 1.0 - x;
+      hi = add_hilo (1.0, -x, &e);
+      return hi + (e - erf_small (x));
+    }
+  if ((ix >> 63) == 0)
+    {
+      if (unlikely (ia >= asuint64 (UFLOW_BOUND)))
+	{
+	  if (ia >= 0x7ff0000000000000)
+	    return ia == 0x7ff0000000000000 ? 0.0 : x + x;
+	  return __math_uflow (0);
+	}
+      return erfc_large (x);
+    }
+  if (unlikely (ia >= asuint64 (ONE_BOUND)))
+    {
+      if (ia > 0x7ff0000000000000)
+	return x + x;
+      return ia == 0x7ff0000000000000 ? 2.0 : 2.0 - 0x1p-1022;
+    }
+  /* 1 + erf (-x).  */
+  p = erf_mid (-x, &c0);
+  hi = add_hilo (1.0, c0, &e);
+  return hi + (e + p);
+}
+
+#endif /* !__OBSOLETE_MATH */
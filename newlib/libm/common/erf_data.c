@@ -0,0 +1,368 @@
+/* Data for erf, erfc, erff and erfcf.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "math_config.h"
+
+const struct erf_data __erf_data = {
+// erf(x) ~= x + x*poly(z), z = x*x, for |x| < 0.625.
+// Relative error: 2^-55.3
+.poly = {
+0x1.06eba8214db68p-3,
+-0x1.812746b0379d4p-2,
+0x1.ce2f21a0412ebp-4,
+-0x1.b82ce311bd205p-6,
+0x1.565bccd99edbdp-8,
+-0x1.c02da43df2469p-11,
+0x1.f9a0480b51579p-14,
+-0x1.f47f308a16844p-17,
+0x1.b42cc278787d9p-20,
+-0x1.26a904113e9e1p-23,
+},
+// erf_tab[i] = {c0, q0, ..., q11}: erf(c + t) ~= c0 + q0 + q1*t + ... + q11*t^11
+// for |t| <= 1/8, where c = (i + 3)/4 and c0 is erf(c) rounded.
+// Relative error: 2^-56.6
+.erf_tab = {
+{0x1.6c1c9759d0e5fp-1, 0x1.b82d9414158adp-55,
+ 0x1.492e42d78d2c5p-1, -0x1.edc5644353c65p-2,
+ 0x1.b6e8591f66ddap-6, 0x1.349b5eaa2b018p-3,
+ -0x1.b42a1890a6d9ep-5, -0x1.b8477a2803f85p-6,
+ 0x1.2e0afa9e67ffp-6, 0x1.2db61cfa6e54bp-9,
+ -0x1.040f6edeb54f6p-8, 0x1.7bc28eb9f2292p-13,
+ 0x1.455f9c0ad2b0bp-11},
+{0x1.af767a741088bp-1, -0x1.af616172a25b3p-56,
+ 0x1.a911f096fbc26p-2, -0x1.a911f096fbc9bp-2,
+ 0x1.1b614b0f529d6p-3, 0x1.1b614b0fa825ap-4,
+ -0x1.1b614b0fa47d4p-4, 0x1.2e459fb00c7eap-8,
+ 0x1.f096ff0674bfcp-7, -0x1.390e85ca091bep-8,
+ -0x1.ee348465fc88cp-10, 0x1.3f038bb3d4458p-10,
+ 0x1.6e352858247ep-14},
+{0x1.d8865d98abe01p-1, -0x1.f9786913b4a3p-55,
+ 0x1.e4652fadcb6b2p-3, -0x1.2ebf3dcc9f24ep-2,
+ 0x1.571d01c5c57f9p-3, -0x1.93a9a7ba13a6p-8,
+ -0x1.8281ce0bbbf73p-5, 0x1.5d00034e8a26fp-6,
+ 0x1.db43cfbf78194p-9, -0x1.75667200a5241p-8,
+ 0x1.cc19121ba8a5fp-11, 0x1.9ebb105fea67ap-11,
+ -0x1.50644aeccd5fbp-12},
+{0x1.eea5557137aep-1, -0x1.3d6a9d9a6ff8dp-55,
+ 0x1.e723726b824a9p-4, -0x1.6d5a95d0a1b24p-3,
+ 0x1.1c2a02beb6aebp-3, -0x1.6d5a95d0e3fe5p-5,
+ -0x1.e723726bea804p-7, 0x1.3ca3d7b9ba4ccp-6,
+ -0x1.36d739ad8664fp-8, -0x1.35b0703f4ad86p-9,
+ 0x1.c036dd673cc46p-10, -0x1.76846c60352d5p-14,
+ -0x1.09db420b895fbp-12},
+{0x1.f92d077f8d56dp-1, 0x1.825d5dbec0032p-56,
+ 0x1.b055303221016p-5, -0x1.7a4a8a2bdcd71p-4,
+ 0x1.7148c3d57c25p-4, -0x1.8a0da54340f72p-5,
+ 0x1.b22257de50a3p-8, 0x1.25b379c471c04p-7,
+ -0x1.8d10fc67290bfp-8, 0x1.7eba3ec9bc51fp-11,
+ 0x1.d4d1f234b768cp-11, -0x1.cce38faa0af15p-12,
+ -0x1.b0087428cd488p-18},
+{0x1.fd9ae142795e3p-1, 0x1.96772ac5a2718p-56,
+ 0x1.529b9e8cf9a1fp-6, -0x1.529b9e8cf9a05p-5,
+ 0x1.8b0ae3a4787f1p-5, -0x1.1a2c59757f494p-5,
+ 0x1.ace7404cb3ad6p-7, 0x1.e193611b1ff62p-12,
+ -0x1.bae0ad4475a08p-9, 0x1.a113e8742a0bbp-10,
+ -0x1.a444147e2fb37p-15, -0x1.134e616019f55p-12,
+ 0x1.af828168d942fp-14},
+{0x1.ff404760319b4p-1, 0x1.f435240a4c352p-56,
+ 0x1.d4143a9dfe965p-8, -0x1.074b60f8df41dp-6,
+ 0x1.63ef61e8243f5p-6, -0x1.38a98327625p-6,
+ 0x1.5d3b17bbebca5p-7, -0x1.7cae0e907b5b2p-9,
+ -0x1.5f83143f6aefcp-11, 0x1.06042276fb307p-10,
+ -0x1.835263b102d2fp-12, -0x1.a4479616b1564p-17,
+ 0x1.10e39c808ede9p-14},
+{0x1.ffcaa8f4c9beap-1, 0x1.b1bad700887bep-55,
+ 0x1.1d83170fbf6fbp-9, -0x1.64e3dcd3af6cdp-8,
+ 0x1.119da0c46ce17p-7, -0x1.1a89b97cba5f4p-7,
+ 0x1.90e81283ab511p-8, -0x1.6ecdc03655145p-9,
+ 0x1.1c610db59456ap-11, 0x1.11583ab91a4a4p-12,
+ -0x1.0672ed0dbc451p-12, 0x1.47bfea50aa49ap-14,
+ 0x1.69e44fc97f6acp-18},
+{0x1.fff2cfb0453d9p-1, 0x1.9aa39d8530876p-55,
+ 0x1.3360ccd23db38p-11, -0x1.a6a519a114e16p-10,
+ 0x1.69cf466cce291p-9, -0x1.ab0c273ab330ap-9,
+ 0x1.693596060a269p-9, -0x1.b2755c1de5ccp-10,
+ 0x1.52b62757bfa4ap-11, -0x1.75567880994b1p-14,
+ -0x1.2abe93684a92ap-14, 0x1.cceac5fd010dcp-15,
+ -0x1.075a06c4c7f3fp-16},
+{0x1.fffd1ac4135f9p-1, 0x1.ee7d338692268p-55,
+ 0x1.2408e9ba3327ep-13, -0x1.b60d5e974c4a6p-12,
+ 0x1.9db74b1d1dd8p-11, -0x1.11c85b1ee2c3fp-10,
+ 0x1.0a7b5546ac22cp-10, -0x1.82f234ff908cep-11,
+ 0x1.998b47e1e36b4p-12, -0x1.1aa7375e6c5c2p-13,
+ 0x1.d2a1ef9a3c9f1p-17, 0x1.085ea6f5907b4p-16,
+ -0x1.69eff343ebcfap-17},
+{0x1.ffff6f9f67e55p-1, 0x1.e1c4571d77776p-55,
+ 0x1.e9b5e8d00ce84p-16, -0x1.8de3cd29095c8p-14,
+ 0x1.9aa489e3ca2b5p-13, -0x1.2c7d5ef12592p-12,
+ 0x1.490a4d23a29acp-12, -0x1.1454640a849b4p-12,
+ 0x1.647f713785264p-13, -0x1.5676291b8b089p-14,
+ 0x1.b2c5d75ddb952p-16, -0x1.2c9801b235cf9p-19,
+ -0x1.84728e3461d5cp-19},
+{0x1.ffffe710d565ep-1, 0x1.c9e2cea2eb903p-55,
+ 0x1.6a597219a93f8p-18, -0x1.3d0e43d673075p-16,
+ 0x1.62ccea63c99a8p-15, -0x1.1c07721b8d434p-14,
+ 0x1.586bafcb018b2p-14, -0x1.46153ee735fe1p-14,
+ 0x1.e827f90011f63p-15, -0x1.1f63cf8064addp-15,
+ 0x1.0136a6ed423fap-16, -0x1.360c88eb3ddaep-18,
+ 0x1.cbc5a210b8766p-22},
+{0x1.fffffc2f171e3p-1, 0x1.85ef48c60b18bp-55,
+ 0x1.d9371e2ff7c64p-21, -0x1.bba3ac4cf9ef8p-19,
+ 0x1.0b6a7b0f1a3cbp-17, -0x1.d06f585f5df1p-17,
+ 0x1.3436bca0c03ddp-16, -0x1.4357b5fa1606ep-16,
+ 0x1.110de3d996438p-16, -0x1.75661ebcf1611p-17,
+ 0x1.99f6ecaadae94p-18, -0x1.5df8233e71377p-19,
+ 0x1.9e90be11164dp-21},
+{0x1.ffffff7b91176p-1, 0x1.0b2c6ac6ef39p-56,
+ 0x1.10b1488aeb1fep-23, -0x1.10b1488af42fdp-21,
+ 0x1.603a5308c7ad6p-20, -0x1.4980e24bed689p-19,
+ 0x1.da5f10d9ff841p-19, -0x1.105056fbfe164p-18,
+ 0x1.fd7c673a38788p-19, -0x1.88c44a2251b27p-19,
+ 0x1.f42306daf932p-20, -0x1.05f7ef765c54ap-20,
+ 0x1.af585e72de506p-22},
+{0x1.fffffff01a8b6p-1, 0x1.23552681b14dp-60,
+ 0x1.155a09065d33ep-26, -0x1.26afa996e4fedp-24,
+ 0x1.95ea6fe0102ddp-23, -0x1.96ba734e112dcp-22,
+ 0x1.3b46801072ad1p-21, -0x1.8868eefc169bfp-21,
+ 0x1.916e995d1d5aep-21, -0x1.5668a990b110bp-21,
+ 0x1.eaaf72daa6fd9p-22, -0x1.2a2a349d3848fp-22,
+ 0x1.29dc018d98881p-23},
+{0x1.fffffffe4fa3p-1, 0x1.d167eb723994bp-57,
+ 0x1.f1e3523b41216p-30, -0x1.180fde41aa2b3p-27,
+ 0x1.99b866565e316p-26, -0x1.b598cb080505ep-25,
+ 0x1.6b1baf26ab049p-24, -0x1.e651045bb843dp-24,
+ 0x1.0d679b6436527p-23, -0x1.f5e329d503e6fp-24,
+ 0x1.8d255f2de068bp-24, -0x1.0fc427395972cp-24,
+ 0x1.38403cfa1f2e3p-25},
+{0x1.ffffffffd759dp-1, 0x1.f7befa060b4cbp-55,
+ 0x1.8a61745ec633ep-33, -0x1.d453ba31d31a9p-31,
+ 0x1.6a8aeba513b45p-29, -0x1.9b017a453232bp-28,
+ 0x1.6b43c90d3fd3dp-27, -0x1.042f4a0c49a5dp-26,
+ 0x1.35dc9e057cd05p-26, -0x1.3825a62803be8p-26,
+ 0x1.0d42bb74fe433p-26, -0x1.976d5ef9970bep-27,
+ 0x1.05a7854305f98p-27},
+{0x1.fffffffffc9e8p-1, -0x1.a759f086b2a6fp-56,
+ 0x1.13af4f04f6caep-36, -0x1.589b22c82a746p-34,
+ 0x1.196da0ab7a9b4p-32, -0x1.516d3c01c7753p-31,
+ 0x1.3c51d0318f56p-30, -0x1.e235e7b02cf9p-30,
+ 0x1.32c757bef9aacp-29, -0x1.4bb755e01497ep-29,
+ 0x1.34f4417359d37p-29, -0x1.fe67885a75c07p-30,
+ 0x1.67fea0d603724p-30},
+{0x1.ffffffffffc05p-1, 0x1.07ba9731c9a97p-55,
+ 0x1.5422ef5d817bbp-40, -0x1.be6dda2fa77efp-38,
+ 0x1.7f8a0f411adcbp-36, -0x1.e4cb492281569p-35,
+ 0x1.e044b29a83a42p-34, -0x1.83eac51b4ee93p-33,
+ 0x1.0659999b37667p-32, -0x1.2ea811873485ap-32,
+ 0x1.2e1fbcd83f8b9p-32, -0x1.0dfb8b0210f9bp-32,
+ 0x1.9d32d19d45f74p-33},
+{0x1.fffffffffffbep-1, -0x1.182b3258f18ecp-55,
+ 0x1.7258610b29533p-44, -0x1.fd398579ab9d3p-42,
+ 0x1.cb12e2fcb0d19p-40, -0x1.31011cb9cb5c9p-38,
+ 0x1.3e4a1e096bf0dp-37, -0x1.0f6f08d9fe7c2p-36,
+ 0x1.84a57515740ebp-36, -0x1.dbfb97f4d440ap-36,
+ 0x1.fa426f9fd09bcp-36, -0x1.e60074e6fff75p-36,
+ 0x1.8fe693d424e5ep-36},
+{0x1.ffffffffffffcp-1, 0x1.8115fd1f14a7ap-56,
+ 0x1.63daf8b490004p-48, -0x1.ff8ac595c6e85p-46,
+ 0x1.e2d06d7cb3517p-44, -0x1.505d91ed05403p-42,
+ 0x1.70b6fe3c2c4a4p-41, -0x1.4aee480942e32p-40,
+ 0x1.f3c6ac28650e4p-40, -0x1.438b499afca9cp-39,
+ 0x1.6ce387ec474f5p-39, -0x1.763879bf4b078p-39,
+ 0x1.48d3240a29ffep-39},
+{0x1p+0, -0x1.8cf8155772146p-56,
+ 0x1.2dc1190920e9bp-52, -0x1.c4a1a5a8fbafbp-50,
+ 0x1.be584a726d929p-48, -0x1.45542a1491d9ep-46,
+ 0x1.75a8176fa1914p-45, -0x1.5ff92370a71a9p-44,
+ 0x1.1772eb3c43c46p-43, -0x1.7d248ed4f19dep-43,
+ 0x1.c5f080ab95fd2p-43, -0x1.ef1dbd9acc555p-43,
+ 0x1.ce08041284c8p-43},
+},
+// erfc_tab[i] = {c0, q0, ..., q11}: e^(x*x)*erfc(x) ~= c0 + q0 + q1*t + ...
+// + q11*t^11 for x = c + t, |t| <= 1/8, where c = (i + 2)/4 and c0 is
+// e^(c*c)*erfc(c) rounded.
+// Relative error: 2^-56.4
+.erfc_tab = {
+{0x1.3b3bc3c98b0f3p-1, -0x1.bb57749c127d5p-56,
+ -0x1.067f263ec85e7p-1, 0x1.6ff861544dc4ap-2,
+ -0x1.c6ad7a6f37c69p-3, 0x1.fc9a0570c8466p-4,
+ -0x1.0605940f40bfcp-4, 0x1.f774502356b1p-6,
+ -0x1.c710172876d1dp-7, 0x1.85ae8200e16dp-8,
+ -0x1.3de696d22abafp-9, 0x1.f3804b44a88f6p-11,
+ -0x1.75dad6de1952p-12},
+{0x1.038d54ea3d834p-1, -0x1.eee94e17ebc8dp-55,
+ -0x1.78cdd551ee51ap-2, 0x1.d90093ae1095ap-3,
+ -0x1.09e77d40e020ep-3, 0x1.1192f5bd562f2p-4,
+ -0x1.054d6829641dep-5, 0x1.d43a7d1677609p-7,
+ -0x1.8c97dd55c6b7dp-8, 0x1.3f805c842555cp-9,
+ -0x1.ec0c25fc52deep-11, 0x1.6daedf16983aap-12,
+ -0x1.03ce9466452afp-13},
+{0x1.b5d8780f956b2p-2, 0x1.7a93f7092946ep-58,
+ -0x1.17c4e3f17c05p-2, 0x1.3c27283c32cd5p-3,
+ -0x1.44837f8906fb9p-4, 0x1.33cad0ef51e03p-5,
+ -0x1.10fcf1b55d126p-6, 0x1.c8cb95f92f212p-8,
+ -0x1.6af2655bffc3ap-9, 0x1.1351915b7e23ap-10,
+ -0x1.908187e49feddp-12, 0x1.19c4069259b8ep-13,
+ -0x1.7c3987685fa5dp-15},
+{0x1.78a692138767ap-2, 0x1.d9b6af03a24efp-64,
+ -0x1.abaacdbfa8b07p-3, 0x1.b56f45eef7e64p-4,
+ -0x1.9b635ac624ac8p-5, 0x1.68a25a6638a29p-6,
+ -0x1.299636d6c72bap-7, 0x1.d1b695fa33a67p-9,
+ -0x1.5b8bc95b34ef8p-10, 0x1.f0fd3d3defa77p-12,
+ -0x1.55c0065539869p-13, 0x1.c790afed41c6p-15,
+ -0x1.2415035b42892p-16},
+{0x1.494daffa2ad68p-2, 0x1.39786b45b9c47p-56,
+ -0x1.4f1988444caf7p-3, 0x1.37ea271bc54c2p-4,
+ -0x1.0dc51d2941e69p-5, 0x1.b65944f34858bp-7,
+ -0x1.513ed7600d9d1p-8, 0x1.ee705eb043cf8p-10,
+ -0x1.5b0abff45840fp-11, 0x1.d44fb24ca2e1ap-13,
+ -0x1.30c08f4dc427dp-14, 0x1.813a8ce012581p-16,
+ -0x1.d5b9135dc5806p-18},
+{0x1.23cfc2f1dc7ep-2, 0x1.3ad89cf58b37p-57,
+ -0x1.0c3d538446447p-3, 0x1.c8d0cef0f8111p-5,
+ -0x1.6cb52fe48945dp-6, 0x1.13648a11fd0c9p-7,
+ -0x1.8bf716a8eab0dp-9, 0x1.106bd5d89de54p-10,
+ -0x1.683888576a69fp-12, 0x1.cb4baca7471abp-14,
+ -0x1.1b28c79b99b7fp-15, 0x1.53c1b0d1d64dp-17,
+ -0x1.8a41ab49614cap-19},
+{0x1.058671b52c776p-2, -0x1.3bb22bc4415dp-58,
+ -0x1.b57034efd3f72p-4, 0x1.5672b9ea13de8p-5,
+ -0x1.fa9d3ac955d96p-7, 0x1.64907215a1658p-8,
+ -0x1.e028e8a56cb28p-10, 0x1.369ffa1c1bd5ep-11,
+ -0x1.83822173bd65ep-13, 0x1.d37b08b4fbd0fp-15,
+ -0x1.115cbf315cd27p-16, 0x1.37adb16d23159p-18,
+ -0x1.5880107d8664ep-20},
+{0x1.d94446d627932p-3, -0x1.a82da47f081fap-58,
+ -0x1.6a70d2bb37411p-4, 0x1.0615670e25a7cp-5,
+ -0x1.6883f9919a179p-7, 0x1.da595561f5c36p-9,
+ -0x1.2bd251bb2ec47p-10, 0x1.6d7743e54a47dp-12,
+ -0x1.aed7ebd40e88fp-14, 0x1.ec76b518565eap-16,
+ -0x1.117a30a55a4c1p-17, 0x1.28a05cd063fbfp-19,
+ -0x1.389728feca2f2p-21},
+{0x1.afbb3f3b7343bp-3, -0x1.9f49c47b47dfp-58,
+ -0x1.3086d7f01ac85p-4, 0x1.98958a7a8e4a4p-6,
+ -0x1.0632076809dfcp-7, 0x1.435c04e206dcfp-9,
+ -0x1.809ce8ab52f3ep-11, 0x1.ba8a67df8d2p-13,
+ -0x1.edd423a2bc327p-15, 0x1.0bcb662b9bb42p-16,
+ -0x1.1ad0de14e445dp-18, 0x1.24288e96b0e3ap-20,
+ -0x1.25d521150e09ep-22},
+{0x1.8c9eb68ff27d7p-3, -0x1.bb508f7e608ep-57,
+ -0x1.0305781330099p-4, 0x1.43b98bac83823p-6,
+ -0x1.84e9ab30e6ab3p-8, 0x1.c2c72fd726878p-10,
+ -0x1.f99e41ecb040ep-12, 0x1.131bb1687deeep-13,
+ -0x1.2312b25df7ab3p-15, 0x1.2bfb2265dfd5ap-17,
+ -0x1.2da2fe586c25ap-19, 0x1.292058359a3f3p-21,
+ -0x1.1d7c879e23502p-23},
+{0x1.6e9827d229d2dp-3, -0x1.90774183e9fdfp-58,
+ -0x1.bd6ae4d14b16fp-5, 0x1.043fe1a98c0cdp-6,
+ -0x1.259061ba85692p-8, 0x1.409cc2ed3f86p-10,
+ -0x1.53dec9d0892aep-12, 0x1.5e73930b91c06p-14,
+ -0x1.6025104081761p-16, 0x1.595ee4fdc0543p-18,
+ -0x1.4b1439be35378p-20, 0x1.375a4558d52fdp-22,
+ -0x1.1e19660e558edp-24},
+{0x1.54a7a08d4bb45p-3, -0x1.6a1588bed7877p-61,
+ -0x1.82a8522b868a1p-5, 0x1.a7eddc9ee6426p-7,
+ -0x1.c24b49c47a2c4p-9, 0x1.d085857a178a9p-11,
+ -0x1.d25ebba1c4643p-13, 0x1.c882f02a79ef4p-15,
+ -0x1.b45d0263fc386p-17, 0x1.97dd431210467p-19,
+ -0x1.753c83f707c21p-21, 0x1.4f7fad975352p-23,
+ -0x1.27255d76f0ba4p-25},
+{0x1.3e0a99a0ee914p-3, -0x1.902ebe323694bp-60,
+ -0x1.5285d2eb1ef74p-5, 0x1.5d581133378edp-7,
+ -0x1.5e5d7e9899181p-9, 0x1.5632136d8c98fp-11,
+ -0x1.460abd6b25994p-13, 0x1.2f839e57caa1bp-15,
+ -0x1.146bc408bdf62p-17, 0x1.ed2a5fc3d3343p-20,
+ -0x1.af5d3df20e8a3p-22, 0x1.7311f44f6677dp-24,
+ -0x1.38db931d4edf5p-26},
+{0x1.2a2af19c1493p-3, -0x1.fa04c2439dd47p-57,
+ -0x1.2aa6503acda11p-5, 0x1.22f0664f3cbf9p-7,
+ -0x1.1434ae05873abp-9, 0x1.fff032a0df511p-12,
+ -0x1.cfcdea1b1f3b4p-14, 0x1.9b50d0d6149fdp-16,
+ -0x1.65778aaf7e31dp-18, 0x1.30c2deb193e97p-20,
+ -0x1.fe3e0afe9fd22p-23, 0x1.a489e2261d5c3p-25,
+ -0x1.542cd80f5a4e7p-27},
+{0x1.18932bf08e154p-3, 0x1.098197f410734p-57,
+ -0x1.094922737431ap-5, 0x1.e9412fa33c74bp-8,
+ -0x1.b8b6382729f08p-10, 0x1.8457bbe09403dp-12,
+ -0x1.4f2981c3beb7ep-14, 0x1.1ba135f117e4p-16,
+ -0x1.d727479a7919ep-19, 0x1.806c72867e626p-21,
+ -0x1.345ee5fa94acep-23, 0x1.e796aef7dd10ap-26,
+ -0x1.7acd4e1974083p-28},
+{0x1.08e62ce8c89adp-3, -0x1.dc92750f86e4bp-57,
+ -0x1.da3953352497p-6, 0x1.9ef71691a552p-8,
+ -0x1.6373226edf541p-10, 0x1.2a660fdec0351p-12,
+ -0x1.eb88e0e8f3a88p-15, 0x1.8d8e59777465ep-17,
+ -0x1.3c077639b2174p-19, 0x1.ee333d4ae6bdap-22,
+ -0x1.7c5677338cb5ep-24, 0x1.20c1fbe07730ap-26,
+ -0x1.af5a7aaaefabep-29},
+{0x1.f5b2a049cf4c6p-4, -0x1.fc4bc719bf357p-58,
+ -0x1.aa3eb6a946f7ep-6, 0x1.62c12cb5f7577p-8,
+ -0x1.218ed930b23b1p-10, 0x1.d00785f2ed3d7p-13,
+ -0x1.6d54b133d6471p-15, 0x1.1ad6a32f2321dp-17,
+ -0x1.aef8ea4c2b916p-20, 0x1.4354e85bfb61ep-22,
+ -0x1.de093bc651e23p-25, 0x1.5cea14790e73ep-27,
+ -0x1.f59d2a4cb7c4dp-30},
+{0x1.dc603a3e77e9bp-4, -0x1.d4e9cceec6965p-59,
+ -0x1.81149bc4a104bp-6, 0x1.317c144f8b419p-8,
+ -0x1.dc1af883a33c8p-11, 0x1.6cc10c16254fdp-13,
+ -0x1.12f1743bc59d7p-15, 0x1.9818c0a32b111p-18,
+ -0x1.2a625a22c669ep-20, 0x1.ae1f9757480c6p-23,
+ -0x1.31c3d2eacdd72p-25, 0x1.ad929503b2001p-28,
+ -0x1.29777d02f21dp-30},
+{0x1.c57239e943d1ap-4, -0x1.0e6828fa1b76bp-59,
+ -0x1.5d843497d4f3ap-6, 0x1.08cf82b79a11cp-8,
+ -0x1.8abc198707c93p-11, 0x1.219f2c33533a1p-13,
+ -0x1.a2a81d24c93a8p-16, 0x1.2a41152f09debp-18,
+ -0x1.a3193cf7c6d28p-21, 0x1.228a6c1dc44e4p-23,
+ -0x1.8dabab177657cp-26, 0x1.0d203893d67d1p-28,
+ -0x1.67685d1566a7dp-31},
+{0x1.b096face146fep-4, 0x1.97cf192dd00d5p-59,
+ -0x1.3e981b3b1359p-6, 0x1.cdeae21161624p-9,
+ -0x1.49d492a39eb5fp-11, 0x1.d03e19aa11306p-14,
+ -0x1.4230e3ccf8758p-16, 0x1.b93f4736c2276p-19,
+ -0x1.2a4352eb32bf2p-21, 0x1.8e37443451efep-24,
+ -0x1.06a3a4dd6d93bp-26, 0x1.56d32aec236e9p-29,
+ -0x1.b9e318a351056p-32},
+{0x1.9d8a8f2284f2cp-4, -0x1.5b02794e6e48ap-58,
+ -0x1.238ca71b93fc3p-6, 0x1.95252b932efe3p-9,
+ -0x1.15976ddda3ca1p-11, 0x1.774f4826dc811p-14,
+ -0x1.f4e46d179e376p-17, 0x1.4a17e19c9211ap-19,
+ -0x1.add7ac9d44dd1p-22, 0x1.149cce8993565p-24,
+ -0x1.6000143b7a4a6p-27, 0x1.bb894cae90982p-30,
+ -0x1.1425951b6fae9p-32},
+{0x1.8c14049cd551ep-4, -0x1.060a710764786p-59,
+ -0x1.0bc46cdc18fe6p-6, 0x1.6535040e2c85ap-9,
+ -0x1.d662fda6d50f5p-12, 0x1.31dddbe436275p-14,
+ -0x1.8900e0bd28f06p-17, 0x1.f31a325b711eap-20,
+ -0x1.395be06da02fbp-22, 0x1.8530f2e8cb1b9p-25,
+ -0x1.de4247e691f86p-28, 0x1.2323924993d44p-30,
+ -0x1.5e87ab948b4c9p-33},
+{0x1.7c0348489d721p-4, 0x1.ca9ceb3753982p-58,
+ -0x1.ed7f66d9d09fep-7, 0x1.3c7764a81f462p-9,
+ -0x1.9106a7cd79e3bp-12, 0x1.f64cd9c07b67dp-15,
+ -0x1.370d0641775c9p-17, 0x1.7d0e03ee2099p-20,
+ -0x1.cde4cecd57db5p-23, 0x1.15133fc13ab91p-25,
+ -0x1.491ba95e7a54ep-28, 0x1.8381ccbb96e1dp-31,
+ -0x1.c3800bec5e269p-34},
+},
+// e^(x*x)*erfc(x) ~= poly(z)/x, z = 1/(x*x), for 6.125 <= x <= 27.3.
+// Relative error: 2^-59.3
+.asym = {
+0x1.20dd750429b6dp-1,
+-0x1.20dd750429a7p-2,
+0x1.b14c2f860bfb7p-2,
+-0x1.0ecf9d9e0feffp+0,
+0x1.d9eb487f13c31p+1,
+-0x1.0a9363945947cp+4,
+0x1.6e6ecd3219dfdp+6,
+-0x1.28a4b6b439383p+9,
+0x1.0eb6377d2cc42p+12,
+-0x1.fb526859e5065p+14,
+0x1.9188c0f7f151fp+17,
+-0x1.6bde1d77bc3f3p+19,
+},
+};
+
+#endif /* !__OBSOLETE_MATH */
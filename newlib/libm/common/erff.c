@@ -0,0 +1,84 @@
+/* Single-precision error function and its complement.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "gamma.h"
+
+/* erf and erfc computed in double precision with the polynomials of the
+   double variants.  Worst-case error is about 0.51 ULP for both.  */
+float
+erff (float x)
+{
+  uint32_t ix = asuint (x);
+  uint32_t ia = ix & 0x7fffffff;
+  double ax = asfloat (ia);
+  double y, c0;
+
+  if (ia < 0x3f200000)
+    /* |x| < 0.625, the double precision x * poly (x^2) cannot underflow.  */
+    return x + erf_small (x);
+  /* erf (x) rounds to +-1 above 0x1.f5a88ap1.  */
+  if (unlikely (ia >= 0x407ad445))
+    {
+      if (ia > 0x7f800000)
+	return x + x;
+      y = ia == 0x7f800000 ? 1.0f : 1.0f - 0x1p-120f;
+      return (ix >> 31) ? -y : y;
+    }
+  y = erf_mid (ax, &c0);
+  y = c0 + y;
+  return (ix >> 31) ? -y : y;
+}
+
+float
+erfcf (float x)
+{
+  uint32_t ix = asuint (x);
+  uint32_t ia = ix & 0x7fffffff;
+  double ax = asfloat (ia);
+  double g, e, el, c0, p;
+  const double *c;
+  int i;
+
+  if (ia < 0x3f200000)
+    return 1.0 - (x + erf_small (x));
+  /* 1 - erf (x) in double precision loses less than 16 bits below 3.  */
+  if (ix < 0x40400000)
+    {
+      p = erf_mid (ax, &c0);
+      return 1.0 - (c0 + p);
+    }
+  if ((ix >> 31) == 0)
+    {
+      /* erfc (x) underflows above 0x1.41bbf8p3.  */
+      if (unlikely (ia >= 0x4120ddfc))
+	{
+	  if (ia >= 0x7f800000)
+	    return ia == 0x7f800000 ? 0.0f : x + x;
+	  return __math_uflowf (0);
+	}
+      if (ax < 6.125)
+	{
+	  i = (ax - 0.375) * 4;
+	  c = __erf_data.erfc_tab[i];
+	  g = c[0] + erf_tab_poly (c, ax - (i * 0.25 + 0.5));
+	}
+      else
+	g = (__erf_data.asym[0] + erfc_asym_poly (1.0 / (ax * ax))) / ax;
+      e = exp_hilo_tail (-ax * ax, 0.0, &el);
+      return g * (e + el);
+    }
+  if (unlikely (ia >= 0x40c40000))
+    {
+      if (ia > 0x7f800000)
+	return x + x;
+      return ia == 0x7f800000 ? 2.0f : 2.0f - 0x1p-120f;
+    }
+  /* 1 + erf (-x).  */
+  p = erf_mid (ax, &c0);
+  return 1.0 + (c0 + p);
+}
+
+#endif /* !__OBSOLETE_MATH */
@@ -138,8 +138,10 @@
 
 #ifdef _SCALB_INT
 extern double scalb __P((double, int));
+extern float scalbf __P((float, int));
 #else
 extern double scalb __P((double, double));
+extern float scalbf __P((float, float));
 #endif
 extern double significand __P((double));
 
@@ -231,9 +233,39 @@ extern float __ieee754_scalbf __P((float,float));
 # define __ieee754_exp(x) exp(x)
 # define __ieee754_log(x) log(x)
 # define __ieee754_pow(x,y) pow(x,y)
+# define __ieee754_fmod(x,y) fmod(x,y)
+# define __ieee754_hypot(x,y) hypot(x,y)
 # define __ieee754_expf(x) expf(x)
 # define __ieee754_logf(x) logf(x)
 # define __ieee754_powf(x,y) powf(x,y)
+# define __ieee754_fmodf(x,y) fmodf(x,y)
+# define __ieee754_hypotf(x,y) hypotf(x,y)
+
+/* The fdlibm functions below report errors themselves in the style of
+   math_err.c, and their e_*.c files define the public symbol, so there
+   is no w_*.c wrapper either.  */
+# define __ieee754_acosh(x) acosh(x)
+# define __ieee754_atanh(x) atanh(x)
+# define __ieee754_log10(x) log10(x)
+# define __ieee754_remainder(x,y) remainder(x,y)
+# define __ieee754_scalb(x,fn) scalb(x,fn)
+# define __ieee754_j0(x) j0(x)
+# define __ieee754_j1(x) j1(x)
+# define __ieee754_jn(n,x) jn(n,x)
+# define __ieee754_y0(x) y0(x)
+# define __ieee754_y1(x) y1(x)
+# define __ieee754_yn(n,x) yn(n,x)
+# define __ieee754_acoshf(x) acoshf(x)
+# define __ieee754_atanhf(x) atanhf(x)
+# define __ieee754_log10f(x) log10f(x)
+# define __ieee754_remainderf(x,y) remainderf(x,y)
+# define __ieee754_scalbf(x,fn) scalbf(x,fn)
+# define __ieee754_j0f(x) j0f(x)
+# define __ieee754_j1f(x) j1f(x)
+# define __ieee754_jnf(n,x) jnf(n,x)
+# define __ieee754_y0f(x) y0f(x)
+# define __ieee754_y1f(x) y1f(x)
+# define __ieee754_ynf(n,x) ynf(n,x)
 #endif
 
 /* float versions of fdlibm kernel functions */
@@ -0,0 +1,32 @@
+/* Double-precision fmod function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "fmod.h"
+
+double
+fmod (double x, double y)
+{
+  uint64_t ix = asuint64 (x);
+  uint64_t iy = asuint64 (y);
+  uint64_t sx = ix & 0x8000000000000000;
+
+  ix &= 0x7fffffffffffffff;
+  iy &= 0x7fffffffffffffff;
+  if (unlikely (ix >= 0x7ff0000000000000
+		|| iy - 1 >= 0x7ff0000000000000 - 1))
+    {
+      if (ix > 0x7ff0000000000000 || iy > 0x7ff0000000000000)
+	return x * y;
+      if (ix == 0x7ff0000000000000 || iy == 0)
+	return __math_invalid (x);
+      return x;
+    }
+  if (ix <= iy)
+    return ix == iy ? asdouble (sx) : x;
+  return fmod_finite (ix, iy, sx);
+}
+
+#endif /* !__OBSOLETE_MATH */
@@ -0,0 +1,92 @@
+/* Header for fmod and fmodf.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include <stdint.h>
+#include <math.h>
+#include "math_config.h"
+
+/* Return the significand of the finite non-zero double IA scaled to
+   [2^52, 2^53) and set *E such that the value is the significand times
+   2^(*E - 1075).  */
+static inline uint64_t
+fmod_normalize (uint64_t ia, int *e)
+{
+  int k;
+
+  *e = ia >> 52;
+  ia &= 0x000fffffffffffff;
+  if (*e != 0)
+    return ia | 0x0010000000000000;
+  k = clz64 (ia) - 11;
+  *e = 1 - k;
+  return ia << k;
+}
+
+/* Return MX * 2^D modulo MY, for MY in [2^52, 2^53) and MX < 2 * MY.  The
+   shift and subtract loop of fdlibm takes D steps.  Here each step divides
+   by MY with a 62-bit reciprocal, so it takes D / 62 steps.  */
+static inline uint64_t
+fmod_reduce (uint64_t mx, uint64_t my, int d)
+{
+  uint64_t inv, hi, lo, q;
+  int64_t e;
+  double a;
+  int s;
+
+  if (mx >= my)
+    mx -= my;
+  /* For small quotients a few steps of the bit loop are faster than the
+     reciprocal.  */
+  if (d < 12)
+    {
+      for (; d > 0; d--)
+	{
+	  mx <<= 1;
+	  if (mx >= my)
+	    mx -= my;
+	}
+      return mx;
+    }
+  /* The double quotient is within 2^9 of 2^114 / MY, so the error of
+     INV * MY fits in 63 bits and one correction leaves INV within 1.  */
+  a = 0x1p114 / (double) my;
+  inv = a;
+  e = (int64_t) (0 - inv * my);
+  inv += (int64_t) ((double) e * a * 0x1p-114);
+  while (d > 0)
+    {
+      s = d < 62 ? d : 62;
+      d -= s;
+      /* Q is within 3 of MX * 2^S / MY, and the remainder is computed
+	 modulo 2^64 before it is corrected.  */
+      hi = mul64 (mx, inv, &lo);
+      q = s > 50 ? hi << (s - 50) | lo >> (114 - s) : hi >> (50 - s);
+      mx = (mx << s) - q * my;
+      while ((int64_t) mx < 0)
+	mx += my;
+      while (mx >= my)
+	mx -= my;
+    }
+  return mx;
+}
+
+/* Return fmod for the absolute values IX > IY of finite non-zero doubles,
+   with the sign SX.  The result is exact.  */
+static inline double
+fmod_finite (uint64_t ix, uint64_t iy, uint64_t sx)
+{
+  uint64_t mx, my;
+  int ex, ey, k;
+
+  mx = fmod_normalize (ix, &ex);
+  my = fmod_normalize (iy, &ey);
+  mx = fmod_reduce (mx, my, ex - ey);
+  if (mx == 0)
+    return asdouble (sx);
+  k = clz64 (mx) - 11;
+  mx <<= k;
+  ey -= k;
+  if (ey > 0)
+    return asdouble (sx | (uint64_t) ey << 52 | (mx & 0x000fffffffffffff));
+  return asdouble (sx | mx >> (1 - ey));
+}
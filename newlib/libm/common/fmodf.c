@@ -0,0 +1,33 @@
+/* Single-precision fmod function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "fmod.h"
+
+float
+fmodf (float x, float y)
+{
+  uint32_t ix = asuint (x);
+  uint32_t iy = asuint (y);
+  uint32_t sx = ix & 0x80000000;
+
+  ix &= 0x7fffffff;
+  iy &= 0x7fffffff;
+  if (unlikely (ix >= 0x7f800000 || iy - 1 >= 0x7f800000 - 1))
+    {
+      if (ix > 0x7f800000 || iy > 0x7f800000)
+	return x * y;
+      if (ix == 0x7f800000 || iy == 0)
+	return __math_invalidf (x);
+      return x;
+    }
+  if (ix <= iy)
+    return ix == iy ? asfloat (sx) : x;
+  /* The conversions to double are exact, and so is the result.  */
+  return fmod_finite (asuint64 ((double) asfloat (ix)),
+		      asuint64 ((double) asfloat (iy)), (uint64_t) sx << 32);
+}
+
+#endif /* !__OBSOLETE_MATH */
@@ -0,0 +1,438 @@
+/* Header for tgamma, lgamma, erf, erfc and their float variants.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include <stdint.h>
+#include <math.h>
+#include "math_config.h"
+
+#define GT __gamma_data.tab
+#define EXP_C(i) __exp_data.poly[(i) + 3 - EXP_POLY_ORDER]
+
+/* 512 * ln2 as hi + lo, used to keep exp_hilo_tail in range.  */
+#define LN2X512_HI 0x1.62e42fefa39efp+8
+#define LN2X512_LO 0x1.abc9e3b39803fp-47
+
+/* Return HI with A + B = HI + *LO exactly.  */
+static inline double
+add_hilo (double a, double b, double *lo)
+{
+  double hi = a + b;
+  double bb = hi - a;
+
+  *lo = (a - (hi - bb)) + (b - bb);
+  return hi;
+}
+
+/* Return Y such that Y + *TAIL is log (X) for positive normal X, with a
+   relative error of about 2^-68.  This is log_inline of pow.c.  */
+static inline double
+log_hilo (double x, double *tail)
+{
+  double_t z, r, y, invc, logc, logctail, kd, hi, t1, t2, lo, lo1, lo2, p;
+  double_t ar, ar2, ar3, lo3, lo4;
+  const double *A = __pow_log_data.poly;
+  uint64_t ix, iz, tmp;
+  int k, i;
+
+  ix = asuint64 (x);
+  tmp = ix - 0x3fe6955500000000;
+  i = (tmp >> (52 - POW_LOG_TABLE_BITS)) % (1 << POW_LOG_TABLE_BITS);
+  k = (int64_t) tmp >> 52;
+  iz = ix - (tmp & 0xfffULL << 52);
+  z = asdouble (iz);
+  kd = (double_t) k;
+
+  invc = __pow_log_data.tab[i].invc;
+  logc = __pow_log_data.tab[i].logc;
+  logctail = __pow_log_data.tab[i].logctail;
+
+#if HAVE_FAST_FMA
+  r = fma (z, invc, -1.0);
+#else
+  double_t zhi = asdouble ((iz + (1ULL << 31)) & (-1ULL << 32));
+  double_t zlo = z - zhi;
+  double_t rhi = zhi * invc - 1.0;
+  double_t rlo = zlo * invc;
+  r = rhi + rlo;
+#endif
+
+  t1 = kd * __pow_log_data.ln2hi + logc;
+  t2 = t1 + r;
+  lo1 = kd * __pow_log_data.ln2lo + logctail;
+  lo2 = t1 - t2 + r;
+
+  ar = A[0] * r;
+  ar2 = r * ar;
+  ar3 = r * ar2;
+#if HAVE_FAST_FMA
+  hi = t2 + ar2;
+  lo3 = fma (ar, r, -ar2);
+  lo4 = t2 - hi + ar2;
+#else
+  double_t arhi = A[0] * rhi;
+  double_t arhi2 = rhi * arhi;
+  hi = t2 + arhi2;
+  lo3 = rlo * (ar + arhi);
+  lo4 = t2 - hi + arhi2;
+#endif
+  p = (ar3
+       * (A[1] + r * A[2] + ar2 * (A[3] + r * A[4] + ar2 * (A[5] + r * A[6]))));
+  lo = lo1 + lo2 + lo3 + lo4 + p;
+  y = hi + lo;
+  *tail = hi - y + lo;
+  return y;
+}
+
+/* Return HI such that HI + *LO is e^(X + XTAIL) for |X| < 708 and
+   |XTAIL| < 2^-16, with a relative error of about 2^-60.  This is
+   exp_hilo of hyperbolic.h with the tail added to the reduced argument.  */
+static inline double
+exp_hilo_tail (double x, double xtail, double *lo)
+{
+  uint64_t ki, idx, top, sbits;
+  double_t kd, z, r, r2, scale, tail, tmp;
+
+  z = __exp_data.invln2N * x;
+#if TOINT_INTRINSICS
+  kd = roundtoint (z);
+  ki = converttoint (z);
+#elif EXP_USE_TOINT_NARROW
+  kd = eval_as_double (z + __exp_data.shift);
+  ki = asuint64 (kd) >> 16;
+  kd = (double_t) (int32_t) ki;
+#else
+  kd = eval_as_double (z + __exp_data.shift);
+  ki = asuint64 (kd);
+  kd -= __exp_data.shift;
+#endif
+  r = x + kd * __exp_data.negln2hiN + kd * __exp_data.negln2loN;
+  r += xtail;
+  idx = 2 * (ki % (1 << EXP_TABLE_BITS));
+  top = ki << (52 - EXP_TABLE_BITS);
+  tail = asdouble (__exp_data.tab[idx]);
+  sbits = __exp_data.tab[idx + 1] + top;
+  r2 = r * r;
+#if EXP_POLY_ORDER == 4
+  tmp = tail + r + r2 * EXP_C (2) + r * r2 * (EXP_C (3) + r * EXP_C (4));
+#elif EXP_POLY_ORDER == 5
+  tmp = tail + r + r2 * (EXP_C (2) + r * EXP_C (3))
+	+ r2 * r2 * (EXP_C (4) + r * EXP_C (5));
+#elif EXP_POLY_ORDER == 6
+  tmp = tail + r + r2 * (0.5 + r * EXP_C (3))
+	+ r2 * r2 * (EXP_C (4) + r * EXP_C (5) + r2 * EXP_C (6));
+#endif
+  scale = asdouble (sbits);
+  *lo = scale * tmp;
+  return scale;
+}
+
+/* Round e^(X + XTAIL) for -1060 < X < 709.8, where the caller has ruled
+   out overflow.  Results beyond e^-700 are computed 2^512 times larger
+   and scaled down in the last step, so they are rounded twice in the
+   subnormal range.  */
+static inline double
+exp_round (double x, double xtail)
+{
+  double hi, lo, e, el;
+
+  if (likely ((asuint64 (x) & 0x7fffffffffffffff) < asuint64 (700.0)))
+    {
+      e = exp_hilo_tail (x, xtail, &el);
+      return e + el;
+    }
+  if (x > 0.0)
+    {
+      hi = add_hilo (x, -LN2X512_HI, &lo);
+      e = exp_hilo_tail (hi, lo + (xtail - LN2X512_LO), &el);
+      return check_oflow ((e + el) * 0x1p512);
+    }
+  hi = add_hilo (x, LN2X512_HI, &lo);
+  e = exp_hilo_tail (hi, lo + (xtail + LN2X512_LO), &el);
+  return check_uflow ((e + el) * 0x1p-512);
+}
+
+/* Return HI such that HI + *LO is gamma (1 + F) for 0 <= F < 1, with an
+   error below 2^-60.  The table has polynomials for gamma (c + t) - c0
+   around the middles c of 8 subintervals; the product of the linear
+   term is kept exact.  */
+static inline double
+gamma_1p (double f, double *lo)
+{
+  int i = f * (1 << GAMMA_TABLE_BITS);
+  const double *c = GT[i];
+  double m = (i + 0.5) * (1.0 / (1 << GAMMA_TABLE_BITS));
+  double t, tl, t2, t4, t8, p, ph, pl, hi, l, y;
+
+  t = add_hilo (f, -m, &tl);
+  t2 = t * t;
+  t4 = t2 * t2;
+  t8 = t4 * t4;
+  p = (c[3] + t * c[4]) + t2 * (c[5] + t * c[6])
+      + t4 * ((c[7] + t * c[8]) + t2 * (c[9] + t * c[10]))
+      + t8 * (c[11] + t * c[12]);
+  ph = mul_hilo (t, c[2], &pl);
+  hi = c[0] + ph;
+  l = (c[0] - hi + ph) + pl + tl * c[2] + c[1] + t2 * p;
+  /* Normalize, so that callers can use *LO as a first-order correction.  */
+  y = hi + l;
+  *lo = hi - y + l;
+  return y;
+}
+
+/* Return HI such that HI + *LO is gamma (X) for 2^-54 <= X < 12, using
+   gamma (x) = gamma (1 + f) * (f + 1) * ... * (f + m - 1) for x = m + f.
+   Below 1 the result is gamma (1 + x) / x.  The relative error is below
+   2^-59.  */
+static inline double
+gamma_small (double x, double *lo)
+{
+  double f, hi, l, e, q, r, rl;
+  int m, k;
+
+  if (x < 1.0)
+    {
+      hi = gamma_1p (x, &l);
+      q = hi / x;
+      r = mul_hilo (q, x, &rl);
+      *lo = ((hi - r) - rl + l) / x;
+      return q;
+    }
+  m = x;
+  f = x - m;
+  hi = gamma_1p (f, &l);
+  /* f + k is exact.  */
+  for (k = 1; k < m; k++)
+    {
+      hi = mul_hilo (hi, f + k, &e);
+      l = l * (f + k) + e;
+    }
+  *lo = l;
+  return hi;
+}
+
+/* Return HI such that HI + *LO is lgamma (X) - (x - 0.5) * log (x) + x for
+   X >= 8, the Stirling series 0.5 * log (2 pi) + 1 / (12 x) - ... with
+   an error below 2^-62.  */
+static inline double
+stirling_tail (double x, double *lo)
+{
+  const double *c = __gamma_data.stirling;
+  double w = 1.0 / x;
+  /* The terms in z are negligible above 2^27, and z could underflow.  */
+  double z = x < 0x1p27 ? w * w : 0.0;
+  double z2 = z * z;
+  double s = w * (c[0] + z * c[1] + z2 * (c[2] + z * c[3])
+		  + z2 * z2 * (c[4] + z * c[5] + z2 * c[6]));
+  double hi = __gamma_data.hlog2pi_hi + s;
+
+  /* s < 1/144, so the addition error is exact.  */
+  *lo = (__gamma_data.hlog2pi_hi - hi + s) + __gamma_data.hlog2pi_lo;
+  return hi;
+}
+
+/* Return HI such that HI + *LO is lgamma (X) for 8 <= X < 2^1014, with
+   an error below 2^-60 relative to the result.  */
+static inline double
+lgamma_stirling (double x, double *lo)
+{
+  double lh, ll, ph, pl, s, e1, e2, e3, ch, cl, l, y;
+
+  /* x * (log (x) - 1) does not overflow where the result does not.  */
+  lh = log_hilo (x, &ll);
+  s = add_hilo (lh, -1.0, &e1);
+  ph = mul_hilo (x, s, &pl);
+  pl += x * (ll + e1) - 0.5 * ll;
+  s = add_hilo (ph, -0.5 * lh, &e2);
+  ch = stirling_tail (x, &cl);
+  s = add_hilo (s, ch, &e3);
+  l = e2 + (e3 + pl + cl);
+  /* Normalize, since exp_hilo_tail needs a small tail.  */
+  y = s + l;
+  *lo = s - y + l;
+  return y;
+}
+
+/* Return HI such that HI + *LO is sin (pi * R) for |R| <= 0.5, with a
+   relative error below 2^-58.  sin (pi * r) = r * (pi + c1 * r^2 + ...),
+   where the first two terms are summed in double-double.  */
+static inline double
+sinpi_hilo (double r, double *lo)
+{
+  const double *c = __gamma_data.sinpi;
+  double zh, zl, z2, z4, q, ph, pl, hi, l, e, y;
+
+  zh = mul_hilo (r, r, &zl);
+  z2 = zh * zh;
+  z4 = z2 * z2;
+  q = (c[2] + zh * c[3]) + z2 * (c[4] + zh * c[5])
+      + z4 * ((c[6] + zh * c[7]) + z2 * c[8]);
+  ph = mul_hilo (zh, c[1], &pl);
+  hi = add_hilo (c[0], ph, &e);
+  l = e + pl + zl * c[1] + __gamma_data.sinpi_lo[0]
+      + zh * __gamma_data.sinpi_lo[1] + z2 * q;
+  hi = mul_hilo (r, hi, &e);
+  l = e + r * l;
+  y = hi + l;
+  *lo = hi - y + l;
+  return y;
+}
+
+/* Round X to the nearest integer for -2^52 < X <= 0, with *ODD set to its
+   parity.  */
+static inline double
+round_parity (double x, int *odd)
+{
+  double kd = eval_as_double (x - 0x1p52);
+
+  *odd = asuint64 (kd) & 1;
+  return kd + 0x1p52;
+}
+
+/* Return HI such that HI + *LO is log (pi / |x * sin (pi * x)|) for X < 0,
+   where R = X - N != 0 for the integer N of parity ODD.  *NEG is set if
+   sin (pi * x) is negative.  */
+static inline double
+log_reflect (double x, double r, int odd, double *lo, int *neg)
+{
+  double sh, sl, dh, dl, lh, ll, hi, e;
+
+  sh = sinpi_hilo (r, &sl);
+  dh = mul_hilo (x, sh, &dl);
+  dl += x * sl;
+  /* x < 0, so x * sin (pi * r) < 0 when sin (pi * r) > 0.  */
+  *neg = odd ^ (r < 0.0);
+  dh = -asdouble (asuint64 (dh) ^ (asuint64 (r) & 0x8000000000000000));
+  dl = -asdouble (asuint64 (dl) ^ (asuint64 (r) & 0x8000000000000000));
+  lh = log_hilo (dh, &ll);
+  ll += dl / dh;
+  hi = add_hilo (__gamma_data.logpi_hi, -lh, &e);
+  *lo = e + (__gamma_data.logpi_lo - ll);
+  return hi;
+}
+
+/* gamma (1 + F) for 0 <= F < 1 to about 2^-32 relative precision, for the
+   float variants.  The table polynomials are truncated after degree 7.  */
+static inline double
+gammaf_1p (double f)
+{
+  int i = f * (1 << GAMMA_TABLE_BITS);
+  const double *c = GT[i];
+  double t = f - (i + 0.5) * (1.0 / (1 << GAMMA_TABLE_BITS));
+  double t2 = t * t;
+  double t4 = t2 * t2;
+
+  return c[0] + ((c[1] + t * c[2]) + t2 * (c[3] + t * c[4])
+		 + t4 * ((c[5] + t * c[6]) + t2 * (c[7] + t * c[8])));
+}
+
+/* sin (pi * R) for |R| <= 0.5 to about 2^-52 relative precision, for the
+   float variants.  */
+static inline double
+sinpif (double r)
+{
+  const double *c = __gamma_data.sinpi;
+  double z = r * r;
+  double z2 = z * z;
+  double z4 = z2 * z2;
+
+  return r * ((c[0] + z * c[1]) + z2 * (c[2] + z * c[3])
+	      + z4 * ((c[4] + z * c[5]) + z2 * (c[6] + z * c[7]))
+	      + z4 * z4 * c[8]);
+}
+
+/* lgamma (X) for 8 <= X < 2^122 to about 2^-40 relative precision, for
+   the float variants.  */
+static inline double
+lgammaf_stirling (double x)
+{
+  const double *c = __gamma_data.stirling;
+  double w = 1.0 / x;
+  double z = w * w;
+
+  return (x - 0.5) * log (x) - x + __gamma_data.hlog2pi_hi
+	 + w * (c[0] + z * (c[1] + z * (c[2] + z * c[3])));
+}
+
+/* gamma (X) for 2^-150 < X < 44 to about 2^-30 relative precision, for the
+   float variants.  */
+static inline double
+gammaf_pos (double x)
+{
+  double f, y, e, el;
+  int m, k;
+
+  if (x < 1.0)
+    return gammaf_1p (x) / x;
+  if (x >= 12.0)
+    {
+      e = exp_hilo_tail (lgammaf_stirling (x), 0.0, &el);
+      return e + el;
+    }
+  m = x;
+  f = x - m;
+  y = gammaf_1p (f);
+  for (k = 1; k < m; k++)
+    y *= f + k;
+  return y;
+}
+
+/* Return the polynomial of row C of erf_tab or erfc_tab at T, without the
+   leading c0 of the row.  */
+static inline double
+erf_tab_poly (const double *c, double t)
+{
+  double t2 = t * t;
+  double t4 = t2 * t2;
+  double t8 = t4 * t4;
+  double p;
+
+  p = (c[2] + t * c[3]) + t2 * (c[4] + t * c[5])
+      + t4 * ((c[6] + t * c[7]) + t2 * (c[8] + t * c[9]))
+      + t8 * (c[10] + t * c[11] + t2 * c[12]);
+  return c[1] + t * p;
+}
+
+/* x * poly (x^2) for |x| < 0.625, so that erf (x) = x + erf_small (x).  */
+static inline double
+erf_small (double x)
+{
+  const double *c = __erf_data.poly;
+  double z = x * x;
+  double z2 = z * z;
+  double z4 = z2 * z2;
+  double p;
+
+  /* c[0] is added last so that the sum is rounded once relative to it.  */
+  p = (c[1] + z * c[2]) + z2 * (c[3] + z * c[4])
+      + z4 * ((c[5] + z * c[6]) + z2 * (c[7] + z * c[8]) + z4 * c[9]);
+  return x * (c[0] + z * p);
+}
+
+/* Return erf (X) - c0 for 0.625 <= X < 6.125 with c0 in *C0.  */
+static inline double
+erf_mid (double x, double *c0)
+{
+  int i = (x - 0.625) * 4;
+  const double *c = __erf_data.erf_tab[i];
+  double t = x - (i * 0.25 + 0.75);
+
+  *c0 = c[0];
+  return erf_tab_poly (c, t);
+}
+
+/* Return poly (Z) - c0 of the asymptotic expansion of e^x^2 * erfc (x),
+   where Z = 1/x^2 for x >= 6.125.  */
+static inline double
+erfc_asym_poly (double z)
+{
+  const double *c = __erf_data.asym;
+  double z2 = z * z;
+  double z4 = z2 * z2;
+  double z8 = z4 * z4;
+  double p;
+
+  p = (c[2] + z * c[3]) + z2 * (c[4] + z * c[5])
+      + z4 * ((c[6] + z * c[7]) + z2 * (c[8] + z * c[9]))
+      + z8 * (c[10] + z * c[11]);
+  return z * (c[1] + z * p);
+}
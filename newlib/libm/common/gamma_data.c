@@ -0,0 +1,394 @@
+/* Data for tgamma, lgamma and their float variants.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "math_config.h"
+
+const struct gamma_data __gamma_data = {
+// tab[i] = {c0, q0, ..., q11}: gamma(c + t) ~= c0 + q0 + q1*t + ... + q11*t^11
+// for |t| <= 1/16, where c = 1 + (i + 0.5)/8 and c0 is gamma(c) rounded.
+// Absolute error: 2^-59.4
+.tab = {
+{0x1.ef66a79533ee7p-1, 0x1.8f6c99372c9bep-56,
+ -0x1.da72f10a8e942p-2, 0x1.adf05a9ad5b69p-1,
+ -0x1.645f5dabed2d4p-1, 0x1.7373e6d815efcp-1,
+ -0x1.5bd0b9a25a1c4p-1, 0x1.4c3b4f1b8abc5p-1,
+ -0x1.399cbffc5a8ap-1, 0x1.27f449d0d54b7p-1,
+ -0x1.16dba8a0c5bf3p-1, 0x1.09629b34327bap-1,
+ -0x1.f4936930bf02ap-2},
+{0x1.d7d9d427cf767p-1, -0x1.e828f2b37f3cap-55,
+ -0x1.1fd3e8cdfc7e7p-2, 0x1.455f6bc183607p-1,
+ -0x1.ac87a4086d698p-2, 0x1.ad51be3cc339bp-2,
+ -0x1.6030bf6c418bp-2, 0x1.3068b872b8e37p-2,
+ -0x1.00d22326d9b9fp-2, 0x1.b27856c87e25ap-3,
+ -0x1.6e701c146660dp-3, 0x1.37807cd5053d5p-3,
+ -0x1.06d227a5fa8aep-3},
+{0x1.ca931e2a3738ep-1, -0x1.4a0c6211cead5p-56,
+ -0x1.1c828cb1680bp-3, 0x1.06319532f9104p-1,
+ -0x1.02e21a64f80d2p-2, 0x1.0a1aabfe6ff0dp-2,
+ -0x1.7a11ceaea5ff9p-3, 0x1.2e28fd978f905p-3,
+ -0x1.cb1b60ca6ab48p-4, 0x1.607c818f299a1p-4,
+ -0x1.0d0654529476ep-4, 0x1.9d7483f5bf7efp-5,
+ -0x1.3b9eb6f70f93ap-5},
+{0x1.c58ebc9f050b8p-1, -0x1.539285b85bdf2p-55,
+ -0x1.56b926daaf1e4p-6, 0x1.c10ca7f954c7fp-2,
+ -0x1.2ca1762861825p-3, 0x1.619b9856a72b2p-3,
+ -0x1.a5ec5deef378bp-4, 0x1.415b06fd82dfdp-4,
+ -0x1.b819b7c332be3p-5, 0x1.368134764b52dp-5,
+ -0x1.b06eb738b4c54p-6, 0x1.2f5edd76989b7p-6,
+ -0x1.a6eb0ededec3fp-7},
+{0x1.c799aecd47951p-1, -0x1.065581ef82238p-55,
+ 0x1.543f8239fe825p-4, 0x1.97758497a3fbbp-2,
+ -0x1.2eac05dfb2d19p-4, 0x1.fa1453f461fa5p-4,
+ -0x1.dde96303546fbp-5, 0x1.6c787cf6642aap-5,
+ -0x1.bdb01f59c42cep-6, 0x1.2547c8ed9482dp-6,
+ -0x1.768fa4e423501p-7, 0x1.e40b21541dfdcp-8,
+ -0x1.3660145ba9acap-8},
+{0x1.d00a6ad56f3adp-1, -0x1.9b4a9df7ed393p-55,
+ 0x1.709b25b197c7cp-3, 0x1.85edc4ade2d9fp-2,
+ -0x1.42c35c99eeca6p-6, 0x1.88ebcca5929b8p-4,
+ -0x1.081e200f4fa68p-5, 0x1.b9c99f94b8e58p-6,
+ -0x1.d573a01c63d45p-7, 0x1.26a8a05de0b49p-7,
+ -0x1.593abb6b1fe58p-8, 0x1.9e9a2e1447165p-9,
+ -0x1.ebf33da1cff82p-10},
+{0x1.de99088fe9c26p-1, -0x1.ed360541c7363p-56,
+ 0x1.19924a03486eap-2, 0x1.87055a0b3d7ccp-2,
+ 0x1.8c054c8fb549ap-6, 0x1.4cd08b8eb89dbp-4,
+ -0x1.041b0f36a5977p-6, 0x1.20f87215b0c5fp-6,
+ -0x1.f7bd4ed44bd06p-8, 0x1.39fd183fcb6f3p-8,
+ -0x1.4eae7de4c71d1p-9, 0x1.79c648f5b5919p-10,
+ -0x1.a03af945f17f7p-11},
+{0x1.f348f37d8f21cp-1, -0x1.614c5bc43fc3p-55,
+ 0x1.7d1ec45651d5ap-2, 0x1.97d8d8455d0a6p-2,
+ 0x1.01d5e6ff3d8ep-4, 0x1.33408f068b463p-4,
+ -0x1.34f6b91ded795p-8, 0x1.9e9ade49f65b1p-7,
+ -0x1.09651e2fbf8cdp-8, 0x1.6443fc66941b9p-9,
+ -0x1.50e0a9270181ep-10, 0x1.6c0624c741edep-11,
+ -0x1.745398e1f3765p-12},
+},
+// lgamma(1 + t) ~= t*poly(t) for |t| <= 1/8, where the first two
+// coefficients are lgam1[i] + lgam1_lo[i].
+// Relative error: 2^-62.1
+.lgam1_lo = {0x1.6c36091ab7cabp-58, 0x1.0ac01a9db7ab9p-55},
+.lgam1 = {
+-0x1.2788cfc6fb619p-1,
+0x1.a51a6625307d3p-1,
+-0x1.9a4d55beab2d6p-2,
+0x1.151322ac7d5fap-2,
+-0x1.a8b9c17aa6334p-3,
+0x1.5b40cb10d3291p-3,
+-0x1.2703a1dd0f812p-3,
+0x1.010b35c30f60cp-3,
+-0x1.c8066f8658ce8p-4,
+0x1.9a0303b7558b4p-4,
+-0x1.748cf3dcc8ca6p-4,
+0x1.550cfcea0caa4p-4,
+-0x1.3ad382dc459d7p-4,
+0x1.34122419c2d7fp-4,
+-0x1.1ea12d9be31c6p-4,
+},
+// lgamma(2 + t) ~= t*poly(t) for |t| <= 1/8, where the first two
+// coefficients are lgam2[i] + lgam2_lo[i].
+// Relative error: 2^-62.4
+.lgam2_lo = {0x1.71b50f67d9db6p-58, 0x1.06e4740a63d18p-56},
+.lgam2 = {
+0x1.b0ee6072093cep-2,
+0x1.4a34cc4a60fa6p-2,
+-0x1.13e001a55761dp-4,
+0x1.51322ac7d8601p-6,
+-0x1.e404fc214dddbp-8,
+0x1.7add6eac8c349p-9,
+-0x1.38ac5d43755bap-10,
+0x1.0b36b2a8fb765p-11,
+-0x1.d3f91711c3653p-13,
+0x1.a11f8ac3e234p-14,
+-0x1.7c9a5ffdaef5dp-15,
+0x1.5d0f7a275ae64p-16,
+},
+// lgam_tab[i] = {c0, q1, ..., q14, c0lo, q1lo, q2lo}: lgamma(c + t) ~=
+// c0 + q1*t + ... + q14*t^14 for |t| <= 1/8, where c = 1.25 + i/4 below 2
+// and c = 1.5 + i/4 above (c = 2 is covered by lgam2), and the first three
+// coefficients are c0 + c0lo, q1 + q1lo and q2 + q2lo.  The degree drops
+// to 8 for large c, the unused coefficients are zero.
+// Relative error: 2^-64.2
+.lgam_tab = {
+{-0x1.92857d38caf41p-4, -0x1.d1d32879af85dp-3,
+ 0x1.328429d927c67p-1, -0x1.c533afa1c08dfp-3,
+ 0x1.dad1b9fd7bc4p-4, -0x1.1de1433c383a7p-4,
+ 0x1.71ef365fd9962p-5, -0x1.f39b6d585a097p-6,
+ 0x1.5ae76a28cc366p-6, -0x1.eb3c7eaa9e8bfp-7,
+ 0x1.60dc08609c843p-7, -0x1.002eeb6bd0d96p-7,
+ 0x1.773bd000c571dp-8, -0x1.1e7a07dde076cp-8,
+ 0x1.b222b8f16a5a6p-9, -0x1.d2156922e7adfp-58,
+ 0x1.c9b98cc0b994ap-57, 0x1.021294bd3a4cap-57},
+{-0x1.eeb95b094c191p-4, 0x1.2aed059bd608ap-5,
+ 0x1.de9e64df22ef3p-2, -0x1.1ae55b1807269p-3,
+ 0x1.e0f840dad61c8p-5, -0x1.da59d5374e28dp-6,
+ 0x1.f9ca39dab1cc7p-7, -0x1.1a8ba4e7d7d4fp-7,
+ 0x1.456f1ac596135p-8, -0x1.7edb9740a6f12p-9,
+ 0x1.c9737e8005c03p-10, -0x1.147bd36969c76p-10,
+ 0x1.51677d8c91188p-11, -0x1.a881c78a952aap-12,
+ 0x1.071f8bd17d9fap-12, -0x1.34689aa1da5c5p-58,
+ 0x1.7e5af346e2168p-63, -0x1.69eb9cc859011p-57},
+{-0x1.59b4fd6875a6ep-4, 0x1.fad2d675283d3p-3,
+ 0x1.87385c3c034c4p-2, -0x1.7f95d3d17c5acp-4,
+ 0x1.112f9cdb802e9p-5, -0x1.c69a305c4f08bp-7,
+ 0x1.9aef326380ac9p-8, -0x1.8689d070f1471p-9,
+ 0x1.7f89d6e0d93adp-10, -0x1.815c929ed8ba5p-11,
+ 0x1.89a84dde04efdp-12, -0x1.9755f6cad7ca1p-13,
+ 0x1.b0253cbd16acbp-14, -0x1.c23a4b8203d23p-15,
+ 0, -0x1.85f34091d7218p-59,
+ -0x1.d19c6b665e75ap-57, 0x1.92b8914c29dbp-56},
+{0x1.ff797bba88502p-4, 0x1.2524cf7b2db82p-1,
+ 0x1.1d5a3f376e453p-2, -0x1.9eb4cd8bc99adp-5,
+ 0x1.bb1c5a5dbe9c9p-7, -0x1.171c930c92e8p-8,
+ 0x1.80a7c9fcff568p-10, -0x1.181e9be3ce165p-11,
+ 0x1.a73e97c142e39p-13, -0x1.4813dae77ef8ap-14,
+ 0x1.031c3941f802fp-15, -0x1.a2bcfc4de0d7fp-17,
+ 0x1.59184cc64fb1fp-18, 0,
+ 0, -0x1.c2e275692447dp-60,
+ 0x1.de52bebfea692p-55, -0x1.25060ccd2594ep-60},
+{0x1.2383e809a67e8p-2, 0x1.680425af12b5ep-1,
+ 0x1.f62057f7296c9p-3, -0x1.427f4cc53f5f6p-5,
+ 0x1.31b4c4359e096p-7, -0x1.56b48947a7682p-9,
+ 0x1.a54d1cab1721ep-11, -0x1.1236542ac9c9cp-12,
+ 0x1.72e00b782d86ap-14, -0x1.01a7dcc0d0814p-15,
+ 0x1.6d223dc742da4p-17, -0x1.0870d82f94961p-18,
+ 0x1.841ec9fc37c22p-20, 0,
+ 0, -0x1.823f7d79283b5p-56,
+ -0x1.452ed88f16936p-58, 0x1.79e85bf757619p-58},
+{0x1.e69eac73eab05p-2, 0x1.a346fec1dc587p-1,
+ 0x1.c012ae051645p-3, -0x1.01a88b861cc8fp-5,
+ 0x1.b696cf9d9d2p-8, -0x1.ba7d3b1fe3feap-10,
+ 0x1.ea8360ed297a1p-12, -0x1.20595555ac03cp-13,
+ 0x1.60b1e2cdc2648p-15, -0x1.bba78877d33ebp-17,
+ 0x1.1e4f279b98653p-18, -0x1.7782ec870173cp-20,
+ 0, 0,
+ 0, -0x1.05ba2664cd172p-58,
+ -0x1.3d8fa264f008bp-57, 0x1.152b2a171127ap-60},
+{0x1.62e42fefa39efp-1, 0x1.d8773039049e7p-1,
+ 0x1.94699894c1f4dp-3, -0x1.a4d55beab2d78p-6,
+ 0x1.44c8ab1f6003ap-8, -0x1.29ad8a1fcae7dp-10,
+ 0x1.2c40cad6181a1p-12, -0x1.41a130f0a10eap-14,
+ 0x1.66d55da8ce771p-16, -0x1.9c19166e8114bp-18,
+ 0x1.e5911a6fb7b89p-20, -0x1.22b078722fac5p-21,
+ 0, 0,
+ 0, 0x1.abc47d7d5bc07p-56,
+ 0x1.6e4ad1dd1a726p-58, -0x1.0c000d806e6a9p-57},
+{0x1.df216e434a8ecp-1, 0x1.0459842f5df88p+0,
+ 0x1.706ef688253b6p-3, -0x1.5df43307a7cdp-6,
+ 0x1.ede2fea1d9f7cp-9, -0x1.9e80723bdfe05p-11,
+ 0x1.7f549c4099ea4p-13, -0x1.78e71c4fbf269p-15,
+ 0x1.82561b06ade12p-17, -0x1.97f71efd592fap-19,
+ 0x1.ba02da8f7c8d6p-21, -0x1.e6c9884a11fb7p-23,
+ 0, 0,
+ 0, 0x1.7981505d3a406p-56,
+ 0x1.60942d3d5a9d2p-54, -0x1.d452efa42ac33p-60},
+{0x1.3373018970a36p+0, 0x1.1a68793defc15p+0,
+ 0x1.52494db9b8c8cp-3, -0x1.27781d4bb07c6p-6,
+ 0x1.7ff6b372edd34p-9, -0x1.29143cf566d4ap-11,
+ 0x1.fb1925110d1fcp-14, -0x1.cc912ca8be07bp-16,
+ 0x1.b470b52a3e3a8p-18, -0x1.ab89a1927d017p-20,
+ 0x1.ac4a229b0c6ep-22, 0,
+ 0, 0,
+ 0, -0x1.1f8c93f7c7471p-54,
+ 0x1.8085d134097a1p-54, -0x1.29a0231cc3df2p-60},
+{0x1.7c9ff21d3df69p+0, 0x1.2ebac53262895p+0,
+ 0x1.38ab02a5e1608p-3, -0x1.f96d28c631844p-7,
+ 0x1.3039996d26d7dp-9, -0x1.b489d10ad9946p-12,
+ 0x1.59c9bebab7d25p-14, -0x1.23b52efb99417p-16,
+ 0x1.00ee65b5b6c0bp-18, -0x1.d3fd41aa19df5p-21,
+ 0x1.b40d6ed25e2ap-23, 0,
+ 0, 0,
+ 0, 0x1.d7a5434f1a332p-54,
+ -0x1.632c26dd6cf9bp-56, -0x1.6547f4bed5813p-57},
+{0x1.cab0bfa2a2002p+0, 0x1.4190ed71d7a49p+0,
+ 0x1.22a27c22fad85p-3, -0x1.b51fa807f704ep-7,
+ 0x1.ea0c8ce2a69eep-10, -0x1.47afa064a1f07p-12,
+ 0x1.e430b5e928611p-15, -0x1.7d39cde1f23efp-17,
+ 0x1.3992556320953p-19, -0x1.0ac0c1acbbf3cp-21,
+ 0x1.d0887c62e67e3p-24, 0,
+ 0, 0,
+ 0, 0x1.91364058050f6p-55,
+ -0x1.29f12063da8e9p-55, 0x1.e647a2532ad1cp-57},
+{0x1.0ea6864c19994p+1, 0x1.531e707e22e4dp+0,
+ 0x1.0f7c989d5a3ffp-3, -0x1.7db93ef273bd1p-7,
+ 0x1.905b3ee70bcc6p-10, -0x1.f53f5604044c9p-13,
+ 0x1.5ae6e73e17654p-15, -0x1.0000b8d29695ep-17,
+ 0x1.8aeeab76c0d03p-20, -0x1.3b1f81ef59c3p-22,
+ 0x1.017740f2ab503p-24, 0,
+ 0, 0,
+ 0, 0x1.be57d4e60cf33p-53,
+ 0x1.11348f4a03ce5p-54, -0x1.9c786330dddp-57},
+{0x1.3a140a3a623cbp+1, 0x1.638d0b871453ap+0,
+ 0x1.fd639639f967bp-4, -0x1.502eac88f32dap-7,
+ 0x1.4b33e11647101p-10, -0x1.85bbe1d5c3d43p-13,
+ 0x1.fb48a2355a8bcp-16, -0x1.6034dc85d5f4ep-18,
+ 0x1.ff6ae276bde24p-21, -0x1.802a47199cb01p-23,
+ 0x1.279968f24fd94p-25, 0,
+ 0, 0,
+ 0, -0x1.1c5fbeda706abp-53,
+ -0x1.8fff0d1a76b28p-57, -0x1.97eb8faeadc8dp-59},
+{0x1.677f44aba1adcp+1, 0x1.72ff0976a6cd9p+0,
+ 0x1.dfb35186ecd97p-4, -0x1.2a4cdf25b7665p-7,
+ 0x1.150c56a69cbbcp-10, -0x1.337bfa7671808p-13,
+ 0x1.79a78bd724227p-16, -0x1.ef0a93d7c4e7bp-19,
+ 0x1.53d6f22a714b7p-21, -0x1.e20c2f05127c3p-24,
+ 0, 0,
+ 0, 0,
+ 0, 0x1.0b8dad4dc2997p-54,
+ 0x1.72bc7b3e7e025p-55, 0x1.9c635d8b751d5p-60},
+{0x1.96ca77c922cf9p+1, 0x1.8190ed71d7a49p+0,
+ 0x1.c544f845f5b06p-4, -0x1.0a74fd5d4c60bp-7,
+ 0x1.d41919c5a1b92p-11, -0x1.eb8b4e59e782bp-14,
+ 0x1.1db6b9bf756d2p-16, -0x1.629e82412cde6p-19,
+ 0x1.cd1a99bece40cp-22, -0x1.35cf0edca7658p-24,
+ 0, 0,
+ 0, 0,
+ 0, -0x1.30b27c2e6543fp-53,
+ -0x1.28ff19c810fedp-55, -0x1.4a77bac00e7bp-58},
+{0x1.c7db2a73efc17p+1, 0x1.8f5aacba5f211p+0,
+ 0x1.ad96ddf67f598p-4, -0x1.dee01b57d58f2p-8,
+ 0x1.8ef6e39dba60dp-11, -0x1.8d824858d342ep-14,
+ 0x1.b69c38a849b2ep-17, -0x1.026f3075aac3cp-19,
+ 0x1.3f1b8db1bdb18p-22, -0x1.975159a9480cep-25,
+ 0, 0,
+ 0, 0,
+ 0, -0x1.709580a62e2c5p-53,
+ 0x1.03c674cb64c6ap-57, 0x1.e3b6f8ca72326p-58},
+{0x1.fa99a5e94985ap+1, 0x1.9c7099bff7e1ep+0,
+ 0x1.9840d2469dc01p-4, -0x1.b0a2a509f0ab4p-8,
+ 0x1.56c42777680bdp-11, -0x1.44deba1fce1c3p-14,
+ 0x1.5516d1983c0f7p-17, -0x1.7e93069110e57p-20,
+ 0x1.c1b29d4ed7877p-23, -0x1.11487d5f5b097p-25,
+ 0, 0,
+ 0, 0,
+ 0, -0x1.f42a9a81c06b5p-53,
+ -0x1.f904def2f4b29p-54, -0x1.904ed8662d411p-58},
+{0x1.1778468a0d888p+2, 0x1.a8e416efea2bep+0,
+ 0x1.84ee2d5c6070fp-4, -0x1.88c417bef9295p-8,
+ 0x1.289f0357fc132p-11, -0x1.0c0df7aa4eb97p-14,
+ 0x1.0c69927401f3fp-17, -0x1.1f320054d6baap-20,
+ 0x1.4216397356f7ep-23, -0x1.75944c4edc488p-26,
+ 0, 0,
+ 0, 0,
+ 0, 0x1.f161f71fea46ap-52,
+ 0x1.e07a6efdf0e54p-55, 0x1.c9be2bdec3132p-62},
+{0x1.326643c4479c9p+2, 0x1.b4c420a50ad7cp+0,
+ 0x1.735973273d5ebp-4, -0x1.6626bc9b31b41p-8,
+ 0x1.0262026c7adeap-11, -0x1.be37a8991f664p-15,
+ 0x1.ab070ef114bb4p-18, -0x1.b4c57dfde3cbdp-21,
+ 0x1.d44e95af1f196p-24, -0x1.03b42c35ebac3p-26,
+ 0, 0,
+ 0, 0,
+ 0, 0x1.a53e75819da5ep-53,
+ 0x1.c6c18f2fa9315p-57, 0x1.02d59f808bb24p-58},
+{0x1.4e0dfde18c6e8p+2, 0x1.c01db8eb222d4p+0,
+ 0x1.634914879f472p-4, -0x1.47e8aab79469dp-8,
+ 0x1.c4dcc5ccd4899p-12, -0x1.765d8c80b2681p-15,
+ 0x1.570f15311ecaap-18, -0x1.500eba7c711dcp-21,
+ 0x1.59225e1f220cp-24, -0x1.6eb9f21f57af2p-27,
+ 0, 0,
+ 0, 0,
+ 0, -0x1.edb191724d46dp-60,
+ 0x1.462df107811c3p-56, -0x1.b1a92558dffabp-60},
+{0x1.6a676ab2aa095p+2, 0x1.cafc3ca8b2106p+0,
+ 0x1.548cfc97034dep-4, -0x1.2d5563b5604c8p-8,
+ 0x1.8f0e4c078e9c8p-12, -0x1.3c62ad5ff5656p-15,
+ 0x1.161cbb6a56e32p-18, -0x1.0560dbbaafa3bp-21,
+ 0x1.0191e09b30a7p-24, -0x1.06a55bab0e974p-27,
+ 0, 0,
+ 0, 0,
+ 0, -0x1.255b506df805ep-52,
+ 0x1.dfc86c2476d4bp-55, 0x1.31807e03ae063p-58},
+{0x1.876b2a7cb2405p+2, 0x1.d569a7a2006ebp+0,
+ 0x1.46fcb1f54c99ap-4, -0x1.15db50819cb56p-8,
+ 0x1.616e7d24a5e62p-12, -0x1.0d307c142675p-15,
+ 0x1.c6b4986132329p-19, -0x1.9aa979c039297p-22,
+ 0x1.84eaaf8ce3e96p-25, -0x1.7d30f62c388f3p-28,
+ 0, 0,
+ 0, 0,
+ 0, -0x1.31ed9522ae225p-52,
+ -0x1.f2c75ff994a56p-55, 0x1.fa3543c67a62p-58},
+{0x1.a51273acf01cap+2, 0x1.df6ecb4fb5827p+0,
+ 0x1.3a75e4ee59d08p-4, -0x1.0103f8a7d60d9p-8,
+ 0x1.3a7e7cf228395p-12, -0x1.ccec0d22e9c4ap-16,
+ 0x1.7698bd982a3b2p-19, -0x1.459731b56b3b2p-22,
+ 0x1.28c7d49f9b5e7p-25, -0x1.18022ceda8973p-28,
+ 0, 0,
+ 0, 0,
+ 0, -0x1.f675915c624bfp-53,
+ -0x1.1c6ba88a8ace6p-54, 0x1.90682eb5774cep-58},
+{0x1.c35701a50ff06p+2, 0x1.e9137b7a7e563p+0,
+ 0x1.2edb4eb166c0cp-4, -0x1.dcdc596797503p-9,
+ 0x1.19104ebb4c184p-12, -0x1.8ce3198a32109p-16,
+ 0x1.36d162a558086p-19, -0x1.0478ce832c4cdp-22,
+ 0x1.c9986ad0e2134p-26, 0,
+ 0, 0,
+ 0, 0,
+ 0, -0x1.85aa10cc2765dp-54,
+ 0x1.df7774b9de74fp-54, 0x1.ea6ed82757667p-59},
+{0x1.e233060e41f7fp+2, 0x1.f25eb2d014869p+0,
+ 0x1.2413cda19dd03p-4, -0x1.bb9333dc54f7dp-9,
+ 0x1.f86738e0c3dc8p-13, -0x1.5794bcfc9b6dep-16,
+ 0x1.039e9664d4dbbp-19, -0x1.a3e19d919bf48p-23,
+ 0x1.63ef137f5e17bp-26, 0,
+ 0, 0,
+ 0, 0,
+ 0, 0x1.3cf56b7953ffbp-52,
+ -0x1.218381d90fd8dp-54, -0x1.ad101c97d3369p-58},
+{0x1.00d08e2072be8p+3, 0x1.fb56b11d42cd8p+0,
+ 0x1.1a09b033ce881p-4, -0x1.9da6ce07fee3p-9,
+ 0x1.c64f116e33777p-13, -0x1.2aeb7b4e2ab6bp-16,
+ 0x1.b467d91a2eb9dp-20, -0x1.54f0e5f90083p-23,
+ 0x1.17404d5005f65p-26, 0,
+ 0, 0,
+ 0, 0,
+ 0, 0x1.af6c1df756b8bp-51,
+ -0x1.859ac82194001p-55, 0x1.fc59336cf0e16p-58},
+{0x1.10ce1f32dcc3p+3, 0x1.02008a3a23e5dp+1,
+ 0x1.10aa239ffbc61p-4, -0x1.82a72a487673dp-9,
+ 0x1.9aa036fc83286p-13, -0x1.0546c80dbaed3p-16,
+ 0x1.70ea8086e2a38p-20, -0x1.16c3abac00161p-23,
+ 0x1.b9b75e984488dp-27, 0,
+ 0, 0,
+ 0, 0,
+ 0, -0x1.a6cb274a1b957p-52,
+ -0x1.f58d2c017d13bp-53, 0x1.35c4687e9febap-59},
+},
+// lgamma(x) - (x - 0.5)*log(x) + x - log(2*pi)/2 ~= poly(z)/x, z = 1/x^2,
+// for x >= 8.  Absolute error: 2^-60.5
+.stirling = {
+0x1.5555555555555p-4,
+-0x1.6c16c16c14af5p-9,
+0x1.a01a017e89fffp-11,
+-0x1.38134e15d6fd7p-11,
+0x1.b92c93663d914p-11,
+-0x1.ef980aaa3ed2ap-10,
+0x1.4c382d92a2bf2p-8,
+},
+// sin(pi*r) ~= r*poly(z), z = r*r, for |r| <= 0.5, where the first two
+// coefficients are sinpi[i] + sinpi_lo[i].
+// Relative error: 2^-61.7
+.pi_lo = 0x1.1a62633145c07p-53,
+.sinpi_lo = {0x1.18855f1c978dfp-53, -0x1.73260376df77ap-53},
+.sinpi = {
+0x1.921fb54442d18p+1,
+-0x1.4abbce625be52p+2,
+0x1.466bc6775aa6ep+1,
+-0x1.32d2cce627543p-1,
+0x1.50783485190cbp-4,
+-0x1.e3074ddd1d70fp-8,
+0x1.e8f35e9d59f33p-12,
+-0x1.6f79770c63becp-16,
+0x1.9d1b8696e9034p-21,
+},
+.hlog2pi_hi = 0x1.d67f1c864beb5p-1,
+.hlog2pi_lo = -0x1.65b5a1b7ff5dfp-55,
+.logpi_hi = 0x1.250d048e7a1bdp+0,
+.logpi_lo = 0x1.7abf2ad8d5088p-57,
+};
+
+#endif /* !__OBSOLETE_MATH */
@@ -0,0 +1,75 @@
+/* Header for sinh, cosh, tanh and their float variants.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include <stdint.h>
+#include <math.h>
+#include "math_config.h"
+
+#define N (1 << EXP_TABLE_BITS)
+#define InvLn2N __exp_data.invln2N
+#define NegLn2hiN __exp_data.negln2hiN
+#define NegLn2loN __exp_data.negln2loN
+#define Shift __exp_data.shift
+#define T __exp_data.tab
+#define C2 __exp_data.poly[5 - EXP_POLY_ORDER]
+#define C3 __exp_data.poly[6 - EXP_POLY_ORDER]
+#define C4 __exp_data.poly[7 - EXP_POLY_ORDER]
+#define C5 __exp_data.poly[8 - EXP_POLY_ORDER]
+#define C6 __exp_data.poly[9 - EXP_POLY_ORDER]
+
+/* Return HI such that HI + *LO is e^X for |X| < 708, computed like exp
+   but without its final rounding, so that the relative error of the sum
+   is about 2^-60.  HI is the table value of 2^(k/N) nearest e^X and
+   |*LO| < 2^-7 HI.  */
+static inline double
+exp_hilo (double x, double *lo)
+{
+  uint64_t ki, idx, top, sbits;
+  double_t kd, z, r, r2, scale, tail, tmp;
+
+  z = InvLn2N * x;
+#if TOINT_INTRINSICS
+  kd = roundtoint (z);
+  ki = converttoint (z);
+#elif EXP_USE_TOINT_NARROW
+  kd = eval_as_double (z + Shift);
+  ki = asuint64 (kd) >> 16;
+  kd = (double_t) (int32_t) ki;
+#else
+  kd = eval_as_double (z + Shift);
+  ki = asuint64 (kd);
+  kd -= Shift;
+#endif
+  r = x + kd * NegLn2hiN + kd * NegLn2loN;
+  idx = 2 * (ki % N);
+  top = ki << (52 - EXP_TABLE_BITS);
+  tail = asdouble (T[idx]);
+  sbits = T[idx + 1] + top;
+  r2 = r * r;
+#if EXP_POLY_ORDER == 4
+  tmp = tail + r + r2 * C2 + r * r2 * (C3 + r * C4);
+#elif EXP_POLY_ORDER == 5
+  tmp = tail + r + r2 * (C2 + r * C3) + r2 * r2 * (C4 + r * C5);
+#elif EXP_POLY_ORDER == 6
+  tmp = tail + r + r2 * (0.5 + r * C3) + r2 * r2 * (C4 + r * C5 + r2 * C6);
+#endif
+  scale = asdouble (sbits);
+  *lo = scale * tmp;
+  return scale;
+}
+
+/* Return e^X / 2 for 709 <= X <= 0x1.633ce8fb9f87dp+9, where e^X overflows.
+   It is (e^(X/2))^2 / 2 with e^(X/2) in hi + lo form and an exact square
+   of the high part, scaled by 2^-512 so that only the final rounding can
+   overflow.  */
+static inline double
+exp_half_big (double x)
+{
+  double e, el, h, hl;
+
+  e = exp_hilo (0.5 * x, &el);
+  e *= 0x1p-512;
+  el *= 0x1p-512;
+  h = mul_hilo (e, e, &hl);
+  return (h + (hl + el * (2.0 * e + el))) * 0x1p1023;
+}
@@ -0,0 +1,94 @@
+/* Double-precision hypot function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include <stdint.h>
+#include "math_config.h"
+
+static inline double
+sqrt_inline (double x)
+{
+#ifdef __GNUC__
+  return __builtin_sqrt (x);
+#else
+  return sqrt (x);
+#endif
+}
+
+/* Return HI such that HI + *LO is X * X exactly, unless *LO underflows.  */
+static inline double
+sq_hilo (double x, double *lo)
+{
+  double hi = x * x;
+#if HAVE_FAST_FMA
+  *lo = __builtin_fma (x, x, -hi);
+#else
+  double c = 0x1.0000002p27 * x;
+  double xh = c - (c - x);
+  double xl = x - xh;
+
+  *lo = (xh * xh - hi) + 2 * xh * xl + xl * xl;
+#endif
+  return hi;
+}
+
+/* The squares are summed exactly up to the rounding of the small parts,
+   and the square root of the sum is corrected once.  Inputs are only
+   scaled when a square could overflow or lose bits to underflow.  Worst-
+   case error is about 0.51 ULP, and more for subnormal results, which are
+   rounded twice.  */
+double
+hypot (double x, double y)
+{
+  uint64_t ix = asuint64 (x) & 0x7fffffffffffffff;
+  uint64_t iy = asuint64 (y) & 0x7fffffffffffffff;
+  uint64_t t;
+  double scale, hx, lx, hy, ly, s, e, r, hr, lr;
+  int ex, ey;
+
+  if (ix < iy)
+    {
+      t = ix;
+      ix = iy;
+      iy = t;
+    }
+  x = asdouble (ix);
+  y = asdouble (iy);
+  ex = ix >> 52;
+  ey = iy >> 52;
+  scale = 1.0;
+  if (unlikely (ex - ey > 54 || ex > 0x3ff + 500 || ey < 0x3ff - 450))
+    {
+      if (ex == 0x7ff)
+	return iy == 0x7ff0000000000000 ? y : x + y;
+      if (iy == 0 || ex - ey > 54)
+	return x + y;
+      if (ex > 0x3ff + 500)
+	{
+	  x *= 0x1p-600;
+	  y *= 0x1p-600;
+	  scale = 0x1p600;
+	}
+      else
+	{
+	  x *= 0x1p600;
+	  y *= 0x1p600;
+	  scale = 0x1p-600;
+	}
+    }
+
+  hx = sq_hilo (x, &lx);
+  hy = sq_hilo (y, &ly);
+  s = hx + hy;
+  e = (hx - s) + hy + lx + ly;
+  r = sqrt_inline (s);
+  hr = sq_hilo (r, &lr);
+  r += ((s - hr) - lr + e) / (2 * r);
+  if (unlikely (scale != 1.0))
+    return check_oflow (scale * r);
+  return r;
+}
+
+#endif /* !__OBSOLETE_MATH */
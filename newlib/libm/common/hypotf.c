@@ -0,0 +1,43 @@
+/* Single-precision hypot function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include <stdint.h>
+#include "math_config.h"
+
+static inline double
+sqrt_inline (double x)
+{
+#ifdef __GNUC__
+  return __builtin_sqrt (x);
+#else
+  return sqrt (x);
+#endif
+}
+
+/* The squares are exact in double and the double result has a relative
+   error below 2^-52, so the float result is within 0.501 ULP without
+   scaling.  */
+float
+hypotf (float x, float y)
+{
+  uint32_t ix = asuint (x) & 0x7fffffff;
+  uint32_t iy = asuint (y) & 0x7fffffff;
+  double dx = x, dy = y;
+  float r;
+
+  if (unlikely (ix >= 0x7f800000 || iy >= 0x7f800000))
+    {
+      if (ix == 0x7f800000 || iy == 0x7f800000)
+	return INFINITY;
+      return x + y;
+    }
+  r = sqrt_inline (dx * dx + dy * dy);
+  if (unlikely (asuint (r) == 0x7f800000))
+    return __math_oflowf (0);
+  return r;
+}
+
+#endif /* !__OBSOLETE_MATH */
@@ -0,0 +1,123 @@
+/* Header for atan, atan2, asin, acos and their float variants.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include <stdint.h>
+#include <math.h>
+#include "math_config.h"
+
+#define PIO2_HI __atan_data.pio2_hi
+#define PIO2_LO __atan_data.pio2_lo
+#define AT __atan_data.tab
+
+/* Biased exponents bounding the table of atan_data.  */
+#define ATAN_TAB_MIN (0x3ff - 5)
+#define ATAN_TAB_MAX (0x3ff + 6)
+
+/* atan (T) - T for |T| <= 2^-5, with Z = T * T.  */
+static inline double
+atan_poly (double t, double z)
+{
+  const double *c = __atan_data.poly;
+  double z2 = z * z;
+
+  return t * z * (c[0] + z * c[1] + z2 * (c[2] + z * c[3]));
+}
+
+/* For X with biased exponent between ATAN_TAB_MIN and ATAN_TAB_MAX, return
+   the index of the table entry for C, the middle of the interval X is in.  */
+static inline int
+atan_tab_index (double x, double *c)
+{
+  uint64_t ix = asuint64 (x);
+  uint64_t mask = -(1ULL << (52 - ATAN_TABLE_BITS));
+
+  *c = asdouble ((ix & mask) | (1ULL << (51 - ATAN_TABLE_BITS)));
+  return (ix >> (52 - ATAN_TABLE_BITS)) - (ATAN_TAB_MIN << ATAN_TABLE_BITS);
+}
+
+/* Coefficients of asin (x) ~= x + x * z * asin_poly (z) for z = x * x in
+   [0, 0.25].  The error of z * asin_poly (z) is below 2^-58.7, which
+   replaces the rational approximation of e_asin.c and its division.  */
+static const double asin_c[13] = {
+  0x1.5555555555578p-3,
+  0x1.333333332df7ep-4,
+  0x1.6db6db72260f9p-5,
+  0x1.f1c71a8dc1c68p-6,
+  0x1.6e8bdfa69910dp-6,
+  0x1.1c49e2b8737c2p-6,
+  0x1.ca20ce55a41f3p-7,
+  0x1.757b77df6c755p-7,
+  0x1.6173ff4a30854p-7,
+  0x1.e2bdea52c8d0dp-9,
+  0x1.6492dd9124e3ap-6,
+  -0x1.5954c0a131d65p-6,
+  0x1.0bb0759b36e02p-5,
+};
+
+/* Estrin scheme, which gives a short dependency chain.  */
+static inline double
+asin_poly (double z)
+{
+  const double *c = asin_c;
+  double z2 = z * z;
+  double z4 = z2 * z2;
+  double z8 = z4 * z4;
+  double p01 = c[0] + z * c[1];
+  double p23 = c[2] + z * c[3];
+  double p45 = c[4] + z * c[5];
+  double p67 = c[6] + z * c[7];
+  double p89 = c[8] + z * c[9];
+  double p1011 = c[10] + z * c[11];
+  double p03 = p01 + z2 * p23;
+  double p47 = p45 + z2 * p67;
+  double p812 = p89 + z2 * p1011 + z4 * c[12];
+
+  return p03 + z4 * p47 + z8 * p812;
+}
+
+/* Top 32 bits of |x|.  */
+static inline uint32_t
+abstop32 (double x)
+{
+  return (asuint64 (x) >> 32) & 0x7fffffff;
+}
+
+/* Square root, as an instruction where the target has one even with
+   -fno-builtin, as the fdlibm code called the software __ieee754_sqrt.  */
+static inline double
+sqrt_inline (double x)
+{
+#ifdef __GNUC__
+  return __builtin_sqrt (x);
+#else
+  return sqrt (x);
+#endif
+}
+
+/* S with the low 32 bits cleared, so that its square is exact.  */
+static inline double
+trunc32 (double s)
+{
+  return asdouble (asuint64 (s) & 0xffffffff00000000);
+}
+
+/* atan (T) - T to about 2^-32 relative precision for |T| <= 2^-5, for the
+   float variants.  */
+static inline double
+atanf_poly (double t, double z)
+{
+  return t * z * (-0x1.5555555555555p-2 + z * 0x1.999999999999ap-3);
+}
+
+/* asin (x) ~= x + x * z * asinf_poly (z) for z = x * x in [0, 0.25], with
+   an error below 2^-31.7, for the float variants.  */
+static inline double
+asinf_poly (double z)
+{
+  double z2 = z * z;
+  double z4 = z2 * z2;
+
+  return (0x1.55554c36aae7p-3 + z * 0x1.33388eaf96991p-4)
+	 + z2 * (0x1.6cac3b3a82c3bp-5 + z * 0x1.04a65f4c98d78p-5)
+	 + z4 * (0x1.d7f1bca85d8a8p-7 + z * 0x1.33bbf790831b3p-5);
+}
@@ -0,0 +1,183 @@
+/* Double-precision log gamma function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include <reent.h>
+#include "gamma.h"
+
+/* Return HI such that HI + *LO is t * (c0 + c1 * t + t^2 * P) for the
+   polynomials near 1 and 2, where C and CLO are the high and low parts of
+   c0 and c1.  The terms c0 * t and c1 * t^2 cancel for t < 0 near 1 and
+   near 2, so both are summed in double-double.  */
+static inline double
+lgamma_sum (double t, const double *c, const double *clo, double p,
+	    double *lo)
+{
+  double hi, l, th, tl, ph, pl, e;
+
+  hi = mul_hilo (t, c[0], &l);
+  th = mul_hilo (t, t, &tl);
+  ph = mul_hilo (th, c[1], &pl);
+  hi = add_hilo (hi, ph, &e);
+  *lo = l + e + pl + t * clo[0] + tl * c[1] + th * (clo[1] + t * p);
+  return hi;
+}
+
+static inline double
+lgamma_near1 (double t, double *lo)
+{
+  const double *c = __gamma_data.lgam1;
+  double t2 = t * t;
+  double t4 = t2 * t2;
+  double t8 = t4 * t4;
+  double p;
+
+  p = (c[2] + t * c[3]) + t2 * (c[4] + t * c[5])
+      + t4 * ((c[6] + t * c[7]) + t2 * (c[8] + t * c[9]))
+      + t8 * ((c[10] + t * c[11]) + t2 * (c[12] + t * c[13]) + t4 * c[14]);
+  return lgamma_sum (t, c, __gamma_data.lgam1_lo, p, lo);
+}
+
+static inline double
+lgamma_near2 (double t, double *lo)
+{
+  const double *c = __gamma_data.lgam2;
+  double t2 = t * t;
+  double t4 = t2 * t2;
+  double t8 = t4 * t4;
+  double p;
+
+  p = (c[2] + t * c[3]) + t2 * (c[4] + t * c[5])
+      + t4 * ((c[6] + t * c[7]) + t2 * (c[8] + t * c[9]))
+      + t8 * (c[10] + t * c[11]);
+  return lgamma_sum (t, c, __gamma_data.lgam2_lo, p, lo);
+}
+
+/* Return HI such that HI + *LO is lgamma (c + T) for the polynomial of
+   row I of the table.  */
+static inline double
+lgamma_tab (int i, double t, double *lo)
+{
+  const double *c = __gamma_data.lgam_tab[i];
+  double t2 = t * t;
+  double t4 = t2 * t2;
+  double t8 = t4 * t4;
+  double p, hi, ph, pl, e;
+
+  p = (c[3] + t * c[4]) + t2 * (c[5] + t * c[6])
+      + t4 * ((c[7] + t * c[8]) + t2 * (c[9] + t * c[10]))
+      + t8 * ((c[11] + t * c[12]) + t2 * (c[13] + t * c[14]));
+  if (i >= 5)
+    {
+      /* Above 2.625 lgamma (x) > 0.37, so only c0 + c1 * t needs to be
+	 exact.  */
+      ph = mul_hilo (t, c[1], &pl);
+      hi = add_hilo (c[0], ph, &e);
+      *lo = e + pl + c[15] + t * c[16] + t2 * (c[2] + t * p);
+      return hi;
+    }
+  hi = lgamma_sum (t, c + 1, c + 16, p, &pl);
+  hi = add_hilo (c[0], hi, &e);
+  *lo = e + (pl + c[15]);
+  return hi;
+}
+
+/* Return HI such that HI + *LO is lgamma (X) for 2^-54 <= X < 2^1014.  */
+static inline double
+lgamma_pos (double x, double *lo)
+{
+  double hi, l, xh, xl, e;
+  int i;
+
+  if (x >= 8.0)
+    return lgamma_stirling (x, lo);
+  /* The polynomials cover the zeros at 1 and 2, where the table would lose
+     relative precision.  */
+  if (x >= 0.875 && x <= 1.125)
+    return lgamma_near1 (x - 1.0, lo);
+  if (x >= 1.875 && x <= 2.125)
+    return lgamma_near2 (x - 2.0, lo);
+  if (x < 0.875)
+    {
+      /* lgamma (1 + x) - log (x), where 1 + x is not rounded.  */
+      if (x < 0.125)
+	hi = lgamma_near1 (x, &l);
+      else
+	{
+	  i = (x - 0.125) * 4;
+	  hi = lgamma_tab (i, x - (0.25 + i * 0.25), &l);
+	}
+      xh = log_hilo (x, &xl);
+      hi = add_hilo (hi, -xh, &e);
+      *lo = e + (l - xl);
+      return hi;
+    }
+  /* Intervals of width 1/4 from 1.125, the one around 2 is not in the
+     table.  */
+  i = (x - 1.125) * 4;
+  return lgamma_tab (i - (i > 3), x - (1.25 + i * 0.25), lo);
+}
+
+/* lgamma_pos uses a table of polynomials below 8 and the Stirling series
+   above, with about 2^-58 relative error.  For negative x
+   lgamma (x) = log (pi / |x * sin (pi * x)|) - lgamma (-x).  Worst-case
+   error is about 0.55 ULP for positive x and 0.9 ULP for -2 < x < 0.
+   Below -2 the two terms cancel near the zeros of lgamma: the absolute
+   error stays around 2^-53, so the error in ULP has no useful bound
+   there and is largest at the doubles closest to a zero.  */
+double
+lgamma_r (double x, int *signgamp)
+{
+  uint64_t ix = asuint64 (x);
+  uint64_t ia = ix & 0x7fffffffffffffff;
+  double hi, lo, r, gh, gl, e;
+  int odd, neg;
+
+  *signgamp = 1;
+  if (unlikely (ia - asuint64 (0x1p-54)
+		>= asuint64 (0x1.754d9278b51a7p+1014) - asuint64 (0x1p-54)))
+    {
+      if (ia >= 0x7ff0000000000000)
+	return x * x;
+      if (ia < asuint64 (0x1p-54))
+	{
+	  if (ix >> 63)
+	    *signgamp = -1;
+	  if (ia == 0)
+	    return __math_divzero (0);
+	  /* lgamma (x) = -log |x| - euler * x + O(x^2).  */
+	  return -log (asdouble (ia));
+	}
+      if ((ix >> 63) == 0)
+	return __math_oflow (0);
+    }
+
+  if ((ix >> 63) == 0)
+    {
+      hi = lgamma_pos (x, &lo);
+      return hi + lo;
+    }
+
+  /* All doubles below -2^52 are even integers.  */
+  if (unlikely (x <= -0x1p52))
+    return __math_divzero (0);
+  r = x - round_parity (x, &odd);
+  if (unlikely (r == 0.0))
+    return __math_divzero (0);
+  hi = log_reflect (x, r, odd, &lo, &neg);
+  if (neg)
+    *signgamp = -1;
+  gh = lgamma_pos (-x, &gl);
+  hi = add_hilo (hi, -gh, &e);
+  return hi + (e + (lo - gl));
+}
+
+double
+lgamma (double x)
+{
+  return lgamma_r (x, &(_REENT_SIGNGAM(_REENT)));
+}
+
+#endif /* !__OBSOLETE_MATH */
@@ -0,0 +1,117 @@
+/* Single-precision log gamma function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include <reent.h>
+#include "gamma.h"
+
+/* t * poly (t) of the double variant near 1 or 2, in double precision.
+   Adding 0 gives lgamma (1) = +0 rather than -0.  */
+static inline double
+lgammaf_near (const double *c, int n, double t)
+{
+  double p = c[n - 1];
+  int i;
+
+  for (i = n - 2; i >= 0; i--)
+    p = c[i] + t * p;
+  return t * p + 0.0;
+}
+
+/* lgamma (c + T) for row I of the table of the double variant, in double
+   precision.  */
+static inline double
+lgammaf_tab (int i, double t)
+{
+  const double *c = __gamma_data.lgam_tab[i];
+  double t2 = t * t;
+  double t4 = t2 * t2;
+  double t8 = t4 * t4;
+  double p;
+
+  p = (c[1] + t * c[2]) + t2 * (c[3] + t * c[4])
+      + t4 * ((c[5] + t * c[6]) + t2 * (c[7] + t * c[8]))
+      + t8 * ((c[9] + t * c[10]) + t2 * (c[11] + t * c[12])
+	      + t4 * (c[13] + t * c[14]));
+  return c[0] + t * p;
+}
+
+/* lgamma (X) for 2^-30 <= X < 2^122.  */
+static inline double
+lgammaf_pos (double x)
+{
+  int i;
+
+  if (x >= 8.0)
+    return lgammaf_stirling (x);
+  if (x >= 0.875 && x <= 1.125)
+    return lgammaf_near (__gamma_data.lgam1, 11, x - 1.0);
+  if (x >= 1.875 && x <= 2.125)
+    return lgammaf_near (__gamma_data.lgam2, 9, x - 2.0);
+  if (x < 0.875)
+    {
+      /* lgamma (1 + x) - log (x).  */
+      if (x < 0.125)
+	return lgammaf_near (__gamma_data.lgam1, 11, x) - log (x);
+      i = (x - 0.125) * 4;
+      return lgammaf_tab (i, x - (0.25 + i * 0.25)) - log (x);
+    }
+  i = (x - 1.125) * 4;
+  return lgammaf_tab (i - (i > 3), x - (1.25 + i * 0.25));
+}
+
+/* lgamma computed in double precision with the polynomials of the double
+   variant.  Worst-case error is about 0.51 ULP for x > -2 and larger near
+   the zeros of lgamma below -2.  */
+float
+lgammaf_r (float x, int *signgamp)
+{
+  uint32_t ix = asuint (x);
+  uint32_t ia = ix & 0x7fffffff;
+  double r, s;
+  int odd;
+
+  *signgamp = 1;
+  /* |x| < 2^-30 or x >= 0x1.895f1cp121.  */
+  if (unlikely (ia - 0x30800000 >= 0x7c44af8e - 0x30800000))
+    {
+      if (ia >= 0x7f800000)
+	return x * x;
+      if (ia < 0x30800000)
+	{
+	  if (ix >> 31)
+	    *signgamp = -1;
+	  if (ia == 0)
+	    return __math_divzerof (0);
+	  /* lgamma (x) = -log |x| - euler * x + O(x^2).  */
+	  return -log (asfloat (ia));
+	}
+      if ((ix >> 31) == 0)
+	return __math_oflowf (0);
+    }
+
+  if ((ix >> 31) == 0)
+    return lgammaf_pos (x);
+
+  /* All floats below -2^23 are integers.  */
+  if (unlikely (x <= -0x1p23f))
+    return __math_divzerof (0);
+  r = x - round_parity (x, &odd);
+  if (unlikely (r == 0.0))
+    return __math_divzerof (0);
+  if (odd ^ (r < 0.0))
+    *signgamp = -1;
+  /* log (pi / |x * sin (pi * x)|) - lgamma (-x).  */
+  s = asdouble (asuint64 (x * sinpif (r)) & 0x7fffffffffffffff);
+  return log (__gamma_data.sinpi[0] / s) - lgammaf_pos (-x);
+}
+
+float
+lgammaf (float x)
+{
+  return lgammaf_r (x, &(_REENT_SIGNGAM(_REENT)));
+}
+
+#endif /* !__OBSOLETE_MATH */
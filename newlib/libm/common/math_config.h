@@ -148,6 +148,63 @@ asdouble (uint64_t i)
   return u.f;
 }
 
+/* Number of leading zero bits of a non-zero X.  */
+static inline int
+clz64 (uint64_t x)
+{
+#ifdef __GNUC__
+  return __builtin_clzll (x);
+#else
+  int n = 0;
+
+  while ((x & 0x8000000000000000) == 0)
+    {
+      x <<= 1;
+      n++;
+    }
+  return n;
+#endif
+}
+
+/* Return the high half of the 128-bit product X * Y and store the low half
+   in *LO.  */
+static inline uint64_t
+mul64 (uint64_t x, uint64_t y, uint64_t *lo)
+{
+#ifdef __SIZEOF_INT128__
+  unsigned __int128 p = (unsigned __int128) x * y;
+
+  *lo = p;
+  return p >> 64;
+#else
+  uint64_t xl = x & 0xffffffff, xh = x >> 32;
+  uint64_t yl = y & 0xffffffff, yh = y >> 32;
+  uint64_t ll = xl * yl, lh = xl * yh, hl = xh * yl;
+  uint64_t mid = (ll >> 32) + (lh & 0xffffffff) + (hl & 0xffffffff);
+
+  *lo = mid << 32 | (ll & 0xffffffff);
+  return xh * yh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+}
+
+/* Return HI with A * B = HI + *LO exactly, unless the product is tiny.  */
+static inline double
+mul_hilo (double a, double b, double *lo)
+{
+  double hi = a * b;
+#if HAVE_FAST_FMA
+  *lo = fma (a, b, -hi);
+#else
+  double ah = asdouble (asuint64 (a) & 0xfffffffff8000000);
+  double bh = asdouble (asuint64 (b) & 0xfffffffff8000000);
+  double al = a - ah;
+  double bl = b - bh;
+
+  *lo = ((ah * bh - hi) + ah * bl + al * bh) + al * bl;
+#endif
+  return hi;
+}
+
 #ifndef IEEE_754_2008_SNAN
 # define IEEE_754_2008_SNAN 1
 #endif
@@ -417,4 +474,53 @@ extern const struct pow_log_data
   struct {double invc, pad, logc, logctail;} tab[1 << POW_LOG_TABLE_BITS];
 } __pow_log_data HIDDEN;
 
+/* Shared between atan, atan2, atanf and atan2f.  The table has 2^BITS
+   entries per binade between 2^-5 and 2^6.  */
+#define ATAN_TABLE_BITS 3
+#define ATAN_POLY_ORDER 4
+extern const struct atan_data
+{
+  double pio2_hi;
+  double pio2_lo;
+  double poly[ATAN_POLY_ORDER]; /* First coefficient is 1.  */
+  struct {double hi, lo;} tab[11 << ATAN_TABLE_BITS];
+} __atan_data HIDDEN;
+
+/* Shared between tgamma, lgamma and their float variants.  */
+#define GAMMA_TABLE_BITS 3
+#define GAMMA_POLY_ORDER 12
+#define LGAMMA1_POLY_ORDER 15
+#define LGAMMA2_POLY_ORDER 12
+#define LGAMMA_TAB_POLY_ORDER 15
+#define STIRLING_POLY_ORDER 7
+#define SINPI_POLY_ORDER 9
+extern const struct gamma_data
+{
+  /* gamma (c) rounded followed by the polynomial coefficients.  */
+  double tab[1 << GAMMA_TABLE_BITS][GAMMA_POLY_ORDER + 1];
+  double lgam1_lo[2], lgam1[LGAMMA1_POLY_ORDER];
+  double lgam2_lo[2], lgam2[LGAMMA2_POLY_ORDER];
+  /* Polynomials followed by the low parts of the first three coefficients.  */
+  double lgam_tab[27][LGAMMA_TAB_POLY_ORDER + 3];
+  double stirling[STIRLING_POLY_ORDER];
+  double pi_lo, sinpi_lo[2], sinpi[SINPI_POLY_ORDER];
+  double hlog2pi_hi, hlog2pi_lo;
+  double logpi_hi, logpi_lo;
+} __gamma_data HIDDEN;
+
+/* Shared between erf, erfc, erff and erfcf.  The tables have polynomials
+   for intervals of width 1/4 up to 6.125.  */
+#define ERF_POLY_ORDER 10
+#define ERF_TAB_POLY_ORDER 12
+#define ERFC_ASYM_POLY_ORDER 12
+extern const struct erf_data
+{
+  double poly[ERF_POLY_ORDER];
+  /* The function at the middle of the interval rounded, followed by the
+     polynomial coefficients.  */
+  double erf_tab[22][ERF_TAB_POLY_ORDER + 1];
+  double erfc_tab[23][ERF_TAB_POLY_ORDER + 1];
+  double asym[ERFC_ASYM_POLY_ORDER];
+} __erf_data HIDDEN;
+
 #endif
@@ -15,21 +15,20 @@ DESCRIPTION
 The <<fma>> functions compute (<[x]> * <[y]>) + <[z]>, rounded as one ternary
 operation:  they compute the value (as if) to infinite precision and round once
 to the result format, according to the rounding mode characterized by the value
-of FLT_ROUNDS.  That is, they are supposed to do this:  see below.
+of FLT_ROUNDS.
+
+<<fma>> computes the exact product and sum with 128-bit integer arithmetic.
+<<fmaf>> computes them in double and corrects the rare sums that the
+conversion to float would round twice.
 
 RETURNS
 The <<fma>> functions return (<[x]> * <[y]>) + <[z]>, rounded as one ternary
-operation.
+operation.  <<fma>> sets <<errno>> to <<ERANGE>> when the result
+overflows.
 
 BUGS
-This implementation does not provide the function that it should, purely
-returning "(<[x]> * <[y]>) + <[z]>;" with no attempt at all to provide the
-simulated infinite precision intermediates which are required.  DO NOT USE THEM.
-
-If double has enough more precision than float, then <<fmaf>> should provide
-the expected numeric results, as it does use double for the calculation.  But
-since this is not the case for all platforms, this manual cannot determine
-if it is so for your case.
+Where double has the same precision as float, <<fma>> and <<fmaf>> round
+twice.
 
 PORTABILITY
 ANSI C, POSIX.
@@ -37,20 +36,168 @@ ANSI C, POSIX.
 */
 
 #include "fdlibm.h"
+#include "math_config.h"
 
 #ifndef _DOUBLE_IS_32BITS
 
-#ifdef __STDC__
-	double fma(double x, double y, double z)
-#else
-	double fma(x,y)
-	double x;
-	double y;
-        double z;
-#endif
+/* Shift the 128-bit *HI:*LO right by N bits, and set the lowest bit if any
+   non-zero bit is shifted out.  */
+static inline void
+shr_sticky (uint64_t *hi, uint64_t *lo, int n)
+{
+  uint64_t h = *hi, l = *lo, sticky;
+
+  if (n == 0)
+    return;
+  if (n < 64)
+    {
+      sticky = l << (64 - n) != 0;
+      l = h << (64 - n) | l >> n;
+      h >>= n;
+    }
+  else if (n < 128)
+    {
+      sticky = l != 0 || (n > 64 && h << (128 - n) != 0);
+      l = h >> (n - 64);
+      h = 0;
+    }
+  else
+    {
+      sticky = (h | l) != 0;
+      l = h = 0;
+    }
+  *hi = h;
+  *lo = l | sticky;
+}
+
+/* Return the significand of the finite non-zero IX scaled to [2^52, 2^53)
+   and set *E such that the value is the significand times 2^(*E - 1075).  */
+static inline uint64_t
+normalize (uint64_t ix, int *e)
+{
+  int k;
+
+  *e = ix >> 52 & 0x7ff;
+  ix &= 0x000fffffffffffff;
+  if (*e != 0)
+    return ix | 0x0010000000000000;
+  k = clz64 (ix) - 11;
+  *e = 1 - k;
+  return ix << k;
+}
+
+/* The product and z are aligned in 128 bits, with the bits shifted out of
+   the smaller one kept as a sticky bit, and the exact sum is rounded once
+   by the conversion of a 63-bit integer to double.  */
+double
+fma (double x, double y, double z)
 {
-  /* Implementation defined. */
-  return (x * y) + z;
+  uint64_t ix = asuint64 (x), iy = asuint64 (y), iz = asuint64 (z);
+  uint64_t mx, my, mz, ph, pl, zh, zl, rh, rl, sign, m, j;
+  int ex, ey, ez, e, d, n;
+  double r;
+
+  ex = ix >> 52 & 0x7ff;
+  ey = iy >> 52 & 0x7ff;
+  ez = iz >> 52 & 0x7ff;
+  if (unlikely (ex == 0x7ff || ey == 0x7ff || ez == 0x7ff || (ix << 1) == 0
+		|| (iy << 1) == 0 || (iz << 1) == 0))
+    {
+      /* The product is exact, so x * y + z rounds once.  */
+      if (ex == 0x7ff || ey == 0x7ff || (ix << 1) == 0 || (iy << 1) == 0)
+	return x * y + z;
+      /* x * y may overflow to an infinity of the other sign.  */
+      if (ez == 0x7ff)
+	return z + z;
+      /* x * y + z would give the wrong zero if x * y underflows.  */
+      return x * y;
+    }
+
+  /* The product is P * 2^(ex + ey - 2170) with P in [2^124, 2^126), and z
+     is Z * 2^(ez - 1148) with Z in [2^125, 2^126).  */
+  mx = normalize (ix, &ex);
+  my = normalize (iy, &ey);
+  mz = normalize (iz, &ez);
+  ph = mul64 (mx, my, &pl);
+  ph = ph << 20 | pl >> 44;
+  pl <<= 20;
+  zh = mz << 9;
+  zl = 0;
+  ex = ex + ey - 2170;
+  ez -= 1148;
+  d = ex - ez;
+  if (d >= 0)
+    {
+      shr_sticky (&zh, &zl, d);
+      e = ex;
+    }
+  else
+    {
+      shr_sticky (&ph, &pl, -d);
+      e = ez;
+    }
+
+  /* Only the shifted operand can have a sticky bit, so the result is odd
+     whenever it is inexact and the rounding below sees the right side of
+     any tie.  */
+  sign = (ix ^ iy) & 0x8000000000000000;
+  if (sign == (iz & 0x8000000000000000))
+    {
+      rl = pl + zl;
+      rh = ph + zh + (rl < pl);
+    }
+  else if (ph > zh || (ph == zh && pl >= zl))
+    {
+      rl = pl - zl;
+      rh = ph - zh - (pl < zl);
+    }
+  else
+    {
+      rl = zl - pl;
+      rh = zh - ph - (zl < pl);
+      sign ^= 0x8000000000000000;
+    }
+  /* Exact cancellation gives -0 only when rounding downward.  */
+  if (unlikely ((rh | rl) == 0))
+    return z - z;
+
+  /* Scale the result to M * 2^E with M in [2^62, 2^63).  */
+  n = rh != 0 ? 128 - clz64 (rh) : 64 - clz64 (rl);
+  if (n > 63)
+    {
+      shr_sticky (&rh, &rl, n - 63);
+      m = rl;
+      e += n - 63;
+    }
+  else
+    {
+      m = rl << (63 - n);
+      e -= 63 - n;
+    }
+
+  if (likely (e >= -1084))
+    {
+      /* The conversion rounds to 53 bits in the current rounding mode, and
+	 the exponent is adjusted exactly afterwards.  */
+      r = sign ? (double) -(int64_t) m : (double) (int64_t) m;
+      if (unlikely ((int) (asuint64 (r) >> 52 & 0x7ff) + e > 0x7fe))
+	return __math_oflow (sign != 0);
+      return asdouble (asuint64 (r) + ((uint64_t) e << 52));
+    }
+
+  /* The result is below 2^-1022.  With J in units of 2^-1084, the
+     conversion of 2^62 + J rounds J to a multiple of 2^10, which is
+     2^-1074.  */
+  zh = 0;
+  j = m;
+  shr_sticky (&zh, &j, -1084 - e);
+  j += 0x4000000000000000;
+  r = sign ? (double) -(int64_t) j + 0x1p62 : (double) (int64_t) j - 0x1p62;
+  if (j & 0x3ff)
+    force_eval_double (opt_barrier_double (0x1p-1022) * 0x1p-1022);
+  if (r == 0)
+    return asdouble (sign);
+  return r * 0x1p-62 * 0x1p-1022;
 }
 
 #endif /* _DOUBLE_IS_32BITS */
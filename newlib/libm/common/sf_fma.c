@@ -5,6 +5,7 @@
  */
 
 #include "fdlibm.h"
+#include "math_config.h"
 
 #ifdef __STDC__
 	float fmaf(float x, float y, float z)
@@ -15,14 +16,31 @@
         float z;
 #endif
 {
-  /* NOTE:  The floating-point exception behavior of this is not as
-   * required.  But since the basic function is not really done properly,
-   * it is not worth bothering to get the exceptions right, either.  */
-  /* Let the implementation handle this. */ /* <= NONSENSE! */
-  /* In floating-point implementations in which double is larger than float,
-   * computing as double should provide the desired function.  Otherwise,
-   * the behavior will not be as specified in the standards.  */
-  return (float) (((double) x * (double) y) + (double) z);
+#ifndef _DOUBLE_IS_32BITS
+  /* The product is exact in double, so only the sum and the conversion to
+     float round.  The double sum can only land on a float tie, or on a
+     float, if its 28 low bits are clear.  If it is inexact there, replace
+     it by its odd neighbour on the side of the exact sum: the conversion
+     then rounds like the exact sum in every rounding mode.  */
+  double xy = (double) x * (double) y;
+  double r = xy + (double) z;
+  uint64_t ir = asuint64 (r);
+  double err;
+
+  if (unlikely ((ir & 0xfffffff) == 0 && (ir >> 52 & 0x7ff) != 0x7ff))
+    {
+      /* The sign of the rounding error, as in Fast2Sum.  */
+      err = fabs (xy) >= fabsf (z) ? (double) z - (r - xy) : xy - (r - z);
+      if (err != 0)
+	{
+	  ir += (err < 0) == (ir >> 63) ? 1 : -1;
+	  r = asdouble (ir);
+	}
+    }
+  return r;
+#else
+  return x * y + z;
+#endif
 }
 
 #ifdef _DOUBLE_IS_32BITS
@@ -0,0 +1,44 @@
+/* Double-precision sine function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "sincos.h"
+
+/* Polynomial based sin.  Inputs below 2^20 in magnitude have their range
+   reduced with a few multiply-subtracts, larger ones with
+   __ieee754_rem_pio2.  */
+double
+sin (double x)
+{
+  double y, tail, r[2];
+  uint32_t ix = abstop32 (x);
+  int n;
+
+  if (ix <= TOP_PIO4)
+    {
+      if (unlikely (ix < TOP_TINY))
+	{
+	  if (ix < 0x00100000)
+	    /* Force underflow for tiny x.  */
+	    force_eval_double (x * x);
+	  return x;
+	}
+      return sincos_poly (x, 0.0, 0);
+    }
+  if (likely (ix < TOP_FAST))
+    y = reduce_pio2 (x, &tail, &n);
+  else if (ix < 0x7ff00000)
+    {
+      n = __ieee754_rem_pio2 (x, r);
+      y = r[0];
+      tail = r[1];
+    }
+  else
+    return __math_invalid (x);
+
+  return sincos_poly (y, tail, n);
+}
+
+#endif /* !__OBSOLETE_MATH */
@@ -0,0 +1,50 @@
+/* Double-precision sincos function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "sincos.h"
+
+/* Polynomial based sincos, sharing the range reduction and x^2 between
+   sin and cos.  */
+void
+sincos (double x, double *sinp, double *cosp)
+{
+  double y, tail, r[2];
+  uint32_t ix = abstop32 (x);
+  int n;
+
+  if (ix <= TOP_PIO4)
+    {
+      if (unlikely (ix < TOP_TINY))
+	{
+	  if (ix < 0x00100000)
+	    /* Force underflow for tiny x.  */
+	    force_eval_double (x * x);
+	  *sinp = x;
+	  *cosp = 1.0;
+	  return;
+	}
+      y = x;
+      tail = 0.0;
+      n = 0;
+    }
+  else if (likely (ix < TOP_FAST))
+    y = reduce_pio2 (x, &tail, &n);
+  else if (ix < 0x7ff00000)
+    {
+      n = __ieee754_rem_pio2 (x, r);
+      y = r[0];
+      tail = r[1];
+    }
+  else
+    {
+      *sinp = *cosp = __math_invalid (x);
+      return;
+    }
+
+  sincos_eval (y, tail, n, sinp, cosp);
+}
+
+#endif /* !__OBSOLETE_MATH */
@@ -0,0 +1,128 @@
+/* Header for double-precision sin/cos/sincos/tan functions.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include <stdint.h>
+#include <math.h>
+#include "math_config.h"
+
+/* High word of |x|.  */
+static inline uint32_t
+abstop32 (double x)
+{
+  return (asuint64 (x) >> 32) & 0x7fffffff;
+}
+
+/* High words of pi/4, 2^-27 and 2^20.  */
+#define TOP_PIO4 0x3fe921fb
+#define TOP_TINY 0x3e400000
+#define TOP_FAST 0x41300000
+
+/* Fast range reduction for |X| < 2^20: return the modulo of X as a value
+   between -PI/4 and PI/4 plus *TAIL and store the quadrant in NP.  The
+   first three parts of PI/2 have 33 bits, so their products with the
+   quadrant are exact, and the remaining error is below 2^-100 * |X|.  */
+static inline double
+reduce_pio2 (double x, double *tail, int *np)
+{
+  static const double
+    shift = 0x1.8p52,
+    invpio2 = 0x1.45f306dc9c883p-1,
+    pio2_1 = 0x1.921fb544p0,
+    pio2_2 = 0x1.0b4611a6p-34,
+    pio2_3 = 0x1.3198a2ep-69,
+    pio2_3t = 0x1.b839a252049c1p-104;
+  double kd, r, t, w, e1, e2, lo, y;
+
+  kd = eval_as_double (x * invpio2 + shift);
+  *np = (int32_t) asuint64 (kd);
+  kd -= shift;
+  r = x - kd * pio2_1;
+  w = kd * pio2_2;
+  t = r;
+  r = t - w;
+  e1 = t - r - w;
+  w = kd * pio2_3;
+  t = r;
+  r = t - w;
+  e2 = t - r - w;
+  lo = e1 + e2 - kd * pio2_3t;
+  y = r + lo;
+  *tail = r - y + lo;
+  return y;
+}
+
+/* The polynomials of k_sin.c and k_cos.c.  */
+static const double
+  S1 = -1.66666666666666324348e-01,
+  S2 = 8.33333333332248946124e-03,
+  S3 = -1.98412698298579493134e-04,
+  S4 = 2.75573137070700676789e-06,
+  S5 = -2.50507602534068634195e-08,
+  S6 = 1.58969099521155010221e-10,
+  C1 = 4.16666666666666019037e-02,
+  C2 = -1.38888888888741095749e-03,
+  C3 = 2.48015872894767294178e-05,
+  C4 = -2.75573143513906633035e-07,
+  C5 = 2.08757232129817482790e-09,
+  C6 = -1.13596475577881948265e-11;
+
+/* sin (Y + YL) for |Y| <= PI/4, with Z = Y * Y.  */
+static inline double
+sin_poly (double y, double yl, double z)
+{
+  double w = z * z;
+  double r = S2 + z * (S3 + z * S4) + z * w * (S5 + z * S6);
+  double v = z * y;
+
+  return y - ((z * (0.5 * yl - v * r) - yl) - v * S1);
+}
+
+/* cos (Y + YL) for |Y| <= PI/4, with Z = Y * Y.  1 - Z/2 is added
+   exactly, which keeps the error below 1 ULP without the case split of
+   k_cos.c.  */
+static inline double
+cos_poly (double y, double yl, double z)
+{
+  double w = z * z;
+  double r = z * (C1 + z * (C2 + z * C3)) + w * w * (C4 + z * (C5 + z * C6));
+  double hz = 0.5 * z;
+  double one_hz = 1.0 - hz;
+
+  return one_hz + (((1.0 - one_hz) - hz) + (z * r - y * yl));
+}
+
+/* Return sin (Y + YL + N * PI/2) for |Y| <= PI/4 and |YL| <= 2^-52 |Y|.
+   The sign is applied with a bit operation, so that random input costs
+   no mispredicted branch for it.  */
+static inline double
+sincos_poly (double y, double yl, int n)
+{
+  uint64_t sign = (uint64_t) (n & 2) << 62;
+  double z = y * y;
+
+  if (n & 1)
+    return asdouble (asuint64 (cos_poly (y, yl, z)) ^ sign);
+  return asdouble (asuint64 (sin_poly (y, yl, z)) ^ sign);
+}
+
+/* Store sin and cos of Y + YL + N * PI/2 in *SINP and *COSP, for the same
+   Y and YL as sincos_poly.  */
+static inline void
+sincos_eval (double y, double yl, int n, double *sinp, double *cosp)
+{
+  uint64_t sign = (uint64_t) (n & 2) << 62;
+  double z = y * y;
+  uint64_t s, c;
+
+  s = asuint64 (sin_poly (y, yl, z)) ^ sign;
+  c = asuint64 (cos_poly (y, yl, z)) ^ sign;
+  /* Quadrant 1 swaps sin and cos and negates the new cos.  */
+  if (n & 1)
+    {
+      uint64_t tmp = s;
+      s = c;
+      c = tmp ^ 0x8000000000000000;
+    }
+  *sinp = asdouble (s);
+  *cosp = asdouble (c);
+}
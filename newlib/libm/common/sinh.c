@@ -0,0 +1,69 @@
+/* Double-precision sinh function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "hyperbolic.h"
+
+/* Coefficients of sinh (x) ~= x + x * z * P (z), z = x * x, for
+   |x| < 0.25.  Relative error: 2^-60.  */
+static const double S[] = {
+  0x1.5555555555555p-3,
+  0x1.1111111110f23p-7,
+  0x1.a01a01a252de6p-13,
+  0x1.71de287b1a9d1p-19,
+  0x1.aee68b4fb905fp-26,
+};
+
+/* |x| < 0.25 uses a polynomial.  Up to 22, e^|x| and e^-|x| are both
+   computed to about 2^-60 relative precision with the tables of exp and
+   subtracted without rounding error, which replaces the expm1 and exp
+   calls of e_sinh.c.  Above 709 e^|x| / 2 is formed without overflow
+   by exp_half_big.  Worst-case error is about 0.52 ULP.  */
+double
+sinh (double x)
+{
+  uint64_t ix = asuint64 (x);
+  uint64_t sign = ix & 0x8000000000000000;
+  uint32_t abstop = (ix >> 52) & 0x7ff;
+  double ax = asdouble (ix ^ sign);
+  double z, z2, e, el, f, fl, s, y;
+
+  if (abstop < 0x3ff - 2)
+    {
+      if (unlikely (abstop < 0x3ff - 27))
+	{
+	  if (abstop == 0)
+	    /* Force underflow for tiny x.  */
+	    force_eval_double (x * x);
+	  return x;
+	}
+      z = x * x;
+      z2 = z * z;
+      return x + x * z * (S[0] + z * S[1] + z2 * (S[2] + z * S[3])
+			  + z2 * z2 * S[4]);
+    }
+  if (likely (ax < 22.0))
+    {
+      e = exp_hilo (ax, &el);
+      f = exp_hilo (-ax, &fl);
+      s = e - f;
+      y = 0.5 * (s + ((e - s - f) + (el - fl)));
+    }
+  else if (ax < 709.0)
+    {
+      /* e^-|x| is below 2^-63 e^|x|.  */
+      e = exp_hilo (ax, &el);
+      y = 0.5 * (e + el);
+    }
+  else if (ax <= 0x1.633ce8fb9f87dp+9)
+    y = check_oflow (exp_half_big (ax));
+  else if (abstop == 0x7ff)
+    return x + x;
+  else
+    return __math_oflow (sign >> 63);
+  return asdouble (asuint64 (y) ^ sign);
+}
+
+#endif /* !__OBSOLETE_MATH */
@@ -0,0 +1,45 @@
+/* Single-precision sinh function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "hyperbolic.h"
+
+/* sinh (x) = (e^x - e^-x) / 2 computed in double precision with the
+   tables of exp, or with a short polynomial for |x| < 2^-5.  Worst-case
+   error is about 0.51 ULP.  */
+float
+sinhf (float x)
+{
+  uint32_t ix = asuint (x);
+  uint32_t ia = ix & 0x7fffffff;
+  double ax = asfloat (ia);
+  double z, e, el, f, fl, y;
+
+  if (ia < 0x3d000000)
+    {
+      if (unlikely (ia < 0x39800000))
+	{
+	  if (ia < 0x00800000)
+	    /* Force underflow for tiny x.  */
+	    force_eval_float (x * x);
+	  return x;
+	}
+      z = (double) x * x;
+      return x + x * z * (0x1.5555555555555p-3 + z * 0x1.1111111111111p-7);
+    }
+  /* The result overflows above log (2 * FLT_MAX).  */
+  if (likely (ia <= 0x42b2d4fc))
+    {
+      e = exp_hilo (ax, &el);
+      f = exp_hilo (-ax, &fl);
+      y = 0.5 * ((e - f) + (el - fl));
+      return ix >> 31 ? (float) -y : (float) y;
+    }
+  if (ia >= 0x7f800000)
+    return x + x;
+  return __math_oflowf (ix >> 31);
+}
+
+#endif /* !__OBSOLETE_MATH */
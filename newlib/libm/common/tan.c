@@ -0,0 +1,34 @@
+/* Double-precision tangent function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "sincos.h"
+
+/* tan with the range reduction of sin and the fdlibm kernel.  */
+double
+tan (double x)
+{
+  double y, tail, r[2];
+  uint32_t ix = abstop32 (x);
+  int n;
+
+  if (ix <= TOP_PIO4)
+    return __kernel_tan (x, 0.0, 1);
+  if (likely (ix < TOP_FAST))
+    y = reduce_pio2 (x, &tail, &n);
+  else if (ix < 0x7ff00000)
+    {
+      n = __ieee754_rem_pio2 (x, r);
+      y = r[0];
+      tail = r[1];
+    }
+  else
+    return __math_invalid (x);
+
+  /* 1 if n is even, -1 if n is odd.  */
+  return __kernel_tan (y, tail, 1 - ((n & 1) << 1));
+}
+
+#endif /* !__OBSOLETE_MATH */
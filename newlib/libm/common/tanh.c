@@ -0,0 +1,88 @@
+/* Double-precision tanh function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "hyperbolic.h"
+
+/* Coefficients of tanh (x) ~= x + x * z * P (z), z = x * x, for
+   |x| < 0.125.  Relative error: 2^-61.7.  */
+static const double P[] = {
+  -0x1.5555555555552p-2,
+  0x1.111111110f309p-3,
+  -0x1.ba1ba1adf1bc7p-5,
+  0x1.664f3661f12cp-6,
+  -0x1.226089aa9ce45p-7,
+  0x1.cca99e2925826p-9,
+};
+
+/* A - Q * B, where Q = A / B rounded, to about 2^-25 relative
+   precision.  */
+static inline double
+residual (double a, double q, double b)
+{
+#if HAVE_FAST_FMA
+  return fma (-q, b, a);
+#else
+  double qh = asdouble (asuint64 (q) & 0xfffffffff8000000);
+  double bh = asdouble (asuint64 (b) & 0xfffffffff8000000);
+
+  return (a - qh * bh) - (qh * (b - bh) + (q - qh) * b);
+#endif
+}
+
+/* |x| < 0.125 uses a polynomial.  Up to 22, tanh (|x|) = (e - 1) / (e + 1)
+   where e = e^2|x| is computed to about 2^-60 relative precision with the
+   tables of exp, the numerator and denominator are kept as two doubles
+   each and the quotient is corrected with its residual, which replaces
+   the expm1 call and the rounding errors of s_tanh.c.  Worst-case error
+   is about 0.55 ULP.  */
+double
+tanh (double x)
+{
+  uint64_t ix = asuint64 (x);
+  uint64_t sign = ix & 0x8000000000000000;
+  uint32_t abstop = (ix >> 52) & 0x7ff;
+  double ax = asdouble (ix ^ sign);
+  double z, z2, e, eh, el, nh, nl, dh, dl, inv, q, y;
+
+  if (abstop < 0x3ff - 3)
+    {
+      if (unlikely (abstop < 0x3ff - 27))
+	{
+	  if (abstop == 0)
+	    /* Force underflow for tiny x.  */
+	    force_eval_double (x * x);
+	  return x;
+	}
+      z = x * x;
+      z2 = z * z;
+      return x + x * z * (P[0] + z * P[1] + z2 * (P[2] + z * P[3])
+			  + z2 * z2 * (P[4] + z * P[5]));
+    }
+  if (likely (ax < 22.0))
+    {
+      e = exp_hilo (2.0 * ax, &el);
+      /* Normalize e + el, so that the second order terms of the
+	 correction of the quotient are negligible.  */
+      eh = e + el;
+      el = e - eh + el;
+      e = eh;
+      nh = e - 1.0;
+      nl = (e - nh - 1.0) + el;
+      dh = e + 1.0;
+      dl = (e - dh + 1.0) + el;
+      inv = 1.0 / dh;
+      q = nh * inv;
+      y = q + (residual (nh, q, dh) + nl - q * dl) * inv;
+    }
+  else if (abstop == 0x7ff && (ix << 12) != 0)
+    return x + x;
+  else
+    /* tanh (|x|) rounds to 1, raise inexact.  */
+    y = 1.0 - 0x1p-1022;
+  return asdouble (asuint64 (y) ^ sign);
+}
+
+#endif /* !__OBSOLETE_MATH */
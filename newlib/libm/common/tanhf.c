@@ -0,0 +1,45 @@
+/* Single-precision tanh function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "hyperbolic.h"
+
+/* tanh (x) = (e - 1) / (e + 1) with e = e^2|x| computed in double
+   precision with the tables of exp, or with a short polynomial for
+   |x| < 2^-5.  Worst-case error is about 0.51 ULP.  */
+float
+tanhf (float x)
+{
+  uint32_t ix = asuint (x);
+  uint32_t ia = ix & 0x7fffffff;
+  double z, e, el, y;
+
+  if (ia < 0x3d000000)
+    {
+      if (unlikely (ia < 0x39800000))
+	{
+	  if (ia < 0x00800000)
+	    /* Force underflow for tiny x.  */
+	    force_eval_float (x * x);
+	  return x;
+	}
+      z = (double) x * x;
+      return x + x * z * (-0x1.5555555555555p-2 + z * 0x1.1111111111111p-3);
+    }
+  /* tanh (x) rounds to +-1 above 9.0109.  */
+  if (likely (ia < 0x41102cb4))
+    {
+      e = exp_hilo (2.0 * (double) asfloat (ia), &el);
+      e += el;
+      y = (e - 1.0) / (e + 1.0);
+    }
+  else if (ia > 0x7f800000)
+    return x + x;
+  else
+    y = 1.0 - 0x1p-30;
+  return ix >> 31 ? (float) -y : (float) y;
+}
+
+#endif /* !__OBSOLETE_MATH */
@@ -0,0 +1,125 @@
+/* Double-precision gamma function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include <reent.h>
+#include "gamma.h"
+
+#define PI_HI __gamma_data.sinpi[0]
+#define PI_LO __gamma_data.pi_lo
+
+/* Below 12 the argument is moved to [1, 2) by the recurrence
+   gamma (x + 1) = x * gamma (x) in double-double arithmetic, where a table
+   of polynomials gives gamma (1 + f).  Above 12 the result is
+   e^lgamma (x) with lgamma from the Stirling series, both computed with
+   about 2^-60 relative error.  Negative x use the reflection formula
+   gamma (x) = -pi / (x * sin (pi * x) * gamma (-x)), as a quotient above
+   -12 and through logarithms below.  Worst-case error is about 0.6 ULP
+   for positive x and 0.8 ULP for negative x.  */
+double
+tgamma (double x)
+{
+  uint64_t ix = asuint64 (x);
+  uint64_t ia = ix & 0x7fffffffffffffff;
+  double hi, lo, r, sh, sl, dh, dl, gh, gl, q, qh, ql, e;
+  int odd, neg;
+
+  if (unlikely (ia - asuint64 (0x1p-54)
+		>= asuint64 (0x1.573fae561f647p+7) - asuint64 (0x1p-54)))
+    {
+      if (ia < asuint64 (0x1p-54))
+	{
+	  if (ia == 0)
+	    return __math_divzero (ix >> 63);
+	  /* gamma (x) = 1/x - euler + O(x), which rounds to 1/x.  */
+	  return check_oflow (1.0 / x);
+	}
+      if (ix == asuint64 (-INFINITY))
+	return __math_invalid (x);
+      if (ia >= 0x7ff0000000000000)
+	return x + x;
+      if ((ix >> 63) == 0)
+	return __math_oflow (0);
+    }
+
+  if ((ix >> 63) == 0)
+    {
+      if (x < 12.0)
+	{
+	  hi = gamma_small (x, &lo);
+	  return hi + lo;
+	}
+      hi = lgamma_stirling (x, &lo);
+      return exp_round (hi, lo);
+    }
+
+  /* All doubles below -2^52 are even integers.  */
+  if (unlikely (x <= -0x1p52))
+    return __math_invalid (x);
+  r = x - round_parity (x, &odd);
+  if (unlikely (r == 0.0))
+    return __math_invalid (x);
+  if (x > -12.0)
+    {
+      /* x * sin (pi * x) * gamma (-x) in double-double, then the
+	 quotient with one correction step.  */
+      sh = sinpi_hilo (r, &sl);
+      if (odd)
+	{
+	  sh = -sh;
+	  sl = -sl;
+	}
+      dh = mul_hilo (x, sh, &dl);
+      dl += x * sl;
+      gh = gamma_small (-x, &gl);
+      hi = mul_hilo (dh, gh, &lo);
+      lo += dh * gl + dl * gh;
+      q = -PI_HI / hi;
+      qh = mul_hilo (q, hi, &ql);
+      return q + (((-PI_HI - qh) - ql) - (q * lo + PI_LO)) / hi;
+    }
+  /* gamma (x) underflows below -184.  */
+  if (x < -184.0)
+    return __math_uflow (odd ^ (r < 0.0));
+  hi = log_reflect (x, r, odd, &lo, &neg);
+  gh = lgamma_stirling (-x, &gl);
+  hi = add_hilo (hi, -gh, &e);
+  q = exp_round (hi, e + (lo - gl));
+  return neg ? -q : q;
+}
+
+/* The traditional gamma function of this library, e^lgamma (x) with the
+   sign of gamma (x) in *SIGNGAMP.  */
+double
+gamma_r (double x, int *signgamp)
+{
+  uint64_t ix = asuint64 (x);
+  double y;
+  int odd;
+
+  *signgamp = 1;
+  if (unlikely (ix >> 63) && ix != asuint64 (-0.0))
+    {
+      if (ix == asuint64 (-INFINITY))
+	return INFINITY;
+      if (x <= -0x1p52 || x == round_parity (x, &odd))
+	return __math_divzero (0);
+    }
+  y = tgamma (x);
+  if (asuint64 (y) >> 63)
+    {
+      *signgamp = -1;
+      y = -y;
+    }
+  return y;
+}
+
+double
+gamma (double x)
+{
+  return gamma_r (x, &(_REENT_SIGNGAM(_REENT)));
+}
+
+#endif /* !__OBSOLETE_MATH */
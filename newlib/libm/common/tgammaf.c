@@ -0,0 +1,94 @@
+/* Single-precision gamma function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include <reent.h>
+#include "gamma.h"
+
+#define EULER 0x1.2788cfc6fb619p-1
+
+/* tgamma computed in double precision: the recurrence and the table of
+   the double variant below 12, e^lgamma (x) above, and the reflection
+   formula for negative x.  Worst-case error is about 0.51 ULP.  */
+float
+tgammaf (float x)
+{
+  uint32_t ix = asuint (x);
+  uint32_t ia = ix & 0x7fffffff;
+  double y, r;
+  int odd;
+
+  /* |x| < 2^-31 or x >= 0x1.18521ep5.  */
+  if (unlikely (ia - 0x30000000 >= 0x420c2910 - 0x30000000))
+    {
+      if (ia < 0x30000000)
+	{
+	  if (ia == 0)
+	    return __math_divzerof (ix >> 31);
+	  /* gamma (x) = 1/x - euler + O(x).  */
+	  y = 1.0 / (double) x - EULER;
+	  if (asuint64 (y) << 1 >= asuint64 (0x1.ffffffp127) << 1)
+	    return __math_oflowf (ix >> 31);
+	  return y;
+	}
+      if (ix == 0xff800000)
+	return __math_invalidf (x);
+      if (ia >= 0x7f800000)
+	return x + x;
+      if ((ix >> 31) == 0)
+	return __math_oflowf (0);
+    }
+
+  if ((ix >> 31) == 0)
+    return gammaf_pos (x);
+
+  /* All floats below -2^23 are integers.  */
+  if (unlikely (x <= -0x1p23f))
+    return __math_invalidf (x);
+  r = x - round_parity (x, &odd);
+  if (unlikely (r == 0.0))
+    return __math_invalidf (x);
+  /* gamma (x) underflows below -42.  */
+  if (unlikely (x < -42.0f))
+    return __math_uflowf (odd ^ (r < 0.0));
+  y = sinpif (r);
+  if (odd)
+    y = -y;
+  return -__gamma_data.sinpi[0] / (x * y * gammaf_pos (-x));
+}
+
+/* The traditional gamma function of this library, e^lgamma (x) with the
+   sign of gamma (x) in *SIGNGAMP.  */
+float
+gammaf_r (float x, int *signgamp)
+{
+  uint32_t ix = asuint (x);
+  float y;
+  int odd;
+
+  *signgamp = 1;
+  if (unlikely (ix >> 31) && ix != asuint (-0.0f))
+    {
+      if (ix == 0xff800000)
+	return INFINITY;
+      if (x <= -0x1p23f || x == round_parity (x, &odd))
+	return __math_divzerof (0);
+    }
+  y = tgammaf (x);
+  if (asuint (y) >> 31)
+    {
+      *signgamp = -1;
+      y = -y;
+    }
+  return y;
+}
+
+float
+gammaf (float x)
+{
+  return gammaf_r (x, &(_REENT_SIGNGAM(_REENT)));
+}
+
+#endif /* !__OBSOLETE_MATH */
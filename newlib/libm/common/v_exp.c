@@ -0,0 +1,54 @@
+/* Vector variants of the double-precision e^x function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#include "v_math.h"
+#if HAVE_VECTOR_MATH
+
+#define N (1 << EXP_TABLE_BITS)
+#define InvLn2N __exp_data.invln2N
+#define NegLn2hiN __exp_data.negln2hiN
+#define NegLn2loN __exp_data.negln2loN
+#define Shift __exp_data.shift
+#define T __exp_data.tab
+#define C2 __exp_data.poly[5 - EXP_POLY_ORDER]
+#define C3 __exp_data.poly[6 - EXP_POLY_ORDER]
+#define C4 __exp_data.poly[7 - EXP_POLY_ORDER]
+#define C5 __exp_data.poly[8 - EXP_POLY_ORDER]
+
+/* Same algorithm as exp, for lanes with |x| < 512.  Other lanes may
+   overflow or underflow and are done by exp.  */
+static inline v_f64_t
+v_exp (v_f64_t x)
+{
+  v_u64_t ix, special, ki, idx, tail, sbits;
+  v_f64_t kd, r, r2, tmp, scale, y;
+  int i;
+
+  ix = v_as_u64_f64 (x);
+  special = (ix >> 52 & 0x7ff) >= 0x408;
+
+  kd = InvLn2N * x + Shift;
+  ki = v_as_u64_f64 (kd);
+  kd -= Shift;
+  r = x + kd * NegLn2hiN + kd * NegLn2loN;
+  idx = 2 * (ki % N);
+  for (i = 0; i < V_F64_LANES; i++)
+    {
+      tail[i] = T[idx[i]];
+      sbits[i] = T[idx[i] + 1];
+    }
+  sbits += ki << (52 - EXP_TABLE_BITS);
+  r2 = r * r;
+  tmp = v_as_f64_u64 (tail) + r + r2 * (C2 + r * C3)
+	+ r2 * r2 * (C4 + r * C5);
+  scale = v_as_f64_u64 (sbits);
+  y = scale + scale * tmp;
+  if (__builtin_expect (v_any_u64 (special), 0))
+    return v_call_f64 (exp, x, y, special);
+  return y;
+}
+
+V_ENTRY_F64_1 (exp, v_exp)
+
+#endif /* HAVE_VECTOR_MATH */
@@ -0,0 +1,94 @@
+/* Vector variants of the double-precision log(x) function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#include "v_math.h"
+#if HAVE_VECTOR_MATH
+
+#define T __log_data.tab
+#define T2 __log_data.tab2
+#define B __log_data.poly1
+#define A __log_data.poly
+#define Ln2hi __log_data.ln2hi
+#define Ln2lo __log_data.ln2lo
+#define N (1 << LOG_TABLE_BITS)
+#define OFF 0x3fe6000000000000
+#define LO asuint64 (1.0 - 0x1p-4)
+#define HI asuint64 (1.0 + 0x1.09p-4)
+
+/* log(x) for x close to 1, as in log.  */
+static inline v_f64_t
+v_log_near1 (v_f64_t x)
+{
+  v_f64_t r, r2, r3, y, w, rhi, rlo, hi, lo;
+
+  r = x - 1.0;
+  r2 = r * r;
+  r3 = r * r2;
+  y = r3 * (B[1] + r * B[2] + r2 * B[3]
+	    + r3 * (B[4] + r * B[5] + r2 * B[6]
+		    + r3 * (B[7] + r * B[8] + r2 * B[9] + r3 * B[10])));
+  w = r * 0x1p27;
+  rhi = r + w - w;
+  rlo = r - rhi;
+  w = rhi * rhi * B[0];
+  hi = r + w;
+  lo = r - hi + w;
+  lo += B[0] * rlo * (rhi + r);
+  y += lo;
+  return y + hi;
+}
+
+/* Same algorithm as log, for normal positive finite lanes.  Other lanes
+   are done by log.  */
+static inline v_f64_t
+v_log (v_f64_t x)
+{
+  v_u64_t ix, top, special, near1, tmp, i, iz, invc, logc;
+  v_f64_t z, r, kd, w, hi, lo, r2, y;
+#if !HAVE_FAST_FMA
+  v_u64_t chi, clo;
+#endif
+  int j;
+
+  ix = v_as_u64_f64 (x);
+  top = ix >> 48;
+  special = top - 0x0010 >= 0x7ff0 - 0x0010;
+  near1 = ix - LO < HI - LO;
+
+  tmp = ix - OFF;
+  i = (tmp >> (52 - LOG_TABLE_BITS)) % N;
+  kd = v_f64_s64 ((v_s64_t) tmp >> 52);
+  iz = ix - (tmp & 0xfffULL << 52);
+  for (j = 0; j < V_F64_LANES; j++)
+    {
+      invc[j] = asuint64 (T[i[j]].invc);
+      logc[j] = asuint64 (T[i[j]].logc);
+#if !HAVE_FAST_FMA
+      chi[j] = asuint64 (T2[i[j]].chi);
+      clo[j] = asuint64 (T2[i[j]].clo);
+#endif
+    }
+  z = v_as_f64_u64 (iz);
+#if HAVE_FAST_FMA
+  r = v_fma_f64 (z, v_as_f64_u64 (invc), v_f64 (-1.0));
+#else
+  r = (z - v_as_f64_u64 (chi) - v_as_f64_u64 (clo)) * v_as_f64_u64 (invc);
+#endif
+
+  w = kd * Ln2hi + v_as_f64_u64 (logc);
+  hi = w + r;
+  lo = w - hi + r + kd * Ln2lo;
+  r2 = r * r;
+  y = lo + r2 * A[0] + r * r2 * (A[1] + r * A[2] + r2 * (A[3] + r * A[4]))
+      + hi;
+  if (v_any_u64 (near1))
+    y = v_sel_f64 (near1, v_log_near1 (x), y);
+  if (__builtin_expect (v_any_u64 (special), 0))
+    return v_call_f64 (log, x, y, special);
+  return y;
+}
+
+V_ENTRY_F64_1 (log, v_log)
+
+#endif /* HAVE_VECTOR_MATH */
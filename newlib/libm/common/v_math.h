@@ -0,0 +1,350 @@
+/* Support for the vector variants of math functions.
+   SPDX-License-Identifier: BSD-3-Clause
+
+   The vector variants follow the vector function ABI of the target
+   (_ZGV<isa><mask><lanes><args>_<name>), so that compilers can call
+   them from vectorized loops.  Each function has one kernel working on
+   128-bit vectors, built from the same tables as the scalar function.
+   The entry points for wider vectors apply the kernel to each half.
+   Lanes with special or out of range input are computed by calling the
+   scalar function, which also sets errno for them.  */
+
+#ifndef _V_MATH_H
+#define _V_MATH_H
+
+#include "math_config.h"
+
+/* configure defines _HAVE_VECTOR_MATH in newlib.h for the targets and
+   compilers which support these functions, so that math.h only declares
+   them where they are built.  */
+#if defined (_HAVE_VECTOR_MATH) && !__OBSOLETE_MATH
+# define HAVE_VECTOR_MATH 1
+#else
+# define HAVE_VECTOR_MATH 0
+#endif
+
+#if HAVE_VECTOR_MATH
+
+#ifdef __aarch64__
+# include <arm_neon.h>
+#endif
+
+#define V_F64_LANES 2
+#define V_F32_LANES 4
+
+typedef double v_f64_t __attribute__ ((vector_size (16)));
+typedef uint64_t v_u64_t __attribute__ ((vector_size (16)));
+typedef int64_t v_s64_t __attribute__ ((vector_size (16)));
+typedef float v_f32_t __attribute__ ((vector_size (16)));
+typedef uint32_t v_u32_t __attribute__ ((vector_size (16)));
+typedef int32_t v_s32_t __attribute__ ((vector_size (16)));
+
+/* Argument and return types of the other entry points.  */
+typedef float v_f32x2_t __attribute__ ((vector_size (8)));
+typedef double v_f64x4_t __attribute__ ((vector_size (32)));
+typedef float v_f32x8_t __attribute__ ((vector_size (32)));
+typedef double v_f64x8_t __attribute__ ((vector_size (64)));
+typedef float v_f32x16_t __attribute__ ((vector_size (64)));
+
+static inline v_f64_t
+v_f64 (double x)
+{
+  return (v_f64_t) {x, x};
+}
+
+static inline v_u64_t
+v_u64 (uint64_t x)
+{
+  return (v_u64_t) {x, x};
+}
+
+static inline v_f32_t
+v_f32 (float x)
+{
+  return (v_f32_t) {x, x, x, x};
+}
+
+static inline v_u32_t
+v_u32 (uint32_t x)
+{
+  return (v_u32_t) {x, x, x, x};
+}
+
+/* Bit patterns, the vector forms of asuint64, asdouble, asuint and
+   asfloat.  */
+static inline v_u64_t
+v_as_u64_f64 (v_f64_t x)
+{
+  return (v_u64_t) x;
+}
+
+static inline v_f64_t
+v_as_f64_u64 (v_u64_t x)
+{
+  return (v_f64_t) x;
+}
+
+static inline v_u32_t
+v_as_u32_f32 (v_f32_t x)
+{
+  return (v_u32_t) x;
+}
+
+static inline v_f32_t
+v_as_f32_u32 (v_u32_t x)
+{
+  return (v_f32_t) x;
+}
+
+/* Non-zero if any lane of a comparison result is set.  */
+static inline int
+v_any_u64 (v_u64_t x)
+{
+  return (x[0] | x[1]) != 0;
+}
+
+static inline int
+v_any_u32 (v_u32_t x)
+{
+  return (x[0] | x[1] | x[2] | x[3]) != 0;
+}
+
+/* Select lanes of X where MASK is set, and of Y elsewhere.  */
+static inline v_f64_t
+v_sel_f64 (v_u64_t mask, v_f64_t x, v_f64_t y)
+{
+  return v_as_f64_u64 ((v_as_u64_f64 (x) & mask) | (v_as_u64_f64 (y) & ~mask));
+}
+
+/* Convert to and from floats in double precision.  */
+static inline v_f64_t
+v_lo_f64_f32 (v_f32_t x)
+{
+  return (v_f64_t) {x[0], x[1]};
+}
+
+static inline v_f64_t
+v_hi_f64_f32 (v_f32_t x)
+{
+  return (v_f64_t) {x[2], x[3]};
+}
+
+static inline v_f32_t
+v_f32_f64 (v_f64_t lo, v_f64_t hi)
+{
+  return (v_f32_t) {lo[0], lo[1], hi[0], hi[1]};
+}
+
+/* Integer lanes of the double halves of a float vector.  */
+static inline v_u64_t
+v_lo_u64_u32 (v_u32_t x)
+{
+  return (v_u64_t) {x[0], x[1]};
+}
+
+static inline v_u64_t
+v_hi_u64_u32 (v_u32_t x)
+{
+  return (v_u64_t) {x[2], x[3]};
+}
+
+static inline v_f64_t
+v_f64_s64 (v_s64_t x)
+{
+  return (v_f64_t) {x[0], x[1]};
+}
+
+/* X * Y + Z, fused on targets which have HAVE_FAST_FMA.  */
+static inline v_f64_t
+v_fma_f64 (v_f64_t x, v_f64_t y, v_f64_t z)
+{
+#ifdef __aarch64__
+  return (v_f64_t) vfmaq_f64 ((float64x2_t) z, (float64x2_t) x,
+			      (float64x2_t) y);
+#else
+  return x * y + z;
+#endif
+}
+
+/* Call the scalar function for the lanes set in SPECIAL.  */
+static inline v_f64_t
+v_call_f64 (double (*f) (double), v_f64_t x, v_f64_t y, v_u64_t special)
+{
+  int i;
+
+  for (i = 0; i < V_F64_LANES; i++)
+    if (special[i])
+      y[i] = f (x[i]);
+  return y;
+}
+
+static inline v_f64_t
+v_call2_f64 (double (*f) (double, double), v_f64_t x1, v_f64_t x2,
+	     v_f64_t y, v_u64_t special)
+{
+  int i;
+
+  for (i = 0; i < V_F64_LANES; i++)
+    if (special[i])
+      y[i] = f (x1[i], x2[i]);
+  return y;
+}
+
+static inline v_f32_t
+v_call_f32 (float (*f) (float), v_f32_t x, v_f32_t y, v_u32_t special)
+{
+  int i;
+
+  for (i = 0; i < V_F32_LANES; i++)
+    if (special[i])
+      y[i] = f (x[i]);
+  return y;
+}
+
+static inline v_f32_t
+v_call2_f32 (float (*f) (float, float), v_f32_t x1, v_f32_t x2,
+	     v_f32_t y, v_u32_t special)
+{
+  int i;
+
+  for (i = 0; i < V_F32_LANES; i++)
+    if (special[i])
+      y[i] = f (x1[i], x2[i]);
+  return y;
+}
+
+/* Entry points.  V_ENTRY_F64_1 (exp, v_exp) defines the variants of exp
+   with one double argument using the kernel v_exp, and so on.  On x86_64
+   these are the SSE2, AVX, AVX2 and AVX-512 variants, on AArch64 the
+   AdvSIMD ones, which use the vector procedure call standard.  */
+
+#define V_SPLIT_1(vt, et, n, kernel, x)				\
+  union { vt v; et h[n]; } __u = { x };				\
+  int __i;							\
+  for (__i = 0; __i < n; __i++)					\
+    __u.h[__i] = kernel (__u.h[__i]);				\
+  return __u.v
+
+#define V_SPLIT_2(vt, et, n, kernel, x, y)			\
+  union { vt v; et h[n]; } __u = { x }, __w = { y };		\
+  int __i;							\
+  for (__i = 0; __i < n; __i++)					\
+    __u.h[__i] = kernel (__u.h[__i], __w.h[__i]);		\
+  return __u.v
+
+#ifdef __x86_64__
+
+# define V_X86_64_1(vt1, vt2, vt4, et, nb, nc, ne, name, kernel)	\
+  et _ZGVbN##nb##v_##name (et);						\
+  et _ZGVbN##nb##v_##name (et x)					\
+  {									\
+    return kernel (x);							\
+  }									\
+  __attribute__ ((__target__ ("avx"))) vt2 _ZGVcN##nc##v_##name (vt2);	\
+  __attribute__ ((__target__ ("avx"))) vt2				\
+  _ZGVcN##nc##v_##name (vt2 x)						\
+  {									\
+    V_SPLIT_1 (vt2, et, 2, kernel, x);					\
+  }									\
+  __attribute__ ((__target__ ("avx2"))) vt2 _ZGVdN##nc##v_##name (vt2);	\
+  __attribute__ ((__target__ ("avx2"))) vt2				\
+  _ZGVdN##nc##v_##name (vt2 x)						\
+  {									\
+    V_SPLIT_1 (vt2, et, 2, kernel, x);					\
+  }									\
+  __attribute__ ((__target__ ("avx512f"))) vt4				\
+  _ZGVeN##ne##v_##name (vt4);						\
+  __attribute__ ((__target__ ("avx512f"))) vt4				\
+  _ZGVeN##ne##v_##name (vt4 x)						\
+  {									\
+    V_SPLIT_1 (vt4, et, 4, kernel, x);					\
+  }
+
+# define V_X86_64_2(vt1, vt2, vt4, et, nb, nc, ne, name, kernel)	\
+  et _ZGVbN##nb##vv_##name (et, et);					\
+  et _ZGVbN##nb##vv_##name (et x, et y)					\
+  {									\
+    return kernel (x, y);						\
+  }									\
+  __attribute__ ((__target__ ("avx"))) vt2				\
+  _ZGVcN##nc##vv_##name (vt2, vt2);					\
+  __attribute__ ((__target__ ("avx"))) vt2				\
+  _ZGVcN##nc##vv_##name (vt2 x, vt2 y)					\
+  {									\
+    V_SPLIT_2 (vt2, et, 2, kernel, x, y);				\
+  }									\
+  __attribute__ ((__target__ ("avx2"))) vt2				\
+  _ZGVdN##nc##vv_##name (vt2, vt2);					\
+  __attribute__ ((__target__ ("avx2"))) vt2				\
+  _ZGVdN##nc##vv_##name (vt2 x, vt2 y)					\
+  {									\
+    V_SPLIT_2 (vt2, et, 2, kernel, x, y);				\
+  }									\
+  __attribute__ ((__target__ ("avx512f"))) vt4				\
+  _ZGVeN##ne##vv_##name (vt4, vt4);					\
+  __attribute__ ((__target__ ("avx512f"))) vt4				\
+  _ZGVeN##ne##vv_##name (vt4 x, vt4 y)					\
+  {									\
+    V_SPLIT_2 (vt4, et, 4, kernel, x, y);				\
+  }
+
+# define V_ENTRY_F64_1(name, kernel) \
+  V_X86_64_1 (v_f64_t, v_f64x4_t, v_f64x8_t, v_f64_t, 2, 4, 8, name, kernel)
+# define V_ENTRY_F64_2(name, kernel) \
+  V_X86_64_2 (v_f64_t, v_f64x4_t, v_f64x8_t, v_f64_t, 2, 4, 8, name, kernel)
+# define V_ENTRY_F32_1(name, kernel) \
+  V_X86_64_1 (v_f32_t, v_f32x8_t, v_f32x16_t, v_f32_t, 4, 8, 16, name, kernel)
+# define V_ENTRY_F32_2(name, kernel) \
+  V_X86_64_2 (v_f32_t, v_f32x8_t, v_f32x16_t, v_f32_t, 4, 8, 16, name, kernel)
+
+#else /* __aarch64__ */
+
+# define V_VPCS __attribute__ ((__aarch64_vector_pcs__))
+
+# define V_ENTRY_F64_1(name, kernel)					\
+  V_VPCS v_f64_t _ZGVnN2v_##name (v_f64_t);				\
+  V_VPCS v_f64_t _ZGVnN2v_##name (v_f64_t x)				\
+  {									\
+    return kernel (x);							\
+  }
+
+# define V_ENTRY_F64_2(name, kernel)					\
+  V_VPCS v_f64_t _ZGVnN2vv_##name (v_f64_t, v_f64_t);			\
+  V_VPCS v_f64_t _ZGVnN2vv_##name (v_f64_t x, v_f64_t y)		\
+  {									\
+    return kernel (x, y);						\
+  }
+
+/* The 64-bit float variants repeat their lanes in the kernel.  */
+# define V_ENTRY_F32_1(name, kernel)					\
+  V_VPCS v_f32_t _ZGVnN4v_##name (v_f32_t);				\
+  V_VPCS v_f32_t _ZGVnN4v_##name (v_f32_t x)				\
+  {									\
+    return kernel (x);							\
+  }									\
+  V_VPCS v_f32x2_t _ZGVnN2v_##name (v_f32x2_t);			\
+  V_VPCS v_f32x2_t _ZGVnN2v_##name (v_f32x2_t x)			\
+  {									\
+    v_f32_t y = kernel ((v_f32_t) {x[0], x[1], x[0], x[1]});		\
+    return (v_f32x2_t) {y[0], y[1]};					\
+  }
+
+# define V_ENTRY_F32_2(name, kernel)					\
+  V_VPCS v_f32_t _ZGVnN4vv_##name (v_f32_t, v_f32_t);			\
+  V_VPCS v_f32_t _ZGVnN4vv_##name (v_f32_t x, v_f32_t y)		\
+  {									\
+    return kernel (x, y);						\
+  }									\
+  V_VPCS v_f32x2_t _ZGVnN2vv_##name (v_f32x2_t, v_f32x2_t);		\
+  V_VPCS v_f32x2_t _ZGVnN2vv_##name (v_f32x2_t x, v_f32x2_t y)		\
+  {									\
+    v_f32_t r = kernel ((v_f32_t) {x[0], x[1], x[0], x[1]},		\
+			(v_f32_t) {y[0], y[1], y[0], y[1]});		\
+    return (v_f32x2_t) {r[0], r[1]};					\
+  }
+
+#endif /* __aarch64__ */
+
+#endif /* HAVE_VECTOR_MATH */
+
+#endif /* _V_MATH_H */
@@ -0,0 +1,154 @@
+/* Vector variants of the double-precision x^y function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#include "v_math.h"
+#if HAVE_VECTOR_MATH
+
+#define T __pow_log_data.tab
+#define A __pow_log_data.poly
+#define Ln2hi __pow_log_data.ln2hi
+#define Ln2lo __pow_log_data.ln2lo
+#define N (1 << POW_LOG_TABLE_BITS)
+#define OFF 0x3fe6955500000000
+
+/* log(x) with about 15 extra bits in TAIL, as log_inline in pow.  */
+static inline v_f64_t
+v_log_inline (v_u64_t ix, v_f64_t *tail)
+{
+  v_u64_t tmp, i, iz, invc, logc, logctail;
+  v_f64_t z, kd, r, t1, t2, lo1, lo2, ar, ar2, ar3, hi, lo3, lo4, p, lo, y;
+#if !HAVE_FAST_FMA
+  v_f64_t zhi, zlo, rhi, rlo, arhi, arhi2;
+#endif
+  int j;
+
+  tmp = ix - OFF;
+  i = (tmp >> (52 - POW_LOG_TABLE_BITS)) % N;
+  kd = v_f64_s64 ((v_s64_t) tmp >> 52);
+  iz = ix - (tmp & 0xfffULL << 52);
+  z = v_as_f64_u64 (iz);
+  for (j = 0; j < V_F64_LANES; j++)
+    {
+      invc[j] = asuint64 (T[i[j]].invc);
+      logc[j] = asuint64 (T[i[j]].logc);
+      logctail[j] = asuint64 (T[i[j]].logctail);
+    }
+
+#if HAVE_FAST_FMA
+  r = v_fma_f64 (z, v_as_f64_u64 (invc), v_f64 (-1.0));
+#else
+  zhi = v_as_f64_u64 ((iz + (1ULL << 31)) & (-1ULL << 32));
+  zlo = z - zhi;
+  rhi = zhi * v_as_f64_u64 (invc) - 1.0;
+  rlo = zlo * v_as_f64_u64 (invc);
+  r = rhi + rlo;
+#endif
+
+  t1 = kd * Ln2hi + v_as_f64_u64 (logc);
+  t2 = t1 + r;
+  lo1 = kd * Ln2lo + v_as_f64_u64 (logctail);
+  lo2 = t1 - t2 + r;
+
+  ar = A[0] * r;
+  ar2 = r * ar;
+  ar3 = r * ar2;
+#if HAVE_FAST_FMA
+  hi = t2 + ar2;
+  lo3 = v_fma_f64 (ar, r, -ar2);
+  lo4 = t2 - hi + ar2;
+#else
+  arhi = A[0] * rhi;
+  arhi2 = rhi * arhi;
+  hi = t2 + arhi2;
+  lo3 = rlo * (ar + arhi);
+  lo4 = t2 - hi + arhi2;
+#endif
+  p = (ar3
+       * (A[1] + r * A[2] + ar2 * (A[3] + r * A[4] + ar2 * (A[5] + r * A[6]))));
+  lo = lo1 + lo2 + lo3 + lo4 + p;
+  y = hi + lo;
+  *tail = hi - y + lo;
+  return y;
+}
+
+#undef N
+#undef T
+#define N (1 << EXP_TABLE_BITS)
+#define InvLn2N __exp_data.invln2N
+#define NegLn2hiN __exp_data.negln2hiN
+#define NegLn2loN __exp_data.negln2loN
+#define Shift __exp_data.shift
+#define T __exp_data.tab
+#define C2 __exp_data.poly[5 - EXP_POLY_ORDER]
+#define C3 __exp_data.poly[6 - EXP_POLY_ORDER]
+#define C4 __exp_data.poly[7 - EXP_POLY_ORDER]
+#define C5 __exp_data.poly[8 - EXP_POLY_ORDER]
+
+/* exp(x+xtail), as exp_inline in pow for |x| < 512.  */
+static inline v_f64_t
+v_exp_inline (v_f64_t x, v_f64_t xtail)
+{
+  v_u64_t ki, idx, tail, sbits;
+  v_f64_t kd, r, r2, tmp, scale;
+  int i;
+
+  kd = InvLn2N * x + Shift;
+  ki = v_as_u64_f64 (kd);
+  kd -= Shift;
+  r = x + kd * NegLn2hiN + kd * NegLn2loN;
+  r += xtail;
+  idx = 2 * (ki % N);
+  for (i = 0; i < V_F64_LANES; i++)
+    {
+      tail[i] = T[idx[i]];
+      sbits[i] = T[idx[i] + 1];
+    }
+  sbits += ki << (52 - EXP_TABLE_BITS);
+  r2 = r * r;
+  tmp = v_as_f64_u64 (tail) + r + r2 * (C2 + r * C3)
+	+ r2 * r2 * (C4 + r * C5);
+  scale = v_as_f64_u64 (sbits);
+  return scale + scale * tmp;
+}
+
+/* Same algorithm as pow, for lanes with normal positive finite x, y
+   which is not tiny, huge or nan, and |y log(x)| < 512.  Other lanes are
+   done by pow.  */
+static inline v_f64_t
+v_pow (v_f64_t x, v_f64_t y)
+{
+  v_u64_t ix, iy, special;
+  v_f64_t hi, lo, ehi, elo, z;
+#if !HAVE_FAST_FMA
+  v_f64_t yhi, ylo, lhi, llo;
+#endif
+
+  ix = v_as_u64_f64 (x);
+  iy = v_as_u64_f64 (y);
+  special = ((ix >> 52) - 0x001 >= 0x7ff - 0x001)
+	    | ((iy >> 52 & 0x7ff) - 0x3be >= 0x43e - 0x3be);
+
+  hi = v_log_inline (ix, &lo);
+#if HAVE_FAST_FMA
+  ehi = y * hi;
+  elo = y * lo + v_fma_f64 (y, hi, -ehi);
+#else
+  yhi = v_as_f64_u64 (iy & -1ULL << 27);
+  ylo = y - yhi;
+  lhi = v_as_f64_u64 (v_as_u64_f64 (hi) & -1ULL << 27);
+  llo = hi - lhi + lo;
+  ehi = yhi * lhi;
+  elo = ylo * lhi + y * llo;
+#endif
+  special |= (v_as_u64_f64 (ehi) >> 52 & 0x7ff) >= 0x408;
+
+  z = v_exp_inline (ehi, elo);
+  if (__builtin_expect (v_any_u64 (special), 0))
+    return v_call2_f64 (pow, x, y, z, special);
+  return z;
+}
+
+V_ENTRY_F64_2 (pow, v_pow)
+
+#endif /* HAVE_VECTOR_MATH */
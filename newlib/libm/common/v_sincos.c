@@ -0,0 +1,90 @@
+/* Vector variants of the double-precision sin and cos functions.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#include "v_math.h"
+#if HAVE_VECTOR_MATH
+
+/* The argument reduction and the polynomials are those of e_rem_pio2.c,
+   k_sin.c and k_cos.c.  pio2_1, pio2_2 and pio2_3 have 33 bits, so their
+   products with n are exact for |n| < 2^20.  */
+static const double
+  Shift = 0x1.8p52,
+  invpio2 = 6.36619772367581382433e-01,
+  pio2_1 = 1.57079632673412561417e+00,
+  pio2_2 = 6.07710050630396597660e-11,
+  pio2_3 = 2.02226624871116645580e-21,
+  pio2_3t = 8.47842766036889956997e-32,
+  S1 = -1.66666666666666324348e-01,
+  S2 = 8.33333333332248946124e-03,
+  S3 = -1.98412698298579493134e-04,
+  S4 = 2.75573137070700676789e-06,
+  S5 = -2.50507602534068634195e-08,
+  S6 = 1.58969099521155010221e-10,
+  C1 = 4.16666666666666019037e-02,
+  C2 = -1.38888888888741095749e-03,
+  C3 = 2.48015872894767294178e-05,
+  C4 = -2.75573143513906633035e-07,
+  C5 = 2.08757232129817482790e-09,
+  C6 = -1.13596475577881948265e-11;
+
+/* sin (x + QUAD * pi/2) for lanes with |x| < 2^20.  Other lanes are done
+   by F.  */
+static inline v_f64_t
+v_sin_quad (v_f64_t x, uint64_t quad, double (*f) (double))
+{
+  v_u64_t special, n, odd;
+  v_f64_t kd, r, t, w, e1, e2, tail, y, yl, z, v, s, c, res;
+
+  special = (v_as_u64_f64 (x) >> 52 & 0x7ff) >= 0x413;
+
+  /* x = n pi/2 + y + yl, with |y| <= pi/4.  */
+  kd = x * invpio2 + Shift;
+  n = v_as_u64_f64 (kd) + quad;
+  kd -= Shift;
+  r = x - kd * pio2_1;
+  w = kd * pio2_2;
+  t = r;
+  r = t - w;
+  e1 = t - r - w;
+  w = kd * pio2_3;
+  t = r;
+  r = t - w;
+  e2 = t - r - w;
+  tail = e1 + e2 - kd * pio2_3t;
+  y = r + tail;
+  yl = r - y + tail;
+
+  /* Both kernels, then pick one by quadrant.  */
+  z = y * y;
+  v = z * y;
+  s = y - ((z * (0.5 * yl - v * (S2 + z * (S3 + z * (S4 + z * (S5 + z * S6)))))
+	    - yl) - v * S1);
+  r = z * (C1 + z * (C2 + z * C3)) + z * z * z * z * (C4 + z * (C5 + z * C6));
+  w = 1.0 - 0.5 * z;
+  c = w + (((1.0 - w) - 0.5 * z) + (z * r - y * yl));
+
+  odd = -(n & 1);
+  res = v_sel_f64 (odd, c, s);
+  res = v_as_f64_u64 (v_as_u64_f64 (res) ^ (n & 2) << 62);
+  if (__builtin_expect (v_any_u64 (special), 0))
+    return v_call_f64 (f, x, res, special);
+  return res;
+}
+
+static inline v_f64_t
+v_sin (v_f64_t x)
+{
+  return v_sin_quad (x, 0, sin);
+}
+
+static inline v_f64_t
+v_cos (v_f64_t x)
+{
+  return v_sin_quad (x, 1, cos);
+}
+
+V_ENTRY_F64_1 (sin, v_sin)
+V_ENTRY_F64_1 (cos, v_cos)
+
+#endif /* HAVE_VECTOR_MATH */
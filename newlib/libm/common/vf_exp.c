@@ -0,0 +1,54 @@
+/* Vector variants of the single-precision e^x function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#include "v_math.h"
+#if HAVE_VECTOR_MATH
+
+#define N (1 << EXP2F_TABLE_BITS)
+#define InvLn2N __exp2f_data.invln2_scaled
+#define T __exp2f_data.tab
+#define C __exp2f_data.poly_scaled
+#define SHIFT __exp2f_data.shift
+
+/* Same algorithm as expf, on two lanes in double precision.  */
+static inline v_f64_t
+v_expf_half (v_f64_t xd)
+{
+  v_u64_t ki, t;
+  v_f64_t z, kd, r, r2, y;
+  int i;
+
+  z = InvLn2N * xd;
+  kd = z + SHIFT;
+  ki = v_as_u64_f64 (kd);
+  kd -= SHIFT;
+  r = z - kd;
+  for (i = 0; i < V_F64_LANES; i++)
+    t[i] = T[ki[i] % N];
+  t += ki << (52 - EXP2F_TABLE_BITS);
+  z = C[0] * r + C[1];
+  r2 = r * r;
+  y = C[2] * r + 1;
+  y = z * r2 + y;
+  return y * v_as_f64_u64 (t);
+}
+
+/* Lanes with |x| >= 88 or nan are done by expf.  */
+static inline v_f32_t
+v_expf (v_f32_t x)
+{
+  v_u32_t special;
+  v_f32_t y;
+
+  special = (v_as_u32_f32 (x) >> 20 & 0x7ff) >= 0x42b;
+  y = v_f32_f64 (v_expf_half (v_lo_f64_f32 (x)),
+		 v_expf_half (v_hi_f64_f32 (x)));
+  if (__builtin_expect (v_any_u32 (special), 0))
+    return v_call_f32 (expf, x, y, special);
+  return y;
+}
+
+V_ENTRY_F32_1 (expf, v_expf)
+
+#endif /* HAVE_VECTOR_MATH */
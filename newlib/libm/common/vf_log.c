@@ -0,0 +1,62 @@
+/* Vector variants of the single-precision log(x) function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#include "v_math.h"
+#if HAVE_VECTOR_MATH
+
+#define T __logf_data.tab
+#define A __logf_data.poly
+#define Ln2 __logf_data.ln2
+#define N (1 << LOGF_TABLE_BITS)
+#define OFF 0x3f330000
+
+/* Same algorithm as logf, on lanes H and H + 1 in double precision.  */
+static inline v_f64_t
+v_logf_half (v_f32_t z, v_u32_t i, v_s32_t k, int h)
+{
+  v_f64_t zd, kd, invc, logc, r, r2, y, y0;
+  int j;
+
+  zd = (v_f64_t) {z[h], z[h + 1]};
+  kd = (v_f64_t) {k[h], k[h + 1]};
+  for (j = 0; j < V_F64_LANES; j++)
+    {
+      invc[j] = T[i[h + j]].invc;
+      logc[j] = T[i[h + j]].logc;
+    }
+  r = zd * invc - 1;
+  y0 = logc + kd * Ln2;
+  r2 = r * r;
+  y = A[1] * r + A[2];
+  y = A[0] * r2 + y;
+  return y * r2 + (y0 + r);
+}
+
+/* Lanes with subnormal, negative, zero, infinite or nan x are done by
+   logf.  */
+static inline v_f32_t
+v_logf (v_f32_t x)
+{
+  v_u32_t ix, special, tmp, i, iz;
+  v_s32_t k;
+  v_f32_t z, y;
+
+  ix = v_as_u32_f32 (x);
+  special = ix - 0x00800000 >= 0x7f800000 - 0x00800000;
+  tmp = ix - OFF;
+  i = (tmp >> (23 - LOGF_TABLE_BITS)) % N;
+  k = (v_s32_t) tmp >> 23;
+  iz = ix - (tmp & 0x1ff << 23);
+  z = v_as_f32_u32 (iz);
+  y = v_f32_f64 (v_logf_half (z, i, k, 0), v_logf_half (z, i, k, 2));
+  /* Exact zero for x == 1, as logf.  */
+  y = v_as_f32_u32 (v_as_u32_f32 (y) & ~(v_u32_t) (ix == 0x3f800000));
+  if (__builtin_expect (v_any_u32 (special), 0))
+    return v_call_f32 (logf, x, y, special);
+  return y;
+}
+
+V_ENTRY_F32_1 (logf, v_logf)
+
+#endif /* HAVE_VECTOR_MATH */
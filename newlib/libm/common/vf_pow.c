@@ -0,0 +1,102 @@
+/* Vector variants of the single-precision x^y function.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#include "v_math.h"
+#if HAVE_VECTOR_MATH
+
+#define N (1 << POWF_LOG2_TABLE_BITS)
+#define T __powf_log2_data.tab
+#define A __powf_log2_data.poly
+#define OFF 0x3f330000
+#define NE (1 << EXP2F_TABLE_BITS)
+#define TE __exp2f_data.tab
+/* The input of exp2 is scaled like the output of log2 in powf.  */
+#if TOINT_INTRINSICS
+# define C __exp2f_data.poly_scaled
+# define SHIFT __exp2f_data.shift
+#else
+# define C __exp2f_data.poly
+# define SHIFT __exp2f_data.shift_scaled
+#endif
+
+/* Same algorithm as powf, on lanes H and H + 1 in double precision.
+   Sets the lanes of *SPECIAL where |y log2(x)| >= 126.  */
+static inline v_f64_t
+v_powf_half (v_f32_t z, v_u32_t i, v_s32_t k, v_f32_t y, int h,
+	     v_u64_t *special)
+{
+  v_f64_t zd, kd, invc, logc, r, r2, r4, p, q, l, y0, ylogx;
+  v_u64_t ki, t;
+  int j;
+
+  zd = (v_f64_t) {z[h], z[h + 1]};
+  kd = (v_f64_t) {k[h], k[h + 1]};
+  for (j = 0; j < V_F64_LANES; j++)
+    {
+      invc[j] = T[i[h + j]].invc;
+      logc[j] = T[i[h + j]].logc;
+    }
+
+  /* log2(x) = log1p(z/c-1)/ln2 + log2(c) + k */
+  r = zd * invc - 1;
+  y0 = logc + kd;
+  r2 = r * r;
+  l = A[0] * r + A[1];
+  p = A[2] * r + A[3];
+  r4 = r2 * r2;
+  q = A[4] * r + y0;
+  q = p * r2 + q;
+  l = l * r4 + q;
+
+  ylogx = (v_f64_t) {y[h], y[h + 1]} * l;
+  *special = (v_as_u64_f64 (ylogx) >> 47 & 0xffff)
+	     >= asuint64 (126.0 * POWF_SCALE) >> 47;
+
+  /* exp2(x) = 2^(k/N) * 2^r ~= s * (C0*r^3 + C1*r^2 + C2*r + 1) */
+  kd = ylogx + SHIFT;
+  ki = v_as_u64_f64 (kd);
+  kd -= SHIFT;
+  r = ylogx - kd;
+  for (j = 0; j < V_F64_LANES; j++)
+    t[j] = TE[ki[j] % NE];
+  t += ki << (52 - EXP2F_TABLE_BITS);
+  p = C[0] * r + C[1];
+  r2 = r * r;
+  q = C[2] * r + 1;
+  q = p * r2 + q;
+  return q * v_as_f64_u64 (t);
+}
+
+/* Lanes with x which is not normal and positive, y which is zero,
+   infinite or nan, or results which may overflow or underflow are done
+   by powf.  */
+static inline v_f32_t
+v_powf (v_f32_t x, v_f32_t y)
+{
+  v_u32_t ix, iy, special, tmp, i, top, iz;
+  v_u64_t slo, shi;
+  v_s32_t k;
+  v_f32_t z, res;
+
+  ix = v_as_u32_f32 (x);
+  iy = v_as_u32_f32 (y);
+  special = (ix - 0x00800000 >= 0x7f800000 - 0x00800000)
+	    | (2 * iy - 1 >= 2u * 0x7f800000 - 1);
+  tmp = ix - OFF;
+  i = (tmp >> (23 - POWF_LOG2_TABLE_BITS)) % N;
+  top = tmp & 0xff800000;
+  iz = ix - top;
+  k = (v_s32_t) top >> (23 - POWF_SCALE_BITS);
+  z = v_as_f32_u32 (iz);
+  res = v_f32_f64 (v_powf_half (z, i, k, y, 0, &slo),
+		   v_powf_half (z, i, k, y, 2, &shi));
+  special |= (v_u32_t) {slo[0], slo[1], shi[0], shi[1]};
+  if (__builtin_expect (v_any_u32 (special), 0))
+    return v_call2_f32 (powf, x, y, res, special);
+  return res;
+}
+
+V_ENTRY_F32_2 (powf, v_powf)
+
+#endif /* HAVE_VECTOR_MATH */
@@ -0,0 +1,67 @@
+/* Vector variants of the single-precision sin and cos functions.
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#include "fdlibm.h"
+#include "v_math.h"
+#if HAVE_VECTOR_MATH
+
+#include "sincosf.h"
+
+static const double
+  Shift = 0x1.8p52,
+  hpi_inv = 0x1.45f306dc9c883p-1;
+
+/* sin (x + QUAD * pi/2) for lanes H and H + 1, using the reduction of
+   reduce_fast and the polynomials of sinf_poly.  */
+static inline v_f64_t
+v_sinf_half (v_f32_t x, uint64_t quad, int h)
+{
+  const sincos_t *p = &__sincosf_table[0];
+  v_f64_t xd, kd, r, r2, r3, r4, s, c;
+  v_u64_t n;
+
+  xd = (v_f64_t) {x[h], x[h + 1]};
+  kd = xd * hpi_inv + Shift;
+  n = v_as_u64_f64 (kd) + quad;
+  kd -= Shift;
+  r = xd - kd * p->hpi;
+
+  r2 = r * r;
+  r3 = r * r2;
+  r4 = r2 * r2;
+  s = r + r3 * p->s1 + r3 * r2 * (p->s2 + r2 * p->s3);
+  c = p->c0 + r2 * p->c1 + r4 * p->c2 + r4 * r2 * (p->c3 + r2 * p->c4);
+  s = v_sel_f64 (-(n & 1), c, s);
+  return v_as_f64_u64 (v_as_u64_f64 (s) ^ (n & 2) << 62);
+}
+
+/* Lanes with |x| >= 120 or nan are done by F.  */
+static inline v_f32_t
+v_sinf_quad (v_f32_t x, uint64_t quad, float (*f) (float))
+{
+  v_u32_t special;
+  v_f32_t y;
+
+  special = (v_as_u32_f32 (x) >> 20 & 0x7ff) >= 0x42f;
+  y = v_f32_f64 (v_sinf_half (x, quad, 0), v_sinf_half (x, quad, 2));
+  if (__builtin_expect (v_any_u32 (special), 0))
+    return v_call_f32 (f, x, y, special);
+  return y;
+}
+
+static inline v_f32_t
+v_sinf (v_f32_t x)
+{
+  return v_sinf_quad (x, 0, sinf);
+}
+
+static inline v_f32_t
+v_cosf (v_f32_t x)
+{
+  return v_sinf_quad (x, 1, cosf);
+}
+
+V_ENTRY_F32_1 (sinf, v_sinf)
+V_ENTRY_F32_1 (cosf, v_cosf)
+
+#endif /* HAVE_VECTOR_MATH */
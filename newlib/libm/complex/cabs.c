@@ -18,12 +18,20 @@ INDEX
         cabsf
 INDEX
         cabsl
+INDEX
+        cabs_array
+INDEX
+        cabsf_array
 
 SYNOPSIS
        #include <complex.h>
        double cabs(double complex <[z]>);
        float cabsf(float complex <[z]>);
        long double cabsl(long double complex <[z]>);
+       void cabs_array(double *<[r]>, const double complex *<[z]>,
+                       size_t <[n]>);
+       void cabsf_array(float *<[r]>, const float complex *<[z]>,
+                        size_t <[n]>);
 
 
 DESCRIPTION
@@ -36,12 +44,18 @@ DESCRIPTION
         <<cabsl>> is identical to <<cabs>>, except that it performs
         its calculations on <<long double complex>>.
 
+        <<cabs_array>> and <<cabsf_array>> store the absolute values of
+        the <[n]> values at <[z]> to <[r]>, with the same results as calling
+        <<cabs>> or <<cabsf>> for each of them.
+
 RETURNS
         The cabs* functions return the complex absolute value.
 
 PORTABILITY
         <<cabs>>, <<cabsf>> and <<cabsl>> are ISO C99
 
+        <<cabs_array>> and <<cabsf_array>> are newlib extensions.
+
 QUICKREF
         <<cabs>>, <<cabsf>> and <<cabsl>> are ISO C99
 
@@ -57,3 +71,12 @@ cabs(double complex z)
 
 	return hypot( creal(z), cimag(z) );
 }
+
+void
+cabs_array(double *r, const double complex *z, size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++)
+		r[i] = hypot(creal(z[i]), cimag(z[i]));
+}
@@ -17,3 +17,12 @@ cabsf(float complex z)
 
 	return hypotf( crealf(z), cimagf(z) );
 }
+
+void
+cabsf_array(float *r, const float complex *z, size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++)
+		r[i] = hypotf(crealf(z[i]), cimagf(z[i]));
+}
@@ -16,11 +16,19 @@ INDEX
         carg
 INDEX
         cargf
+INDEX
+        carg_array
+INDEX
+        cargf_array
 
 SYNOPSIS
        #include <complex.h>
        double carg(double complex <[z]>);
        float cargf(float complex <[z]>);
+       void carg_array(double *<[r]>, const double complex *<[z]>,
+                       size_t <[n]>);
+       void cargf_array(float *<[r]>, const float complex *<[z]>,
+                        size_t <[n]>);
 
 
 DESCRIPTION
@@ -30,6 +38,10 @@ DESCRIPTION
         <<cargf>> is identical to <<carg>>, except that it performs
         its calculations on <<floats complex>>.
 
+        <<carg_array>> and <<cargf_array>> store the arguments of the <[n]>
+        values at <[z]> to <[r]>, with the same results as calling <<carg>>
+        or <<cargf>> for each of them.
+
 RETURNS
         @ifnottex
         The carg functions return the value of the argument in the 
@@ -43,6 +55,8 @@ RETURNS
 PORTABILITY
         <<carg>> and <<cargf>> are ISO C99
 
+        <<carg_array>> and <<cargf_array>> are newlib extensions.
+
 QUICKREF
         <<carg>> and <<cargf>> are ISO C99
 
@@ -57,3 +71,12 @@ carg(double complex z)
 
 	return atan2( cimag(z) , creal(z) );
 }
+
+void
+carg_array(double *r, const double complex *z, size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++)
+		r[i] = atan2(cimag(z[i]), creal(z[i]));
+}
@@ -17,3 +17,12 @@ cargf(float complex z)
 
 	return atan2f( cimagf(z), crealf(z) );
 }
+
+void
+cargf_array(float *r, const float complex *z, size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++)
+		r[i] = atan2f(cimagf(z[i]), crealf(z[i]));
+}
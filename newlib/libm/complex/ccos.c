@@ -65,6 +65,7 @@ QUICKREF
 */
 
 
+#define _GNU_SOURCE
 #include <complex.h>
 #include <math.h>
 #include "cephes_subr.h"
@@ -73,9 +74,10 @@ double complex
 ccos(double complex z)
 {
 	double complex w;
-	double ch, sh;
+	double ch, sh, s, c;
 
 	_cchsh(cimag(z), &ch, &sh);
-	w = cos(creal(z)) * ch - (sin(creal(z)) * sh) * I;
+	sincos(creal(z), &s, &c);
+	w = c * ch - (s * sh) * I;
 	return w;
 }
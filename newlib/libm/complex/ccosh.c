@@ -65,17 +65,21 @@ QUICKREF
 */
 
 
+#define _GNU_SOURCE
 #include <complex.h>
 #include <math.h>
+#include "cephes_subr.h"
 
 double complex
 ccosh(double complex z)
 {
 	double complex w;
-	double x, y;
+	double x, y, ch, sh, s, c;
 
 	x = creal(z);
 	y = cimag(z);
-	w = cosh(x) * cos(y) + (sinh(x) * sin(y)) * I;
+	_cchsh(x, &ch, &sh);
+	sincos(y, &s, &c);
+	w = ch * c + (sh * s) * I;
 	return w;
 }
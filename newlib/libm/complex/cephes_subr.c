@@ -36,22 +36,30 @@
 #include <math.h>
 #include "cephes_subr.h"
 
-/* calculate cosh and sinh */
+/* calculate cosh and sinh
+ *
+ * Both come from one call of expm1 or exp.  Beyond the overflow
+ * threshold of exp, cosh and sinh are called to keep their full range.
+ */
 
 void
 _cchsh(double x, double *c, double *s)
 {
-	double e, ei;
+	double e, ei, t;
 
 	if (fabs(x) <= 0.5) {
-		*c = cosh(x);
-		*s = sinh(x);
-	} else {
+		t = expm1(fabs(x));
+		*c = 1.0 + t * t / (2.0 * (1.0 + t));
+		*s = copysign(0.5 * (2.0 * t - t * t / (t + 1.0)), x);
+	} else if (fabs(x) < 709.0) {
 		e = exp(x);
 		ei = 0.5 / e;
 		e = 0.5 * e;
 		*s = e - ei;
 		*c = e + ei;
+	} else {
+		*c = cosh(x);
+		*s = sinh(x);
 	}
 }
 
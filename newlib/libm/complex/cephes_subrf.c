@@ -36,22 +36,30 @@
 #include <math.h>
 #include "cephes_subrf.h"
 
-/* calculate cosh and sinh */
+/* calculate cosh and sinh
+ *
+ * Both come from one call of expm1f or expf.  Beyond the overflow
+ * threshold of expf, coshf and sinhf are called to keep their full range.
+ */
 
 void
 _cchshf(float x, float *c, float *s)
 {
-	float e, ei;
+	float e, ei, t;
 
 	if (fabsf(x) <= 0.5f) {
-		*c = coshf(x);
-		*s = sinhf(x);
-	} else {
+		t = expm1f(fabsf(x));
+		*c = 1.0f + t * t / (2.0f * (1.0f + t));
+		*s = copysignf(0.5f * (2.0f * t - t * t / (t + 1.0f)), x);
+	} else if (fabsf(x) < 88.0f) {
 		e = expf(x);
 		ei = 0.5f / e;
 		e = 0.5f * e;
 		*s = e - ei;
 		*c = e + ei;
+	} else {
+		*c = coshf(x);
+		*s = sinhf(x);
 	}
 }
 
@@ -40,11 +40,19 @@ INDEX
         cexp
 INDEX
         cexpf
+INDEX
+        cexp_array
+INDEX
+        cexpf_array
 
 SYNOPSIS
        #include <complex.h>
        double complex cexp(double complex <[z]>);
        float complex cexpf(float complex <[z]>);
+       void cexp_array(double complex *<[w]>, const double complex *<[z]>,
+                       size_t <[n]>);
+       void cexpf_array(float complex *<[w]>, const float complex *<[z]>,
+                        size_t <[n]>);
 
 
 DESCRIPTION
@@ -53,18 +61,25 @@ DESCRIPTION
         <<cexpf>> is identical to <<cexp>>, except that it performs
         its calculations on <<floats complex>>.
 
+        <<cexp_array>> and <<cexpf_array>> store the exponentials of the
+        <[n]> values at <[z]> to <[w]>, with the same results as calling
+        <<cexp>> or <<cexpf>> for each of them.  <[w]> may be equal to <[z]>.
+
 RETURNS
         The cexp functions return the complex base-<[e]> exponential value.
 
 PORTABILITY
         <<cexp>> and <<cexpf>> are ISO C99
 
+        <<cexp_array>> and <<cexpf_array>> are newlib extensions.
+
 QUICKREF
         <<cexp>> and <<cexpf>> are ISO C99
 
 */
 
 
+#define _GNU_SOURCE
 #include <complex.h>
 #include <math.h>
 
@@ -72,11 +87,25 @@ double complex
 cexp(double complex z)
 {
 	double complex w;
-	double r, x, y;
+	double r, x, y, s, c;
 
 	x = creal(z);
 	y = cimag(z);
 	r = exp(x);
-	w = r * cos(y) + r * sin(y) * I;
+	sincos(y, &s, &c);
+	w = r * c + r * s * I;
 	return w;
 }
+
+void
+cexp_array(double complex *w, const double complex *z, size_t n)
+{
+	double r, s, c;
+	size_t i;
+
+	for (i = 0; i < n; i++) {
+		r = exp(creal(z[i]));
+		sincos(cimag(z[i]), &s, &c);
+		w[i] = r * c + r * s * I;
+	}
+}
@@ -32,6 +32,7 @@
  * Marco Atzeri <marco_atzeri@yahoo.it>
  */
 
+#define _GNU_SOURCE
 #include <complex.h>
 #include <math.h>
 
@@ -39,11 +40,25 @@ float complex
 cexpf(float complex z)
 {
 	float complex w;
-	float r, x, y;
+	float r, x, y, s, c;
 
 	x = crealf(z);
 	y = cimagf(z);
 	r = expf(x);
-	w = r * cosf(y) + r * sinf(y) * I;
+	sincosf(y, &s, &c);
+	w = r * c + r * s * I;
 	return w;
 }
+
+void
+cexpf_array(float complex *w, const float complex *z, size_t n)
+{
+	float r, s, c;
+	size_t i;
+
+	for (i = 0; i < n; i++) {
+		r = expf(crealf(z[i]));
+		sincosf(cimagf(z[i]), &s, &c);
+		w[i] = r * c + r * s * I;
+	}
+}
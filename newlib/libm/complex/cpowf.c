@@ -32,6 +32,7 @@
  * Marco Atzeri <marco_atzeri@yahoo.it>
  */
 
+#define _GNU_SOURCE
 #include <complex.h>
 #include <math.h>
 
@@ -39,7 +40,7 @@ float complex
 cpowf(float complex a, float complex z)
 {
 	float complex w;
-	float x, y, r, theta, absa, arga;
+	float x, y, r, theta, absa, arga, s, c;
 
 	x = crealf(z);
 	y = cimagf(z);
@@ -54,6 +55,7 @@ cpowf(float complex a, float complex z)
 		r = r * expf(-y * arga);
 		theta = theta + y * logf(absa);
 	}
-	w = r * cosf(theta) + (r * sinf(theta)) * I;
+	sincosf(theta, &s, &c);
+	w = r * c + (r * s) * I;
 	return w;
 }
@@ -64,17 +64,21 @@ QUICKREF
 
 */
 
+#define _GNU_SOURCE
 #include <complex.h>
 #include <math.h>
+#include "cephes_subr.h"
 
 double complex
 csinh(double complex z)
 {
 	double complex w;
-	double x, y;
+	double x, y, ch, sh, s, c;
 
 	x = creal(z);
 	y = cimag(z);
-	w = sinh(x) * cos(y) + (cosh(x) * sin(y)) * I;
+	_cchsh(x, &ch, &sh);
+	sincos(y, &s, &c);
+	w = sh * c + (ch * s) * I;
 	return w;
 }
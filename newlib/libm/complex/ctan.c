@@ -65,6 +65,7 @@ QUICKREF
 */
 
 
+#define _GNU_SOURCE
 #include <complex.h>
 #include <math.h>
 #include "cephes_subr.h"
@@ -73,9 +74,11 @@ double complex
 ctan(double complex z)
 {
 	double complex w;
-	double d;
+	double d, ch, sh, s, c;
 
-	d = cos(2.0 * creal(z)) + cosh(2.0 * cimag(z));
+	sincos(2.0 * creal(z), &s, &c);
+	_cchsh(2.0 * cimag(z), &ch, &sh);
+	d = c + ch;
 
 	if (fabs(d) < 0.25)
 		d = _ctans(z);
@@ -86,6 +89,6 @@ ctan(double complex z)
 		return w;
 	}
 
-	w = sin(2.0 * creal(z)) / d + (sinh(2.0 * cimag(z)) / d) * I;
+	w = s / d + (sh / d) * I;
 	return w;
 }
@@ -65,19 +65,23 @@ QUICKREF
 */
 
 
+#define _GNU_SOURCE
 #include <complex.h>
 #include <math.h>
+#include "cephes_subr.h"
 
 double complex
 ctanh(double complex z)
 {
 	double complex w;
-	double x, y, d;
+	double x, y, d, ch, sh, s, c;
 
 	x = creal(z);
 	y = cimag(z);
-	d = cosh(2.0 * x) + cos(2.0 * y);
-	w = sinh(2.0 * x) / d  +  (sin(2.0 * y) / d) * I;
+	_cchsh(2.0 * x, &ch, &sh);
+	sincos(2.0 * y, &s, &c);
+	d = ch + c;
+	w = sh / d  +  (s / d) * I;
 
 	return w;
 }
@@ -32,19 +32,23 @@
  * Marco Atzeri <marco_atzeri@yahoo.it>
  */
 
+#define _GNU_SOURCE
 #include <complex.h>
 #include <math.h>
+#include "cephes_subrf.h"
 
 float complex
 ctanhf(float complex z)
 {
 	float complex w;
-	float x, y, d;
+	float x, y, d, ch, sh, s, c;
 
 	x = crealf(z);
 	y = cimagf(z);
-	d = coshf(2.0f * x) + cosf(2.0f * y);
-	w = sinhf(2.0f * x) / d  +  (sinf(2.0f * y) / d) * I;
+	_cchshf(2.0f * x, &ch, &sh);
+	sincosf(2.0f * y, &s, &c);
+	d = ch + c;
+	w = sh / d  +  (s / d) * I;
 
 	return w;
 }
@@ -51,16 +51,25 @@ const fenv_t *_fe_nomask_env = &fe_nomask_env;
    be *that* WJM!  */
 static inline bool use_sse(void)
 {
+#if defined(__x86_64__) || defined(__SSE__)
+  /* SSE is part of the architecture, or the compiler already uses it.  */
+  return true;
+#else
+  /* CPUID serializes the pipeline, so only ask once.  Racing threads all
+     store the same answer.  */
+  static int have_sse = -1;
   unsigned int edx, eax;
 
-  /* Check for presence of SSE: invoke CPUID #1, check EDX bit 25.  */
-  eax = 1;
-  __asm__ volatile ("cpuid" : "=d" (edx), "+a" (eax) :: "%ecx", "%ebx");
-  /* If this flag isn't set we'll avoid trying to execute any SSE.  */
-  if ((edx & (1 << 25)) != 0)
-    return true;
-
-  return false;
+  if (have_sse < 0)
+    {
+      /* Check for presence of SSE: invoke CPUID #1, check EDX bit 25.  */
+      eax = 1;
+      __asm__ volatile ("cpuid" : "=d" (edx), "+a" (eax) :: "%ecx", "%ebx");
+      /* If this flag isn't set we'll avoid trying to execute any SSE.  */
+      have_sse = (edx & (1 << 25)) != 0;
+    }
+  return have_sse;
+#endif
 }
 
 /* forward declaration */
@@ -177,12 +186,20 @@ int
 feholdexcept (fenv_t *envp)
 {
   unsigned int mxcsr;
-  fegetenv (envp);
-  mxcsr = envp->_sse_mxcsr & ~FE_ALL_EXCEPT;
+
+  /* fnstenv masks all x87 exceptions, which is what is wanted here, so
+     unlike fegetenv there is no need to load the environment back.  */
+  __asm__ volatile ("fnstenv %0\n\
+                     fnclex"
+		    : "=m" (envp->_fpu) : );
   if (use_sse())
-    __asm__ volatile ("ldmxcsr %0" :: "m" (mxcsr));
-  __asm__ volatile ("fnclex");
-  fedisableexcept (FE_ALL_EXCEPT);
+    {
+      __asm__ volatile ("stmxcsr %0" : "=m" (envp->_sse_mxcsr) : );
+      mxcsr = (envp->_sse_mxcsr | (FE_ALL_EXCEPT << FE_SSE_EXCEPT_MASK_SHIFT))
+	      & ~FE_ALL_EXCEPT;
+      if (mxcsr != envp->_sse_mxcsr)
+	__asm__ volatile ("ldmxcsr %0" :: "m" (mxcsr));
+    }
   return 0;
 }
 
@@ -213,19 +230,40 @@ int
 feupdateenv (const fenv_t *envp)
 {
   fenv_t envcopy;
-  unsigned int mxcsr = 0;
-  unsigned short sw;
+  unsigned int mxcsr = 0, new_mxcsr;
+  unsigned short cw, sw;
+  bool reload = false;
 
-  /* Don't want to modify *envp, but want to update environment atomically,
-     so take a copy and merge the existing exceptions into it.  */
-  memcpy (&envcopy, envp, sizeof *envp);
+  __asm__ volatile ("fnstcw %0" : "=m" (cw) : );
   __asm__ volatile ("fnstsw %0" : "=m" (sw) : );
   if (use_sse())
     __asm__ volatile ("stmxcsr %0" : "=m" (mxcsr) : );
-  envcopy._fpu._fpu_sw |= (sw & FE_ALL_EXCEPT);
-  envcopy._sse_mxcsr |= (mxcsr & FE_ALL_EXCEPT);
 
-  return fesetenv (&envcopy);
+  if ((envp == FE_DFL_ENV || envp == FE_NOMASK_ENV) &&
+      envp->_fpu._fpu_cw == 0)
+    {
+      /* This resets both units, so make sure they are loaded below.  */
+      _feinitialise ();
+      reload = true;
+    }
+
+  /* Don't want to modify *envp, but want to update environment atomically,
+     so take a copy and merge the existing exceptions into it.  */
+  memcpy (&envcopy, envp, sizeof *envp);
+  envcopy._fpu._fpu_sw |= (sw & FE_ALL_EXCEPT);
+  new_mxcsr = envcopy._sse_mxcsr | (mxcsr & FE_ALL_EXCEPT);
+
+  /* Loading either unit is far slower than reading it, and in the usual
+     feholdexcept/feupdateenv pair nothing changes but the flags raised in
+     between, which are kept anyway.  So only load a unit whose state would
+     change: in practice the SSE unit, and the x87 unit only after long
+     double arithmetic raised a new exception.  */
+  if (reload || cw != (unsigned short) envcopy._fpu._fpu_cw
+      || (envcopy._fpu._fpu_sw & ~sw & FE_ALL_EXCEPT) != 0)
+    __asm__ volatile ("fldenv %0" :: "m" (envcopy._fpu) );
+  if (use_sse() && (reload || new_mxcsr != mxcsr))
+    __asm__ volatile ("ldmxcsr %0" :: "m" (new_mxcsr));
+  return 0;
 }
 
 /*  This function clears all of the supported exception flags indicated by
@@ -353,8 +391,17 @@ int
 fegetround (void)
 {
   unsigned short cw;
+  unsigned int mxcsr;
 
-  /* Get control word.  We assume SSE and x87 stay in sync.  */
+  /* Ask the unit which does float and double arithmetic.  We assume SSE
+     and x87 stay in sync.  */
+  if (use_sse())
+    {
+      __asm__ volatile ("stmxcsr %0" : "=m" (mxcsr) : );
+      return (mxcsr & FE_MXCSR_ROUND_MASK) >> FE_MXCSR_ROUND_SHIFT;
+    }
+
+  /* Get control word.  */
   __asm__ volatile ("fnstcw %0" : "=m" (cw) : );
 
   return (cw & FE_CW_ROUND_MASK) >> FE_CW_ROUND_SHIFT;
@@ -367,28 +414,30 @@ fegetround (void)
 int
 fesetround (int round)
 {
-  unsigned short cw;
-  unsigned int mxcsr = 0;
+  unsigned short cw, new_cw;
+  unsigned int mxcsr, new_mxcsr;
 
   /* Will succeed for any valid value of the input parameter.  */
   if (round < FE_TONEAREST || round > FE_TOWARDZERO)
     return EINVAL;
 
-  /* Get control words.  */
-  __asm__ volatile ("fnstcw %0" : "=m" (cw) : );
+  /* The x87 unit is only used for long double, but it has to follow the
+     SSE unit all the same.  Loading a control register costs much more
+     than reading it, so each is only loaded when its mode changes, which
+     makes setting the mode already in effect nearly free.  */
   if (use_sse())
-    __asm__ volatile ("stmxcsr %0" : "=m" (mxcsr) : );
-
-  /* Twiddle bits.  */
-  cw &= ~FE_CW_ROUND_MASK;
-  cw |= (round << FE_CW_ROUND_SHIFT);
-  mxcsr &= ~FE_MXCSR_ROUND_MASK;
-  mxcsr |= (round << FE_MXCSR_ROUND_SHIFT);
+    {
+      __asm__ volatile ("stmxcsr %0" : "=m" (mxcsr) : );
+      new_mxcsr = (mxcsr & ~FE_MXCSR_ROUND_MASK)
+		  | (round << FE_MXCSR_ROUND_SHIFT);
+      if (new_mxcsr != mxcsr)
+	__asm__ volatile ("ldmxcsr %0" :: "m" (new_mxcsr));
+    }
 
-  /* Set back into FPU state.  */
-  __asm__ volatile ("fldcw %0" :: "m" (cw));
-  if (use_sse())
-    __asm__ volatile ("ldmxcsr %0" :: "m" (mxcsr));
+  __asm__ volatile ("fnstcw %0" : "=m" (cw) : );
+  new_cw = (cw & ~FE_CW_ROUND_MASK) | (round << FE_CW_ROUND_SHIFT);
+  if (new_cw != cw)
+    __asm__ volatile ("fldcw %0" :: "m" (new_cw));
 
   /* Indicate success.  */
   return 0;
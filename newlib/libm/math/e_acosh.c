@@ -27,6 +27,9 @@
  */
 
 #include "fdlibm.h"
+#if !__OBSOLETE_MATH
+#include "math_config.h"
+#endif
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -50,7 +53,11 @@ ln2	= 6.93147180559945286227e-01;  /* 0x3FE62E42, 0xFEFA39EF */
 	__uint32_t lx;
 	EXTRACT_WORDS(hx,lx,x);
 	if(hx<0x3ff00000) {		/* x < 1 */
+#if __OBSOLETE_MATH
 	    return (x-x)/(x-x);
+#else
+	    return __math_invalid(x);
+#endif
 	} else if(hx >=0x41b00000) {	/* x > 2**28 */
 	    if(hx >=0x7ff00000) {	/* x is inf of NaN */
 	        return x+x;
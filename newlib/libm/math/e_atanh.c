@@ -31,6 +31,9 @@
  */
 
 #include "fdlibm.h"
+#if !__OBSOLETE_MATH
+#include "math_config.h"
+#endif
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -58,10 +61,17 @@ static double zero = 0.0;
 	__uint32_t lx;
 	EXTRACT_WORDS(hx,lx,x);
 	ix = hx&0x7fffffff;
+#if __OBSOLETE_MATH
 	if ((ix|((lx|(-lx))>>31))>0x3ff00000) /* |x|>1 */
 	    return (x-x)/(x-x);
 	if(ix==0x3ff00000) 
 	    return x/zero;
+#else
+	if ((ix|((lx|(-lx))>>31))>0x3ff00000) /* |x|>1 */
+	    return __math_invalid(x);
+	if(ix==0x3ff00000) 
+	    return __math_divzero((__uint32_t)hx>>31);
+#endif
 	if(ix<0x3e300000&&(huge+x)>zero) return x;	/* x<2**-28 */
 	SET_HIGH_WORD(x,ix);
 	if(ix<0x3fe00000) {		/* x < 0.5 */
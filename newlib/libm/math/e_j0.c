@@ -57,6 +57,9 @@
  */
 
 #include "fdlibm.h"
+#if !__OBSOLETE_MATH
+#include "math_config.h"
+#endif
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -173,9 +176,15 @@ v04  =  4.41110311332675467403e-10; /* 0x3DFE5018, 0x3BD6D9EF */
 	EXTRACT_WORDS(hx,lx,x);
         ix = 0x7fffffff&hx;
     /* Y0(NaN) is NaN, y0(-inf) is Nan, y0(inf) is 0  */
+#if __OBSOLETE_MATH
 	if(ix>=0x7ff00000) return  one/(x+x*x); 
         if((ix|lx)==0) return -one/zero;
         if(hx<0) return zero/zero;
+#else
+        if((ix|lx)==0) return __math_divzero(1);
+        if(hx<0) return __math_invalid(x);
+	if(ix>=0x7ff00000) return  one/(x+x*x); 
+#endif
         if(ix >= 0x40000000) {  /* |x| >= 2.0 */
         /* y0(x) = sqrt(2/(pi*x))*(p0(x)*sin(x0)+q0(x)*cos(x0))
          * where x0 = x-pi/4
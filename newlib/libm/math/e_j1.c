@@ -57,6 +57,9 @@
  */
 
 #include "fdlibm.h"
+#if !__OBSOLETE_MATH
+#include "math_config.h"
+#endif
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -174,9 +177,15 @@ static double V0[5] = {
 	EXTRACT_WORDS(hx,lx,x);
         ix = 0x7fffffff&hx;
     /* if Y1(NaN) is NaN, Y1(-inf) is NaN, Y1(inf) is 0 */
+#if __OBSOLETE_MATH
 	if(ix>=0x7ff00000) return  one/(x+x*x); 
         if((ix|lx)==0) return -one/zero;
         if(hx<0) return zero/zero;
+#else
+        if((ix|lx)==0) return __math_divzero(1);
+        if(hx<0) return __math_invalid(x);
+	if(ix>=0x7ff00000) return  one/(x+x*x); 
+#endif
         if(ix >= 0x40000000) {  /* |x| >= 2.0 */
                 s = sin(x);
                 c = cos(x);
@@ -38,6 +38,9 @@
  */
 
 #include "fdlibm.h"
+#if !__OBSOLETE_MATH
+#include "math_config.h"
+#endif
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -231,8 +234,13 @@ static double zero  =  0.00000000000000000000e+00;
 	ix = 0x7fffffff&hx;
     /* if Y(n,NaN) is NaN */
 	if((ix|((__uint32_t)(lx|-lx))>>31)>0x7ff00000) return x+x;
+#if __OBSOLETE_MATH
 	if((ix|lx)==0) return -one/zero;
 	if(hx<0) return zero/zero;
+#else
+	if((ix|lx)==0) return __math_divzero(1);
+	if(hx<0) return __math_invalid(x);
+#endif
 	sign = 1;
 	if(n<0){
 		n = -n;
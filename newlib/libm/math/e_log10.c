@@ -45,6 +45,9 @@
  */
 
 #include "fdlibm.h"
+#if !__OBSOLETE_MATH
+#include "math_config.h"
+#endif
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -58,11 +61,13 @@ ivln10     =  4.34294481903251816668e-01, /* 0x3FDBCB7B, 0x1526E50E */
 log10_2hi  =  3.01029995663611771306e-01, /* 0x3FD34413, 0x509F6000 */
 log10_2lo  =  3.69423907715893078616e-13; /* 0x3D59FEF3, 0x11F12B36 */
 
+#if __OBSOLETE_MATH
 #ifdef __STDC__
 static const double zero   =  0.0;
 #else
 static double zero   =  0.0;
 #endif
+#endif
 
 #ifdef __STDC__
 	double __ieee754_log10(double x)
@@ -79,9 +84,15 @@ static double zero   =  0.0;
 
         k=0;
         if (hx < 0x00100000) {                  /* x < 2**-1022  */
+#if __OBSOLETE_MATH
             if (((hx&0x7fffffff)|lx)==0)
                 return -two54/zero;             /* log(+-0)=-inf */
             if (hx<0) return (x-x)/zero;        /* log(-#) = NaN */
+#else
+            if (((hx&0x7fffffff)|lx)==0)
+                return __math_divzero(1);       /* log(+-0)=-inf */
+            if (hx<0) return __math_invalid(x); /* log(-#) = NaN */
+#endif
             k -= 54; x *= two54; /* subnormal number, scale up x */
 	    GET_HIGH_WORD(hx,x);
         }
@@ -21,6 +21,9 @@
  */
 
 #include "fdlibm.h"
+#if !__OBSOLETE_MATH
+#include "math_config.h"
+#endif
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -49,11 +52,19 @@ static double zero = 0.0;
 	hx &= 0x7fffffff;
 
     /* purge off exception values */
+#if __OBSOLETE_MATH
 	if((hp|lp)==0) return (x*p)/(x*p); 	/* p = 0 */
 	if((hx>=0x7ff00000)||			/* x not finite */
 	  ((hp>=0x7ff00000)&&			/* p is NaN */
 	  (((hp-0x7ff00000)|lp)!=0)))
 	    return (x*p)/(x*p);
+#else
+	if(((hp|lp)==0)||			/* p = 0 */
+	  (hx>=0x7ff00000)||			/* x not finite */
+	  ((hp>=0x7ff00000)&&			/* p is NaN */
+	  (((hp-0x7ff00000)|lp)!=0)))
+	    return isnan(p) ? x*p : __math_invalid(x);
+#endif
 
 
 	if (hp<=0x7fdfffff) x = __ieee754_fmod(x,p+p);	/* now x < 2p */
@@ -18,9 +18,26 @@
  */
 
 #include "fdlibm.h"
+#if !__OBSOLETE_MATH
+#include "math_config.h"
+#endif
 
 #ifndef _DOUBLE_IS_32BITS
 
+#if __OBSOLETE_MATH
+#define scalb_check(x, z) (z)
+#else
+/* scalbn does not set errno, so check for overflow and underflow of
+   a finite non-zero x here.  */
+static inline double
+scalb_check (double x, double z)
+{
+	if (x == 0.0 || !isfinite (x))
+	    return z;
+	return check_uflow (check_oflow (z));
+}
+#endif
+
 #ifdef _SCALB_INT
 #ifdef __STDC__
 	double __ieee754_scalb(double x, int fn)
@@ -38,22 +55,31 @@
 #endif
 {
 #ifdef _SCALB_INT
-	return scalbn(x,fn);
+	return scalb_check(x, scalbn(x,fn));
 #else
 	if (isnan(x)||isnan(fn)) return x*fn;
 	if (!finite(fn)) {
+#if !__OBSOLETE_MATH
+	    /* 0 * inf or inf / inf.  */
+	    if (x == 0.0 ? fn > 0.0 : isinf(x) && fn < 0.0)
+		return __math_invalid(fn);
+#endif
 	    if(fn>0.0) return x*fn;
 	    else       return x/(-fn);
 	}
+#if __OBSOLETE_MATH
 	if (rint(fn)!=fn) return (fn-fn)/(fn-fn);
+#else
+	if (rint(fn)!=fn) return __math_invalid(fn);
+#endif
 #if INT_MAX == 32767
-	if ( fn > 65000.0) return scalbln(x, 65000);
-	if (-fn > 65000.0) return scalbln(x,-65000);
+	if ( fn > 65000.0) return scalb_check(x, scalbln(x, 65000));
+	if (-fn > 65000.0) return scalb_check(x, scalbln(x,-65000));
 #else
-	if ( fn > 65000.0) return scalbn(x, 65000);
-	if (-fn > 65000.0) return scalbn(x,-65000);
+	if ( fn > 65000.0) return scalb_check(x, scalbn(x, 65000));
+	if (-fn > 65000.0) return scalb_check(x, scalbn(x,-65000));
 #endif
-	return scalbn(x,(int)fn);
+	return scalb_check(x, scalbn(x,(int)fn));
 #endif
 }
 
@@ -15,6 +15,9 @@
  */
 
 #include "fdlibm.h"
+#if !__OBSOLETE_MATH
+#include "math_config.h"
+#endif
 
 #ifdef __STDC__
 static const float 
@@ -35,7 +38,11 @@ ln2	= 6.9314718246e-01;  /* 0x3f317218 */
 	__int32_t hx;
 	GET_FLOAT_WORD(hx,x);
 	if(hx<0x3f800000) {		/* x < 1 */
+#if __OBSOLETE_MATH
 	    return (x-x)/(x-x);
+#else
+	    return __math_invalidf(x);
+#endif
 	} else if(hx >=0x4d800000) {	/* x > 2**28 */
 	    if(!FLT_UWORD_IS_FINITE(hx)) {	/* x is inf of NaN */
 	        return x+x;
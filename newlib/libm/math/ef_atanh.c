@@ -15,6 +15,9 @@
  */
 
 #include "fdlibm.h"
+#if !__OBSOLETE_MATH
+#include "math_config.h"
+#endif
 
 #ifdef __STDC__
 static const float one = 1.0, huge = 1e30;
@@ -39,10 +42,17 @@ static float zero = 0.0;
 	__int32_t hx,ix;
 	GET_FLOAT_WORD(hx,x);
 	ix = hx&0x7fffffff;
+#if __OBSOLETE_MATH
 	if (ix>0x3f800000) 		/* |x|>1 */
 	    return (x-x)/(x-x);
 	if(ix==0x3f800000) 
 	    return x/zero;
+#else
+	if (ix>0x3f800000) 		/* |x|>1 */
+	    return __math_invalidf(x);
+	if(ix==0x3f800000) 
+	    return __math_divzerof((__uint32_t)hx>>31);
+#endif
 	if(ix<0x31800000&&(huge+x)>zero) return x;	/* x<2**-28 */
 	SET_FLOAT_WORD(x,ix);
 	if(ix<0x3f000000) {		/* x < 0.5 */
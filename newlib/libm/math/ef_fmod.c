@@ -20,6 +20,7 @@
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH
 
 #ifdef __STDC__
 static const float one = 1.0, Zero[] = {0.0, -0.0,};
@@ -111,3 +112,4 @@ static float one = 1.0, Zero[] = {0.0, -0.0,};
 	}
 	return x;		/* exact output */
 }
+#endif /* __OBSOLETE_MATH */
@@ -14,6 +14,7 @@
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH
 
 #ifdef __STDC__
 	float __ieee754_hypotf(float x, float y)
@@ -81,3 +82,4 @@
 	    return t1*w;
 	} else return w;
 }
+#endif /* __OBSOLETE_MATH */
@@ -14,6 +14,9 @@
  */
 
 #include "fdlibm.h"
+#if !__OBSOLETE_MATH
+#include "math_config.h"
+#endif
 
 #ifdef __STDC__
 static float pzerof(float), qzerof(float);
@@ -128,9 +131,15 @@ v04  =  4.4111031494e-10; /* 0x2ff280c2 */
 	GET_FLOAT_WORD(hx,x);
         ix = 0x7fffffff&hx;
     /* Y0(NaN) is NaN, y0(-inf) is Nan, y0(inf) is 0  */
+#if __OBSOLETE_MATH
 	if(!FLT_UWORD_IS_FINITE(ix)) return  one/(x+x*x); 
         if(FLT_UWORD_IS_ZERO(ix)) return -one/zero;
         if(hx<0) return zero/zero;
+#else
+        if(FLT_UWORD_IS_ZERO(ix)) return __math_divzerof(1);
+        if(hx<0) return __math_invalidf(x);
+	if(!FLT_UWORD_IS_FINITE(ix)) return  one/(x+x*x); 
+#endif
         if(ix >= 0x40000000) {  /* |x| >= 2.0 */
         /* y0(x) = sqrt(2/(pi*x))*(p0(x)*sin(x0)+q0(x)*cos(x0))
          * where x0 = x-pi/4
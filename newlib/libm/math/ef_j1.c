@@ -14,6 +14,9 @@
  */
 
 #include "fdlibm.h"
+#if !__OBSOLETE_MATH
+#include "math_config.h"
+#endif
 
 #ifdef __STDC__
 static float ponef(float), qonef(float);
@@ -129,9 +132,15 @@ static float V0[5] = {
 	GET_FLOAT_WORD(hx,x);
         ix = 0x7fffffff&hx;
     /* if Y1(NaN) is NaN, Y1(-inf) is NaN, Y1(inf) is 0 */
+#if __OBSOLETE_MATH
 	if(!FLT_UWORD_IS_FINITE(ix)) return one/(x+x*x); 
         if(FLT_UWORD_IS_ZERO(ix)) return -one/zero;
         if(hx<0) return zero/zero;
+#else
+        if(FLT_UWORD_IS_ZERO(ix)) return __math_divzerof(1);
+        if(hx<0) return __math_invalidf(x);
+	if(!FLT_UWORD_IS_FINITE(ix)) return one/(x+x*x); 
+#endif
         if(ix >= 0x40000000) {  /* |x| >= 2.0 */
                 s = sinf(x);
                 c = cosf(x);
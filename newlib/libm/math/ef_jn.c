@@ -14,6 +14,9 @@
  */
 
 #include "fdlibm.h"
+#if !__OBSOLETE_MATH
+#include "math_config.h"
+#endif
 
 #ifdef __STDC__
 static const float
@@ -181,8 +184,13 @@ static float zero  =  0.0000000000e+00;
 	ix = 0x7fffffff&hx;
     /* if Y(n,NaN) is NaN */
 	if(FLT_UWORD_IS_NAN(ix)) return x+x;
+#if __OBSOLETE_MATH
 	if(FLT_UWORD_IS_ZERO(ix)) return -one/zero;
 	if(hx<0) return zero/zero;
+#else
+	if(FLT_UWORD_IS_ZERO(ix)) return __math_divzerof(1);
+	if(hx<0) return __math_invalidf(x);
+#endif
 	sign = 1;
 	if(n<0){
 		n = -n;
@@ -14,6 +14,9 @@
  */
 
 #include "fdlibm.h"
+#if !__OBSOLETE_MATH
+#include "math_config.h"
+#endif
 
 #ifdef __STDC__
 static const float
@@ -25,11 +28,13 @@ ivln10     =  4.3429449201e-01, /* 0x3ede5bd9 */
 log10_2hi  =  3.0102920532e-01, /* 0x3e9a2080 */
 log10_2lo  =  7.9034151668e-07; /* 0x355427db */
 
+#if __OBSOLETE_MATH
 #ifdef __STDC__
 static const float zero   =  0.0;
 #else
 static float zero   =  0.0;
 #endif
+#endif
 
 #ifdef __STDC__
 	float __ieee754_log10f(float x)
@@ -44,9 +49,15 @@ static float zero   =  0.0;
 	GET_FLOAT_WORD(hx,x);
 
         k=0;
+#if __OBSOLETE_MATH
         if (FLT_UWORD_IS_ZERO(hx&0x7fffffff))
             return -two25/zero;             /* log(+-0)=-inf */
         if (hx<0) return (x-x)/zero;        /* log(-#) = NaN */
+#else
+        if (FLT_UWORD_IS_ZERO(hx&0x7fffffff))
+            return __math_divzerof(1);      /* log(+-0)=-inf */
+        if (hx<0) return __math_invalidf(x); /* log(-#) = NaN */
+#endif
 	if (!FLT_UWORD_IS_FINITE(hx)) return x+x;
         if (FLT_UWORD_IS_SUBNORMAL(hx)) {
             k -= 25; x *= two25; /* subnormal number, scale up x */
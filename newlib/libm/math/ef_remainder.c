@@ -14,6 +14,9 @@
  */
 
 #include "fdlibm.h"
+#if !__OBSOLETE_MATH
+#include "math_config.h"
+#endif
 
 #ifdef __STDC__
 static const float zero = 0.0;
@@ -43,7 +46,11 @@ static float zero = 0.0;
 	if(FLT_UWORD_IS_ZERO(hp)||
 	   !FLT_UWORD_IS_FINITE(hx)||
 	   FLT_UWORD_IS_NAN(hp))
+#if __OBSOLETE_MATH
 	    return (x*p)/(x*p);
+#else
+	    return isnan(p) ? x*p : __math_invalidf(x);
+#endif
 
 
 	if (hp<=FLT_UWORD_HALF_MAX) x = __ieee754_fmodf(x,p+p); /* now x < 2p */
@@ -15,6 +15,23 @@
 
 #include "fdlibm.h"
 #include <limits.h>
+#if !__OBSOLETE_MATH
+#include "math_config.h"
+#endif
+
+#if __OBSOLETE_MATH
+#define scalbf_check(x, z) (z)
+#else
+/* scalbnf does not set errno, so check for overflow and underflow of
+   a finite non-zero x here.  */
+static inline float
+scalbf_check (float x, float z)
+{
+	if (x == 0.0f || !isfinite (x))
+	    return z;
+	return check_uflow (check_oflow (z));
+}
+#endif
 
 #ifdef _SCALB_INT
 #ifdef __STDC__
@@ -33,21 +50,30 @@
 #endif
 {
 #ifdef _SCALB_INT
-	return scalbnf(x,fn);
+	return scalbf_check(x, scalbnf(x,fn));
 #else
 	if (isnan(x)||isnan(fn)) return x*fn;
 	if (!finitef(fn)) {
+#if !__OBSOLETE_MATH
+	    /* 0 * inf or inf / inf.  */
+	    if (x == (float)0.0 ? fn > (float)0.0 : isinf(x) && fn < (float)0.0)
+		return __math_invalidf(fn);
+#endif
 	    if(fn>(float)0.0) return x*fn;
 	    else       return x/(-fn);
 	}
+#if __OBSOLETE_MATH
 	if (rintf(fn)!=fn) return (fn-fn)/(fn-fn);
+#else
+	if (rintf(fn)!=fn) return __math_invalidf(fn);
+#endif
 #if INT_MAX > 65000
-	if ( fn > (float)65000.0) return scalbnf(x, 65000);
-	if (-fn > (float)65000.0) return scalbnf(x,-65000);
+	if ( fn > (float)65000.0) return scalbf_check(x, scalbnf(x, 65000));
+	if (-fn > (float)65000.0) return scalbf_check(x, scalbnf(x,-65000));
 #else
-	if ( fn > (float)32000.0) return scalbnf(x, 32000);
-	if (-fn > (float)32000.0) return scalbnf(x,-32000);
+	if ( fn > (float)32000.0) return scalbf_check(x, scalbnf(x, 32000));
+	if (-fn > (float)32000.0) return scalbf_check(x, scalbnf(x,-32000));
 #endif
-	return scalbnf(x,(int)fn);
+	return scalbf_check(x, scalbnf(x,(int)fn));
 #endif
 }
@@ -15,6 +15,7 @@
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH
 
 #ifdef __STDC__
 static const float atanhi[] = {
@@ -127,3 +128,4 @@ huge   = 1.0e30;
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
+#endif /* __OBSOLETE_MATH */
@@ -14,6 +14,7 @@
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH
 
 #ifdef __v810__
 #define const
@@ -244,3 +245,4 @@ sb7  = -2.2440952301e+01; /* 0xc1b38712 */
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
+#endif /* __OBSOLETE_MATH */
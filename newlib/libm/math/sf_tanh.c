@@ -14,6 +14,7 @@
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH
 
 #ifdef __STDC__
 static const float one=1.0, two=2.0, tiny = 1.0e-30;
@@ -71,3 +72,4 @@ static float one=1.0, two=2.0, tiny = 1.0e-30;
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
+#endif /* __OBSOLETE_MATH */
@@ -51,7 +51,8 @@ RETURNS
 	@tex
 	$|x|$
 	@end tex
-	is 1, the global <<errno>> is set to <<EDOM>>; and the result is 
+	is 1, the global <<errno>> is set to <<ERANGE>> (<<EDOM>> if the
+	library was built with __OBSOLETE_MATH); and the result is 
 	infinity with the same sign as <<x>>.  A <<SING error>> is reported.
 
 PORTABILITY
@@ -69,6 +70,7 @@ QUICKREF
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH
 #include <errno.h>
 
 #ifndef _DOUBLE_IS_32BITS
@@ -103,6 +105,7 @@ QUICKREF
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
+#endif /* __OBSOLETE_MATH */
 
 
 
@@ -136,6 +136,7 @@ in terms of the base return values, although the <[signgam]> global for
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH
 #include <reent.h>
 #include <errno.h>
 
@@ -169,3 +170,4 @@ in terms of the base return values, although the <[signgam]> global for
 }             
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
+#endif /* __OBSOLETE_MATH */
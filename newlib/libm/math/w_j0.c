@@ -90,6 +90,7 @@ None of the Bessel functions are in ANSI C.
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH
 #include <errno.h>
 
 #ifndef _DOUBLE_IS_32BITS
@@ -143,6 +144,7 @@ None of the Bessel functions are in ANSI C.
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
+#endif /* __OBSOLETE_MATH */
 
 
 
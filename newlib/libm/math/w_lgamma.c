@@ -19,6 +19,7 @@
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH
 #include <reent.h>
 #include <errno.h>
 
@@ -58,3 +59,4 @@
 
 
 
+#endif /* __OBSOLETE_MATH */
@@ -2,6 +2,8 @@
    sin and cos. */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH
+
 #include <errno.h>
 
 #ifndef _DOUBLE_IS_32BITS
@@ -20,3 +22,4 @@
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
+#endif /* __OBSOLETE_MATH */
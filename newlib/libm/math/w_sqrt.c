@@ -43,6 +43,9 @@ PORTABILITY
  */
 
 #include "fdlibm.h"
+#if !__OBSOLETE_MATH
+#include "math_config.h"
+#endif
 #include <errno.h>
 
 #ifndef _DOUBLE_IS_32BITS
@@ -54,7 +57,11 @@ PORTABILITY
 	double x;
 #endif
 {
-#ifdef _IEEE_LIBM
+#if !__OBSOLETE_MATH
+	/* Checking the argument first leaves a tail call.  */
+	if(x<0.0) return __math_invalid(x);
+	return __ieee754_sqrt(x);
+#elif defined(_IEEE_LIBM)
 	return __ieee754_sqrt(x);
 #else
 	double z;
@@ -15,6 +15,7 @@
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH
 #include <reent.h>
 #include <errno.h>
 
@@ -58,3 +59,4 @@
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
+#endif /* __OBSOLETE_MATH */
@@ -18,6 +18,9 @@
  */
 
 #include "fdlibm.h"
+#if !__OBSOLETE_MATH
+#include "math_config.h"
+#endif
 #include <errno.h>
 
 #ifdef __STDC__
@@ -27,7 +30,11 @@
 	float x;
 #endif
 {
-#ifdef _IEEE_LIBM
+#if !__OBSOLETE_MATH
+	/* Checking the argument first leaves a tail call.  */
+	if(x<0.0f) return __math_invalidf(x);
+	return __ieee754_sqrtf(x);
+#elif defined(_IEEE_LIBM)
 	return __ieee754_sqrtf(x);
 #else
 	float z;
@@ -15,6 +15,7 @@
 
 #include "math.h"
 #include "fdlibm.h"
+#if __OBSOLETE_MATH
 
 #ifdef __STDC__
 	float tgammaf(float x)
@@ -57,3 +58,4 @@
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
+#endif /* __OBSOLETE_MATH */
@@ -18,6 +18,7 @@
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH
 #include <errno.h>
 
 #ifdef __STDC__
@@ -46,3 +47,4 @@
             return y;
 #endif
 }             
+#endif /* __OBSOLETE_MATH */
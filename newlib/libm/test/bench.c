@@ -0,0 +1,617 @@
+/* Throughput, latency and accuracy benchmark for libm.
+
+   For each function and input range this measures the latency of
+   dependent calls and the reciprocal throughput of independent calls,
+   and the maximum and mean error in ULP against the double-double
+   reference functions of bench_ref.c.  Results are printed one line per
+   function and range in CSV format, so that runs can be compared by a
+   script to catch per-function regressions:
+
+     function,lo,hi,lo2,hi2,latency_ns,throughput_ns,max_ulp,mean_ulp,
+     worst_x,worst_y,skipped
+
+   Options:
+     -f NAME	only run functions named NAME (may be repeated)
+     -r LO HI	use [LO, HI] instead of the default ranges
+     -r2 LO HI	second argument range of two-argument functions
+     -l		choose the first argument uniformly in log scale, for
+		0 < LO < HI
+     -n N	number of random inputs for the accuracy sweep
+     -t		only measure time
+     -a		only measure accuracy
+     -e		instead time the rounding mode and environment functions
+		of fenv.h, printing function,ns_per_call lines
+     -c		instead time long double conversions by strtold and
+		printf, in the same format
+     -x		instead time regexec with and without its DFA, printing
+		pattern,dfa_ns_per_byte,nfa_ns_per_byte lines  */
+
+#define _GNU_SOURCE
+#include "bench.h"
+#include <float.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fenv.h>
+#include <sys/types.h>
+#include <regex.h>
+
+#define NBENCH 4096
+#define NREPEAT 5
+#define FENV_LOOPS 1000000
+#define NCONV 1000
+#define CONV_LOOPS 20
+#define REGEX_LEN 65536
+
+/* Significant digits which tell all long doubles apart.  */
+#define ROUND_TRIP_DIG (LDBL_DIG + 3)
+
+/* Always 0, but the compiler cannot know that, so it can be used to make
+   an input depend on the previous result.  */
+volatile uint64_t bench_dep = 0;
+
+enum { D1, D2, F1, F2 };
+
+/* LOG selects log scale for the first argument.  */
+typedef struct
+{
+  double lo, hi, lo2, hi2;
+  int log;
+} range_type;
+
+#define LOG(lo, hi) {lo, hi, 0, 0, 1}
+
+typedef struct
+{
+  const char *name;
+  int kind;
+  double (*d1) (double);
+  double (*d2) (double, double);
+  float (*f1) (float);
+  float (*f2) (float, float);
+  dd_t (*ref1) (double);
+  dd_t (*ref2) (double, double);
+  range_type ranges[4];
+} bench_func_type;
+
+#define FD1(fn, ...) {#fn, D1, fn, 0, 0, 0, ref_##fn, 0, {__VA_ARGS__}}
+#define FD2(fn, ...) {#fn, D2, 0, fn, 0, 0, 0, ref_##fn, {__VA_ARGS__}}
+#define FF1(fn, ...) {#fn "f", F1, 0, 0, fn##f, 0, ref_##fn, 0, {__VA_ARGS__}}
+#define FF2(fn, ...) {#fn "f", F2, 0, 0, 0, fn##f, 0, ref_##fn, {__VA_ARGS__}}
+
+static const bench_func_type funcs[] =
+{
+  FD1 (exp, {-10, 10}, {-700, 700}),
+  FD1 (exp2, {-10, 10}, {-1000, 1000}),
+  FD1 (exp10, {-10, 10}, {-300, 300}),
+  FD1 (expm1, {-1, 1}, {-40, 700}),
+  FD1 (log, {0.5, 2}, LOG (1e-300, 1e300)),
+  FD1 (log2, {0.5, 2}, LOG (1e-300, 1e300)),
+  FD1 (log10, {0.5, 2}, LOG (1e-300, 1e300)),
+  FD1 (log1p, {-0.5, 1}, {-0.9, 1e10}),
+  FD2 (pow, {0.5, 2, -10, 10}, {1e-10, 1e10, -30, 30, 1}),
+  FD1 (sin, {-0.78, 0.78}, {-10, 10}, {-1e6, 1e6}),
+  FD1 (cos, {-0.78, 0.78}, {-10, 10}, {-1e6, 1e6}),
+  FD1 (tan, {-0.78, 0.78}, {-10, 10}, {-1e6, 1e6}),
+  FD1 (asin, {-0.5, 0.5}, {-1, 1}),
+  FD1 (acos, {-0.5, 0.5}, {-1, 1}),
+  FD1 (atan, {-1, 1}, {-100, 100}),
+  FD2 (atan2, {-10, 10, -10, 10}, {-1e6, 1e6, -1, 1}),
+  FD1 (sinh, {-1, 1}, {-30, 30}, {-700, 700}),
+  FD1 (cosh, {-1, 1}, {-30, 30}, {-700, 700}),
+  FD1 (tanh, {-1, 1}, {-10, 10}),
+  FD1 (asinh, {-1, 1}, {-1e6, 1e6}),
+  FD1 (acosh, {1, 2}, {1, 1e6}),
+  FD1 (atanh, {-0.5, 0.5}, {-1, 1}),
+  FD1 (sqrt, {0, 1e6}),
+  FD1 (cbrt, {-1e6, 1e6}),
+  FD1 (tgamma, {1, 10}, {-170, 170}),
+  FD1 (lgamma, {0.5, 10}, {-100, 100}, LOG (20, 1e300)),
+  FD1 (erf, {-1, 1}, {-6, 6}),
+  FD1 (erfc, {-1, 1}, {-6, 26}),
+  FD2 (hypot, {-10, 10, -10, 10}, {-1e300, 1e300, -1e300, 1e300}),
+  FD2 (fmod, {-10, 10, -10, 10}, {-1e300, 1e300, -1, 1}),
+  FD2 (remainder, {-10, 10, -10, 10}, {-1e300, 1e300, -1, 1}),
+  FF1 (exp, {-10, 10}, {-87, 88}),
+  FF1 (exp2, {-10, 10}, {-126, 127}),
+  FF1 (exp10, {-10, 10}, {-37, 38}),
+  FF1 (expm1, {-1, 1}, {-20, 88}),
+  FF1 (log, {0.5, 2}, LOG (1e-30, 1e30)),
+  FF1 (log2, {0.5, 2}, LOG (1e-30, 1e30)),
+  FF1 (log10, {0.5, 2}, LOG (1e-30, 1e30)),
+  FF1 (log1p, {-0.5, 1}, {-0.9, 1e10}),
+  FF2 (pow, {0.5, 2, -10, 10}, {1e-3, 1e3, -10, 10, 1}),
+  FF1 (sin, {-0.78, 0.78}, {-10, 10}, {-1e6, 1e6}),
+  FF1 (cos, {-0.78, 0.78}, {-10, 10}, {-1e6, 1e6}),
+  FF1 (tan, {-0.78, 0.78}, {-10, 10}, {-1e6, 1e6}),
+  FF1 (asin, {-0.5, 0.5}, {-1, 1}),
+  FF1 (acos, {-0.5, 0.5}, {-1, 1}),
+  FF1 (atan, {-1, 1}, {-100, 100}),
+  FF2 (atan2, {-10, 10, -10, 10}, {-1e6, 1e6, -1, 1}),
+  FF1 (sinh, {-1, 1}, {-30, 30}, {-88, 88}),
+  FF1 (cosh, {-1, 1}, {-30, 30}, {-88, 88}),
+  FF1 (tanh, {-1, 1}, {-10, 10}),
+  FF1 (asinh, {-1, 1}, {-1e6, 1e6}),
+  FF1 (acosh, {1, 2}, {1, 1e6}),
+  FF1 (atanh, {-0.5, 0.5}, {-1, 1}),
+  FF1 (sqrt, {0, 1e6}),
+  FF1 (cbrt, {-1e6, 1e6}),
+  FF1 (tgamma, {1, 10}, {-40, 35}),
+  FF1 (lgamma, {0.5, 10}, {-30, 30}, LOG (20, 1e36)),
+  FF1 (erf, {-1, 1}, {-4, 4}),
+  FF1 (erfc, {-1, 1}, {-4, 10}),
+  FF2 (hypot, {-10, 10, -10, 10}, {-1e30, 1e30, -1e30, 1e30}),
+  FF2 (fmod, {-10, 10, -10, 10}, {-1e30, 1e30, -1, 1}),
+  FF2 (remainder, {-10, 10, -10, 10}, {-1e30, 1e30, -1, 1}),
+};
+
+static uint64_t
+asuint64 (double x)
+{
+  uint64_t u;
+
+  memcpy (&u, &x, sizeof (x));
+  return u;
+}
+
+static double
+asdouble (uint64_t u)
+{
+  double x;
+
+  memcpy (&x, &u, sizeof (x));
+  return x;
+}
+
+static uint64_t seed = 1;
+
+static uint64_t
+rand64 (void)
+{
+  seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+  return seed;
+}
+
+/* Uniform in [LO, HI], or in log scale with LOGSCALE, where only the
+   exponent is chosen that way, so that the inputs are not close to
+   results of exp.  */
+static double
+rand_in (double lo, double hi, int logscale)
+{
+  double u = (rand64 () >> 11) * 0x1p-53;
+
+  if (logscale)
+    {
+      u = exp (log (lo) + (log (hi) - log (lo)) * u);
+      return asdouble ((asuint64 (u) & 0xfff0000000000000ULL)
+		       | (rand64 () >> 12));
+    }
+  return lo + (hi - lo) * u;
+}
+
+/* Zero, computed from PREV.  */
+static float
+depend (float prev, uint64_t dep)
+{
+  return asdouble (asuint64 (prev) & dep);
+}
+
+/* Time N calls of F over X (and Y), LOOPS times, in clock ticks.  Calls
+   are independent unless LATENCY is set, in which case each argument
+   depends on the previous result.  This adds the latency of a few integer
+   operations to each call.  */
+static clock_t
+time_calls (const bench_func_type *f, const double *x, const double *y,
+	    int n, long loops, int latency)
+{
+  static double out[NBENCH];
+  static float xf[NBENCH], yf[NBENCH], outf[NBENCH];
+  uint64_t dep = bench_dep;
+  double prev = 0;
+  float prevf = 0;
+  clock_t t;
+  long j;
+  int i;
+
+  for (i = 0; i < n; i++)
+    {
+      xf[i] = x[i];
+      yf[i] = y[i];
+    }
+  t = clock ();
+  for (j = 0; j < loops; j++)
+    switch (f->kind)
+      {
+      case D1:
+	if (latency)
+	  for (i = 0; i < n; i++)
+	    prev = f->d1 (asdouble (asuint64 (x[i])
+				    ^ (asuint64 (prev) & dep)));
+	else
+	  for (i = 0; i < n; i++)
+	    out[i] = f->d1 (x[i]);
+	break;
+      case D2:
+	if (latency)
+	  for (i = 0; i < n; i++)
+	    prev = f->d2 (asdouble (asuint64 (x[i])
+				    ^ (asuint64 (prev) & dep)), y[i]);
+	else
+	  for (i = 0; i < n; i++)
+	    out[i] = f->d2 (x[i], y[i]);
+	break;
+      case F1:
+	if (latency)
+	  for (i = 0; i < n; i++)
+	    prevf = f->f1 (xf[i] + depend (prevf, dep));
+	else
+	  for (i = 0; i < n; i++)
+	    outf[i] = f->f1 (xf[i]);
+	break;
+      default:
+	if (latency)
+	  for (i = 0; i < n; i++)
+	    prevf = f->f2 (xf[i] + depend (prevf, dep), yf[i]);
+	else
+	  for (i = 0; i < n; i++)
+	    outf[i] = f->f2 (xf[i], yf[i]);
+	break;
+      }
+  return clock () - t;
+}
+
+/* Nanoseconds per call, the minimum of NREPEAT runs of at least 50 ms.  */
+static double
+ns_per_call (const bench_func_type *f, const double *x, const double *y,
+	     int n, int latency)
+{
+  long loops = 1;
+  clock_t t, best;
+  int r;
+
+  while (time_calls (f, x, y, n, loops, latency) < CLOCKS_PER_SEC / 20
+	 && loops < (1L << 24))
+    loops *= 2;
+  best = time_calls (f, x, y, n, loops, latency);
+  for (r = 1; r < NREPEAT; r++)
+    {
+      t = time_calls (f, x, y, n, loops, latency);
+      if (t < best)
+	best = t;
+    }
+  return (double) best / CLOCKS_PER_SEC * 1e9 / ((double) loops * n);
+}
+
+/* Error of GOT in ULP of the correctly rounded result, for a format with
+   PREC bits and minimum normal exponent EMIN, or -1 if REF is not
+   available.  */
+static double
+ulp_error (double got, dd_t ref, int prec, int emin)
+{
+  int e;
+
+  if (isnan (ref.hi))
+    return isnan (got) ? 0.0 : -1.0;
+  if (isnan (got))
+    return INFINITY;
+  if (isinf (ref.hi) || isinf (got))
+    return got == ref.hi ? 0.0 : INFINITY;
+  if (ref.hi == 0.0)
+    return got == 0.0 ? 0.0 : INFINITY;
+  frexp (ref.hi, &e);
+  if (e < emin)
+    e = emin;
+  return fabs (ldexp ((got - ref.hi) - ref.lo, prec - e));
+}
+
+static void
+run (const bench_func_type *f, const range_type *r, long ntest, int timing,
+     int accuracy)
+{
+  static double x[NBENCH], y[NBENCH];
+  double lat = 0, thru = 0, maxerr = 0, sumerr = 0, err, wx = 0, wy = 0;
+  double got, a, b;
+  long i, n = 0, skipped = 0;
+  int two = f->kind == D2 || f->kind == F2;
+  int flt = f->kind == F1 || f->kind == F2;
+  dd_t ref;
+
+  if (timing)
+    {
+      for (i = 0; i < NBENCH; i++)
+	{
+	  x[i] = rand_in (r->lo, r->hi, r->log);
+	  y[i] = two ? rand_in (r->lo2, r->hi2, 0) : 0.0;
+	  if (flt)
+	    {
+	      x[i] = (float) x[i];
+	      y[i] = (float) y[i];
+	    }
+	}
+      lat = ns_per_call (f, x, y, NBENCH, 1);
+      thru = ns_per_call (f, x, y, NBENCH, 0);
+    }
+  if (accuracy)
+    for (i = 0; i < ntest; i++)
+      {
+	a = rand_in (r->lo, r->hi, r->log);
+	b = two ? rand_in (r->lo2, r->hi2, 0) : 0.0;
+	if (flt)
+	  {
+	    a = (float) a;
+	    b = (float) b;
+	  }
+	switch (f->kind)
+	  {
+	  case D1:
+	    got = f->d1 (a);
+	    break;
+	  case D2:
+	    got = f->d2 (a, b);
+	    break;
+	  case F1:
+	    got = f->f1 (a);
+	    break;
+	  default:
+	    got = f->f2 (a, b);
+	    break;
+	  }
+	ref = two ? f->ref2 (a, b) : f->ref1 (a);
+	err = flt ? ulp_error (got, ref, 24, -125)
+		  : ulp_error (got, ref, 53, -1021);
+	if (err < 0)
+	  {
+	    skipped++;
+	    continue;
+	  }
+	if (err > maxerr || n == 0)
+	  {
+	    maxerr = err;
+	    wx = a;
+	    wy = b;
+	  }
+	sumerr += err;
+	n++;
+      }
+  printf ("%s,%g,%g,%g,%g,%.3f,%.3f,%.4f,%.4f,%a,%a,%ld\n", f->name,
+	  r->lo, r->hi, two ? r->lo2 : 0.0, two ? r->hi2 : 0.0, lat, thru,
+	  maxerr, n ? sumerr / n : 0.0, wx, wy, skipped);
+}
+
+/* Nanoseconds per iteration of BODY, the minimum of NREPEAT runs of
+   FENV_LOOPS iterations.  */
+static void
+bench_fenv (void)
+{
+  static volatile double one = 1.0, three = 3.0;
+  volatile double sink;
+  fenv_t env;
+  clock_t t, best = 0;
+  long j;
+  int r;
+
+#define TIME_FENV(name, body)						\
+  for (r = 0; r < NREPEAT; r++)						\
+    {									\
+      t = clock ();							\
+      for (j = 0; j < FENV_LOOPS; j++)					\
+	body;								\
+      t = clock () - t;							\
+      if (r == 0 || t < best)						\
+	best = t;							\
+    }									\
+  printf ("%s,%.3f\n", name, (double) best / CLOCKS_PER_SEC * 1e9 / FENV_LOOPS)
+
+  printf ("function,ns_per_call\n");
+  TIME_FENV ("fegetround", sink = fegetround ());
+#ifdef FE_TONEAREST
+  TIME_FENV ("fesetround same", fesetround (FE_TONEAREST));
+#ifdef FE_UPWARD
+  if (fesetround (FE_UPWARD) == 0)
+    {
+      TIME_FENV ("fesetround toggle",
+		 fesetround (j & 1 ? FE_UPWARD : FE_TONEAREST));
+      TIME_FENV ("fesetround toggle + div",
+		 { fesetround (j & 1 ? FE_UPWARD : FE_TONEAREST);
+		   sink = one / three; });
+    }
+  fesetround (FE_TONEAREST);
+#endif
+#endif
+  TIME_FENV ("feholdexcept/feupdateenv",
+	     { feholdexcept (&env); sink = one / three; feupdateenv (&env); });
+#undef TIME_FENV
+}
+
+/* Nanoseconds per conversion of NCONV strings, half of them with 10 and
+   half with ROUND_TRIP_DIG digits, the minimum of NREPEAT runs of
+   CONV_LOOPS passes.  printf of long double needs _WANT_IO_LONG_DOUBLE.  */
+static void
+bench_conv (void)
+{
+  static char text[NCONV][64];
+  volatile long double sink;
+  long double x;
+  clock_t t, best = 0;
+  int i, j, r;
+
+#define TIME_CONV(name, body)						\
+  for (r = 0; r < NREPEAT; r++)						\
+    {									\
+      t = clock ();							\
+      for (j = 0; j < CONV_LOOPS; j++)					\
+	for (i = 0; i < NCONV; i++)					\
+	  body;								\
+      t = clock () - t;							\
+      if (r == 0 || t < best)						\
+	best = t;							\
+    }									\
+  printf ("%s,%.3f\n", name,						\
+	  (double) best / CLOCKS_PER_SEC * 1e9 / ((double) CONV_LOOPS * NCONV))
+
+  for (i = 0; i < NCONV; i++)
+    {
+      /* Fill the bits of long double below those of double.  */
+      x = rand_in (i & 2 ? 1e-30 : 1e-300, i & 2 ? 1e30 : 1e300, 1);
+      x *= 1 + (long double) (rand64 () >> 11) * 0x1p-64L;
+      snprintf (text[i], sizeof (text[i]), "%.*Lg",
+		i & 1 ? ROUND_TRIP_DIG : 10, x);
+    }
+
+  printf ("function,ns_per_call\n");
+  TIME_CONV ("strtold", sink = strtold (text[i], NULL));
+#ifdef _WANT_IO_LONG_DOUBLE
+  TIME_CONV ("strtold + printf %Lg",
+	     { x = strtold (text[i], NULL);
+	       snprintf (text[i], sizeof (text[i]), "%.*Lg",
+			 ROUND_TRIP_DIG, x); });
+  TIME_CONV ("printf %.6Lf",
+	     snprintf (text[i], sizeof (text[i]), "%.6Lf",
+		       (long double) i / 7 + j));
+#endif
+#undef TIME_CONV
+}
+
+/* Nanoseconds per byte of regexec over a random string, the minimum of
+   NREPEAT runs, with the DFA and with the NFA simulation (REG_NODFA).  */
+static double
+regex_ns_per_byte (const regex_t *re, const char *text, int eflags)
+{
+  clock_t t, best = 0;
+  int r;
+
+  for (r = 0; r < NREPEAT; r++)
+    {
+      t = clock ();
+      regexec (re, text, 0, NULL, eflags);
+      t = clock () - t;
+      if (r == 0 || t < best)
+	best = t;
+    }
+  return (double) best / CLOCKS_PER_SEC * 1e9 / REGEX_LEN;
+}
+
+static void
+bench_regex (void)
+{
+  static const struct
+  {
+    const char *what, *re;
+  } pats[] =
+  {
+    {"literal", "needle"},
+    {"alternation", "(error|warn|fatal|panic):[0-9]+x"},
+    {"classes", "[[:digit:]]{3}[a-c]{4}[[:space:]]"},
+  };
+  static const char alpha[] = "abcdefghij klmnopqrstuvwxyz0123456789:";
+  static char text[REGEX_LEN + 1];
+  regex_t re;
+  unsigned int i;
+
+  for (i = 0; i < REGEX_LEN; i++)
+    text[i] = alpha[rand64 () % (sizeof (alpha) - 1)];
+  printf ("pattern,dfa_ns_per_byte,nfa_ns_per_byte\n");
+  for (i = 0; i < sizeof (pats) / sizeof (pats[0]); i++)
+    {
+      if (regcomp (&re, pats[i].re, REG_EXTENDED | REG_NOSUB) != 0)
+	continue;
+#ifdef REG_NODFA
+      printf ("%s,%.3f,%.3f\n", pats[i].what,
+	      regex_ns_per_byte (&re, text, 0),
+	      regex_ns_per_byte (&re, text, REG_NODFA));
+#else
+      printf ("%s,%.3f,\n", pats[i].what, regex_ns_per_byte (&re, text, 0));
+#endif
+      regfree (&re);
+    }
+}
+
+static void
+usage (void)
+{
+  fprintf (stderr, "usage: bench [-f NAME]... [-r LO HI] [-r2 LO HI] [-l] "
+	   "[-n N] [-t | -a]\n       bench -e | -c | -x\n");
+  exit (1);
+}
+
+int
+main (int argc, char **argv)
+{
+  const char *names[64];
+  int nnames = 0, timing = 1, accuracy = 1, userrange = 0, range2 = 0;
+  long ntest = 100000;
+  range_type ur = {0, 0, 0, 0, 0};
+  unsigned int k, i;
+  int a;
+
+  for (a = 1; a < argc; a++)
+    {
+      if (strcmp (argv[a], "-f") == 0 && a + 1 < argc && nnames < 64)
+	names[nnames++] = argv[++a];
+      else if (strcmp (argv[a], "-r") == 0 && a + 2 < argc)
+	{
+	  ur.lo = strtod (argv[++a], NULL);
+	  ur.hi = strtod (argv[++a], NULL);
+	  userrange = 1;
+	}
+      else if (strcmp (argv[a], "-r2") == 0 && a + 2 < argc)
+	{
+	  ur.lo2 = strtod (argv[++a], NULL);
+	  ur.hi2 = strtod (argv[++a], NULL);
+	  range2 = 1;
+	}
+      else if (strcmp (argv[a], "-l") == 0)
+	ur.log = 1;
+      else if (strcmp (argv[a], "-n") == 0 && a + 1 < argc)
+	ntest = strtol (argv[++a], NULL, 0);
+      else if (strcmp (argv[a], "-t") == 0)
+	accuracy = 0;
+      else if (strcmp (argv[a], "-a") == 0)
+	timing = 0;
+      else if (strcmp (argv[a], "-e") == 0)
+	{
+	  bench_fenv ();
+	  return 0;
+	}
+      else if (strcmp (argv[a], "-c") == 0)
+	{
+	  bench_conv ();
+	  return 0;
+	}
+      else if (strcmp (argv[a], "-x") == 0)
+	{
+	  bench_regex ();
+	  return 0;
+	}
+      else
+	usage ();
+    }
+  if (!userrange || (ur.log && !(ur.lo > 0)))
+    ur.log = 0;
+  if (userrange && !range2)
+    {
+      ur.lo2 = ur.lo;
+      ur.hi2 = ur.hi;
+    }
+
+  printf ("function,lo,hi,lo2,hi2,latency_ns,throughput_ns,max_ulp,"
+	  "mean_ulp,worst_x,worst_y,skipped\n");
+  for (k = 0; k < sizeof (funcs) / sizeof (funcs[0]); k++)
+    {
+      const bench_func_type *f = &funcs[k];
+
+      for (i = 0; i < (unsigned int) nnames; i++)
+	if (strcmp (names[i], f->name) == 0)
+	  break;
+      if (nnames && i == (unsigned int) nnames)
+	continue;
+      if (userrange)
+	run (f, &ur, ntest, timing, accuracy);
+      else
+	for (i = 0; i < 4 && f->ranges[i].lo < f->ranges[i].hi; i++)
+	  run (f, &f->ranges[i], ntest, timing, accuracy);
+    }
+  return 0;
+}
@@ -0,0 +1,45 @@
+/* Declarations shared by the libm benchmark and its reference functions.  */
+
+#include <math.h>
+
+/* An unevaluated sum HI + LO with |LO| <= ulp (HI) / 2, about 106 bits of
+   precision.  */
+typedef struct
+{
+  double hi, lo;
+} dd_t;
+
+/* Reference functions, accurate to 2^-85 relative error or better for the
+   default benchmark ranges.  Arguments outside the supported range give
+   a NaN HI part, and such inputs are left out of the ULP statistics.  */
+dd_t ref_exp (double);
+dd_t ref_exp2 (double);
+dd_t ref_exp10 (double);
+dd_t ref_expm1 (double);
+dd_t ref_log (double);
+dd_t ref_log2 (double);
+dd_t ref_log10 (double);
+dd_t ref_log1p (double);
+dd_t ref_pow (double, double);
+dd_t ref_sin (double);
+dd_t ref_cos (double);
+dd_t ref_tan (double);
+dd_t ref_asin (double);
+dd_t ref_acos (double);
+dd_t ref_atan (double);
+dd_t ref_atan2 (double, double);
+dd_t ref_sinh (double);
+dd_t ref_cosh (double);
+dd_t ref_tanh (double);
+dd_t ref_asinh (double);
+dd_t ref_acosh (double);
+dd_t ref_atanh (double);
+dd_t ref_sqrt (double);
+dd_t ref_cbrt (double);
+dd_t ref_hypot (double, double);
+dd_t ref_fmod (double, double);
+dd_t ref_remainder (double, double);
+dd_t ref_tgamma (double);
+dd_t ref_lgamma (double);
+dd_t ref_erf (double);
+dd_t ref_erfc (double);
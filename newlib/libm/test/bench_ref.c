@@ -0,0 +1,851 @@
+#include "bench.h"
+
+/* Reference functions for the libm benchmark in double-double arithmetic,
+   so that no multi-precision library is needed.  The basic operations
+   follow Dekker and the accurate double-double algorithms of Joldes,
+   Muller and Popescu, which are exact enough even under cancellation.
+   Elementary functions are built from a few kernels: expm1 by Taylor
+   series after halving the argument, sin and cos by Taylor series after
+   reduction by pi/2, and log and atan by Newton iteration on those.
+   This requires round-to-nearest double arithmetic without excess
+   precision.  */
+
+/* pi/2, ln2 and ln10 split into doubles.  */
+static const double pio2[5] = {
+  0x1.921fb54442d18p+0, 0x1.1a62633145c07p-54, -0x1.f1976b7ed8fbcp-110,
+  0x1.4cf98e804177dp-164, 0x1.31d89cd9128a5p-218,
+};
+static const double ln2[3] = {
+  0x1.62e42fefa39efp-1, 0x1.abc9e3b39803fp-56, 0x1.7b57a079a1934p-111,
+};
+static const double ln10[3] = {
+  0x1.26bb1bbb55516p+1, -0x1.f48ad494ea3e9p-53, -0x1.9ebae3ae0260cp-107,
+};
+
+/* 2 / sqrt (pi) and log (2 pi) / 2.  */
+static const double twoosqrtpi[2] = {
+  0x1.20dd750429b6dp+0, 0x1.1ae3a914fed8p-56,
+};
+static const double hlog2pi[2] = {
+  0x1.d67f1c864beb5p-1, -0x1.65b5a1b7ff5dfp-55,
+};
+
+/* Bernoulli numbers B2, B4, ..., B34 as numerator and denominator.  */
+static const double bernoulli[17][2] = {
+  {1, 6}, {-1, 30}, {1, 42}, {-1, 30}, {5, 66}, {-691, 2730}, {7, 6},
+  {-3617, 510}, {43867, 798}, {-174611, 330}, {854513, 138},
+  {-236364091, 2730}, {8553103, 6}, {-23749461029, 870},
+  {8615841276005, 14322}, {-7709321041217, 510}, {2577687858367, 6},
+};
+
+static const dd_t dd_nan = { NAN, NAN };
+
+static dd_t
+dd (double hi, double lo)
+{
+  dd_t r;
+
+  r.hi = hi;
+  r.lo = lo;
+  return r;
+}
+
+/* |a| >= |b| or a == 0.  */
+static dd_t
+fast_two_sum (double a, double b)
+{
+  double s = a + b;
+
+  return dd (s, b - (s - a));
+}
+
+static dd_t
+two_sum (double a, double b)
+{
+  double s = a + b;
+  double bb = s - a;
+
+  return dd (s, (a - (s - bb)) + (b - bb));
+}
+
+/* Exact product, for |a|, |b| below 2^995.  */
+static dd_t
+two_prod (double a, double b)
+{
+  double p = a * b;
+  double ca = 0x1.0000002p27 * a;
+  double cb = 0x1.0000002p27 * b;
+  double ah = ca - (ca - a), al = a - ah;
+  double bh = cb - (cb - b), bl = b - bh;
+
+  return dd (p, ((ah * bh - p) + ah * bl + al * bh) + al * bl);
+}
+
+static dd_t
+dd_add (dd_t a, dd_t b)
+{
+  dd_t s = two_sum (a.hi, b.hi);
+  dd_t t = two_sum (a.lo, b.lo);
+
+  s = fast_two_sum (s.hi, s.lo + t.hi);
+  return fast_two_sum (s.hi, s.lo + t.lo);
+}
+
+static dd_t
+dd_neg (dd_t a)
+{
+  return dd (-a.hi, -a.lo);
+}
+
+static dd_t
+dd_sub (dd_t a, dd_t b)
+{
+  return dd_add (a, dd_neg (b));
+}
+
+static dd_t
+dd_add_d (dd_t a, double b)
+{
+  dd_t s = two_sum (a.hi, b);
+
+  return fast_two_sum (s.hi, s.lo + a.lo);
+}
+
+static dd_t
+dd_mul (dd_t a, dd_t b)
+{
+  dd_t p = two_prod (a.hi, b.hi);
+
+  return fast_two_sum (p.hi, p.lo + (a.hi * b.lo + a.lo * b.hi));
+}
+
+static dd_t
+dd_mul_d (dd_t a, double b)
+{
+  dd_t p = two_prod (a.hi, b);
+
+  return fast_two_sum (p.hi, p.lo + a.lo * b);
+}
+
+static dd_t
+dd_div (dd_t a, dd_t b)
+{
+  double q1 = a.hi / b.hi;
+  dd_t r = dd_sub (a, dd_mul_d (b, q1));
+  double q2 = r.hi / b.hi;
+  double q3;
+
+  r = dd_sub (r, dd_mul_d (b, q2));
+  q3 = r.hi / b.hi;
+  return dd_add_d (fast_two_sum (q1, q2), q3);
+}
+
+static dd_t
+dd_div_d (dd_t a, double b)
+{
+  return dd_div (a, dd (b, 0.0));
+}
+
+static dd_t
+dd_ldexp (dd_t a, int e)
+{
+  /* In two steps, so an intermediate result does not overflow.  */
+  if (e > 1000 || e < -1000)
+    {
+      a = dd_ldexp (a, e / 2);
+      e -= e / 2;
+    }
+  return dd (ldexp (a.hi, e), ldexp (a.lo, e));
+}
+
+static dd_t
+dd_sqrt (dd_t a)
+{
+  double s;
+  dd_t r;
+
+  if (a.hi <= 0.0)
+    return dd (a.hi == 0.0 ? 0.0 : NAN, 0.0);
+  s = sqrt (a.hi);
+  r = dd_sub (a, two_prod (s, s));
+  return fast_two_sum (s, r.hi / (2.0 * s));
+}
+
+/* k * c for a constant split into N doubles, k an integer below 2^53.  */
+static dd_t
+dd_mul_const (double k, const double *c, int n)
+{
+  dd_t r = two_prod (k, c[0]);
+  int i;
+
+  for (i = 1; i < n; i++)
+    r = dd_add (r, two_prod (k, c[i]));
+  return r;
+}
+
+/* x - k * c, summed so that the cancellation is exact.  */
+static dd_t
+dd_reduce (dd_t x, double k, const double *c, int n)
+{
+  int i;
+
+  for (i = 0; i < n; i++)
+    x = dd_sub (x, two_prod (k, c[i]));
+  return x;
+}
+
+/* e^x - 1 for |x| <= 0.5.  */
+static dd_t
+expm1_kernel (dd_t x)
+{
+  dd_t r = dd_ldexp (x, -8), t = dd (1.0, 0.0);
+  int n;
+
+  for (n = 13; n >= 2; n--)
+    t = dd_add_d (dd_div_d (dd_mul (r, t), n), 1.0);
+  t = dd_mul (r, t);
+  /* e^(2r) - 1 = (e^r - 1) * (e^r + 1).  */
+  for (n = 0; n < 8; n++)
+    t = dd_mul (t, dd_add_d (t, 2.0));
+  return t;
+}
+
+static dd_t
+dd_exp (dd_t x)
+{
+  double k;
+
+  if (x.hi > 710.0)
+    return dd (INFINITY, 0.0);
+  if (x.hi < -746.0)
+    return dd (0.0, 0.0);
+  k = rint (x.hi / ln2[0]);
+  x = dd_add_d (expm1_kernel (dd_reduce (x, k, ln2, 3)), 1.0);
+  return dd_ldexp (x, k);
+}
+
+static dd_t
+dd_expm1 (dd_t x)
+{
+  if (fabs (x.hi) <= 0.5)
+    return expm1_kernel (x);
+  return dd_add_d (dd_exp (x), -1.0);
+}
+
+/* log (1 + x) for -0.3 <= x <= 0.42 by Newton iteration on expm1.  */
+static dd_t
+log1p_kernel (dd_t x)
+{
+  dd_t y = dd (log1p (x.hi), 0.0), e;
+  int i;
+
+  if (x.hi == 0.0)
+    return x;
+  for (i = 0; i < 3; i++)
+    {
+      e = expm1_kernel (y);
+      y = dd_sub (y, dd_div (dd_sub (e, x), dd_add_d (e, 1.0)));
+    }
+  return y;
+}
+
+static dd_t
+dd_log (dd_t x)
+{
+  int e;
+
+  if (x.hi < 0.0 || isnan (x.hi))
+    return dd_nan;
+  if (x.hi == 0.0)
+    return dd (-INFINITY, 0.0);
+  if (isinf (x.hi))
+    return x;
+  frexp (x.hi, &e);
+  x = dd_ldexp (x, -e);
+  if (x.hi < M_SQRT1_2)
+    {
+      x = dd_ldexp (x, 1);
+      e--;
+    }
+  return dd_add (log1p_kernel (dd_add_d (x, -1.0)),
+		 dd_mul_const (e, ln2, 3));
+}
+
+static dd_t
+dd_log1p (dd_t x)
+{
+  if (fabs (x.hi) <= 0.25)
+    return log1p_kernel (x);
+  return dd_log (dd_add_d (x, 1.0));
+}
+
+/* sin (x) and cos (x) for |x| below 2^60.  */
+static void
+dd_sincos (dd_t x, dd_t *s, dd_t *c)
+{
+  double k = rint (x.hi / pio2[0]);
+  dd_t r, r2, ts = dd (1.0, 0.0), tc = dd (1.0, 0.0);
+  int n, q;
+
+  /* The first step is exact.  Above 2^53 k is not the nearest integer
+     to x / (pi/2), so a second step is needed.  */
+  r = dd_reduce (x, k, pio2, 5);
+  q = (int) fmod (k, 4.0);
+  k = rint (r.hi / pio2[0]);
+  r = dd_reduce (r, k, pio2, 5);
+  q = (q + (int) k) & 3;
+  r2 = dd_mul (r, r);
+  for (n = 16; n >= 1; n--)
+    {
+      ts = dd_add_d (dd_neg (dd_div_d (dd_mul (r2, ts),
+				       (2.0 * n) * (2.0 * n + 1))), 1.0);
+      tc = dd_add_d (dd_neg (dd_div_d (dd_mul (r2, tc),
+				       (2.0 * n - 1) * (2.0 * n))), 1.0);
+    }
+  ts = dd_mul (r, ts);
+  *s = q == 0 ? ts : q == 1 ? tc : q == 2 ? dd_neg (ts) : dd_neg (tc);
+  *c = q == 0 ? tc : q == 1 ? dd_neg (ts) : q == 2 ? dd_neg (tc) : ts;
+}
+
+/* atan (x) by Newton iteration on sin (y) - x cos (y), which converges
+   fast as the second derivative is zero at the root.  */
+static dd_t
+dd_atan (dd_t x)
+{
+  dd_t y, s, c;
+  int i;
+
+  if (isnan (x.hi))
+    return dd_nan;
+  if (fabs (x.hi) > 0x1p50)
+    {
+      y = dd_atan (dd_div (dd (-1.0, 0.0), x));
+      return dd_add (y, x.hi > 0 ? dd (pio2[0], pio2[1])
+			       : dd (-pio2[0], -pio2[1]));
+    }
+  y = dd (atan (x.hi), 0.0);
+  for (i = 0; i < 3; i++)
+    {
+      dd_sincos (y, &s, &c);
+      y = dd_sub (y, dd_div (dd_sub (s, dd_mul (x, c)),
+			     dd_add (c, dd_mul (x, s))));
+    }
+  return y;
+}
+
+/* atan2 (y, x) for y >= 0.  */
+static dd_t
+dd_atan2 (dd_t y, dd_t x)
+{
+  dd_t pi = dd (2 * pio2[0], 2 * pio2[1]);
+
+  if (x.hi < 0.0)
+    return dd_sub (pi, dd_atan2 (y, dd_neg (x)));
+  if (y.hi == 0.0)
+    return dd (0.0, 0.0);
+  if (y.hi > x.hi)
+    return dd_sub (dd (pio2[0], pio2[1]), dd_atan (dd_div (x, y)));
+  return dd_atan (dd_div (y, x));
+}
+
+static dd_t
+dd_copysign (dd_t r, double x)
+{
+  return signbit (x) ? dd_neg (r) : r;
+}
+
+static dd_t
+d (double x)
+{
+  return dd (x, 0.0);
+}
+
+dd_t
+ref_exp (double x)
+{
+  return dd_exp (d (x));
+}
+
+dd_t
+ref_exp2 (double x)
+{
+  double k = rint (x);
+
+  if (fabs (x) > 2000.0)
+    return x > 0 ? d (INFINITY) : d (0.0);
+  /* Keep the argument of exp small, so its error is not scaled up.  */
+  return dd_ldexp (dd_exp (dd_mul_d (dd (ln2[0], ln2[1]), x - k)), k);
+}
+
+dd_t
+ref_exp10 (double x)
+{
+  double k = rint (x / 0x1.34413509f79ffp-2);
+
+  if (fabs (x) > 400.0)
+    return x > 0 ? d (INFINITY) : d (0.0);
+  /* x * ln10 - k * ln2 is small, so the error of exp is not scaled up.  */
+  return dd_ldexp (dd_exp (dd_sub (dd_mul_d (dd (ln10[0], ln10[1]), x),
+				   dd_mul_const (k, ln2, 3))), k);
+}
+
+dd_t
+ref_expm1 (double x)
+{
+  return dd_expm1 (d (x));
+}
+
+dd_t
+ref_log (double x)
+{
+  return dd_log (d (x));
+}
+
+dd_t
+ref_log2 (double x)
+{
+  dd_t l = dd_log (d (x));
+
+  return isfinite (l.hi) ? dd_div (l, dd (ln2[0], ln2[1])) : l;
+}
+
+dd_t
+ref_log10 (double x)
+{
+  dd_t l = dd_log (d (x));
+
+  return isfinite (l.hi) ? dd_div (l, dd (ln10[0], ln10[1])) : l;
+}
+
+dd_t
+ref_log1p (double x)
+{
+  if (x < -1.0)
+    return dd_nan;
+  return dd_log1p (d (x));
+}
+
+dd_t
+ref_pow (double x, double y)
+{
+  dd_t l;
+  int odd = 0;
+
+  if (x == 1.0 || y == 0.0)
+    return d (1.0);
+  if (x < 0.0)
+    {
+      if (y != rint (y))
+	return dd_nan;
+      odd = fabs (y) < 0x1p53 && fmod (y, 2.0) != 0.0;
+      x = -x;
+    }
+  if (x == 0.0)
+    return dd_copysign (d (y < 0 ? INFINITY : 0.0), odd ? -1.0 : 1.0);
+  l = dd_mul_d (dd_log (d (x)), y);
+  l = dd_exp (l);
+  return odd ? dd_neg (l) : l;
+}
+
+dd_t
+ref_sin (double x)
+{
+  dd_t s, c;
+
+  if (!(fabs (x) < 0x1p60))
+    return dd_nan;
+  dd_sincos (d (x), &s, &c);
+  return s;
+}
+
+dd_t
+ref_cos (double x)
+{
+  dd_t s, c;
+
+  if (!(fabs (x) < 0x1p60))
+    return dd_nan;
+  dd_sincos (d (x), &s, &c);
+  return c;
+}
+
+dd_t
+ref_tan (double x)
+{
+  dd_t s, c;
+
+  if (!(fabs (x) < 0x1p60))
+    return dd_nan;
+  dd_sincos (d (x), &s, &c);
+  return dd_div (s, c);
+}
+
+/* sqrt (1 - x^2), exact in the product.  */
+static dd_t
+sqrt1mx2 (double x)
+{
+  return dd_sqrt (dd_mul (dd_add_d (d (1.0), -x), dd_add_d (d (1.0), x)));
+}
+
+dd_t
+ref_asin (double x)
+{
+  if (!(fabs (x) <= 1.0))
+    return dd_nan;
+  return dd_copysign (dd_atan2 (d (fabs (x)), sqrt1mx2 (x)), x);
+}
+
+dd_t
+ref_acos (double x)
+{
+  if (!(fabs (x) <= 1.0))
+    return dd_nan;
+  return dd_atan2 (sqrt1mx2 (x), d (x));
+}
+
+dd_t
+ref_atan (double x)
+{
+  return dd_atan (d (x));
+}
+
+dd_t
+ref_atan2 (double y, double x)
+{
+  if (isnan (x) || isnan (y))
+    return dd_nan;
+  return dd_copysign (dd_atan2 (d (fabs (y)), d (x)), y);
+}
+
+dd_t
+ref_sinh (double x)
+{
+  dd_t e;
+
+  if (fabs (x) > 40.0)
+    /* e^|x| / 2, which only overflows where sinh does.  */
+    e = dd_exp (dd_sub (d (fabs (x)), dd_mul_const (1.0, ln2, 3)));
+  else
+    {
+      /* (e^x - e^-x) / 2 = (E + E / (E + 1)) / 2 with E = e^|x| - 1.  */
+      e = dd_expm1 (d (fabs (x)));
+      e = dd_ldexp (dd_add (e, dd_div (e, dd_add_d (e, 1.0))), -1);
+    }
+  return dd_copysign (e, x);
+}
+
+dd_t
+ref_cosh (double x)
+{
+  dd_t e;
+
+  if (fabs (x) > 40.0)
+    return dd_exp (dd_sub (d (fabs (x)), dd_mul_const (1.0, ln2, 3)));
+  e = dd_exp (d (x));
+  return dd_ldexp (dd_add (e, dd_div (d (1.0), e)), -1);
+}
+
+dd_t
+ref_tanh (double x)
+{
+  dd_t e;
+
+  if (fabs (x) > 40.0)
+    return d (copysign (1.0, x));
+  e = dd_expm1 (d (2.0 * x));
+  return dd_div (e, dd_add_d (e, 2.0));
+}
+
+dd_t
+ref_asinh (double x)
+{
+  double ax = fabs (x);
+  dd_t x2, r;
+
+  if (ax > 0x1p500)
+    r = dd_add (dd_log (d (ax)), dd_mul_const (1.0, ln2, 3));
+  else
+    {
+      /* log1p (|x| + x^2 / (1 + sqrt (1 + x^2))).  */
+      x2 = two_prod (ax, ax);
+      r = dd_div (x2, dd_add_d (dd_sqrt (dd_add_d (x2, 1.0)), 1.0));
+      r = dd_log1p (dd_add_d (r, ax));
+    }
+  return dd_copysign (r, x);
+}
+
+dd_t
+ref_acosh (double x)
+{
+  dd_t t;
+
+  if (!(x >= 1.0))
+    return dd_nan;
+  if (x > 0x1p500)
+    return dd_add (dd_log (d (x)), dd_mul_const (1.0, ln2, 3));
+  /* log1p ((x - 1) + sqrt ((x - 1) * (x + 1))).  */
+  t = dd_add_d (d (x), -1.0);
+  return dd_log1p (dd_add (t, dd_sqrt (dd_mul (t, dd_add_d (d (x), 1.0)))));
+}
+
+dd_t
+ref_atanh (double x)
+{
+  dd_t t;
+
+  if (!(fabs (x) <= 1.0))
+    return dd_nan;
+  if (fabs (x) == 1.0)
+    return d (x / 0.0);
+  if (fabs (x) <= 0.25)
+    {
+      /* log1p (2x / (1 - x)) / 2.  */
+      t = dd_div (d (2.0 * x), dd_add_d (d (1.0), -x));
+      return dd_ldexp (dd_log1p (t), -1);
+    }
+  /* (log (1 + |x|) - log (1 - |x|)) / 2, where 1 - |x| is exact.  */
+  t = dd_sub (dd_log (dd_add_d (d (1.0), fabs (x))),
+	      dd_log (dd_add_d (d (1.0), -fabs (x))));
+  return dd_copysign (dd_ldexp (t, -1), x);
+}
+
+dd_t
+ref_sqrt (double x)
+{
+  if (x < 0.0)
+    return dd_nan;
+  if (x == 0.0 || isinf (x))
+    return d (x);
+  return dd_sqrt (d (x));
+}
+
+dd_t
+ref_cbrt (double x)
+{
+  double ax = fabs (x);
+  dd_t y, y3;
+  int e, i;
+
+  if (ax == 0.0 || !isfinite (ax))
+    return d (x);
+  /* Scale to [1, 8) so the cube does not overflow or underflow.  */
+  frexp (ax, &e);
+  e = (e - 1) - (((e - 1) % 3) + 3) % 3;
+  ax = ldexp (ax, -e);
+  y = d (cbrt (ax));
+  for (i = 0; i < 2; i++)
+    {
+      y3 = dd_mul (dd_mul (y, y), y);
+      y = dd_sub (y, dd_div (dd_add_d (y3, -ax),
+			     dd_mul_d (dd_mul (y, y), 3.0)));
+    }
+  return dd_copysign (dd_ldexp (y, e / 3), x);
+}
+
+dd_t
+ref_hypot (double x, double y)
+{
+  double ax = fabs (x), ay = fabs (y), m = ax > ay ? ax : ay;
+  int e;
+
+  if (isinf (x) || isinf (y))
+    return d (INFINITY);
+  if (isnan (x) || isnan (y))
+    return dd_nan;
+  if (m == 0.0)
+    return d (0.0);
+  frexp (m, &e);
+  ax = ldexp (ax, -e);
+  ay = ldexp (ay, -e);
+  return dd_ldexp (dd_sqrt (dd_add (two_prod (ax, ax), two_prod (ay, ay))),
+		   e);
+}
+
+/* fmod (|x|, |y|) by subtracting |y| * 2^k for decreasing k.  Each
+   difference is exact, as |y| * 2^k <= r < |y| * 2^(k+1).  Sets *ODD to
+   the parity of the quotient.  */
+static double
+fmod_exact (double ax, double ay, int *odd)
+{
+  double t;
+  int ex, ey;
+
+  *odd = 0;
+  if (ax < ay)
+    return ax;
+  frexp (ax, &ex);
+  frexp (ay, &ey);
+  t = ldexp (ay, ex - ey);
+  if (t > ax)
+    t *= 0.5;
+  for (;;)
+    {
+      *odd = ax >= t;
+      if (ax >= t)
+	ax -= t;
+      if (t == ay)
+	return ax;
+      t *= 0.5;
+    }
+}
+
+dd_t
+ref_fmod (double x, double y)
+{
+  int odd;
+
+  if (!isfinite (x) || isnan (y) || y == 0.0)
+    return dd_nan;
+  return d (copysign (fmod_exact (fabs (x), fabs (y), &odd), x));
+}
+
+dd_t
+ref_remainder (double x, double y)
+{
+  double ay = fabs (y), r;
+  int odd;
+
+  if (!isfinite (x) || isnan (y) || y == 0.0)
+    return dd_nan;
+  if (isinf (y))
+    return d (x);
+  r = fmod_exact (fabs (x), ay, &odd);
+  /* Round the quotient to nearest, ties to even.  */
+  if (2 * r > ay || (2 * r == ay && odd))
+    r -= ay;
+  return d (r == 0.0 ? copysign (0.0, x) : (x < 0 ? -r : r));
+}
+
+/* lgamma (x) for x >= 20 by the Stirling series, which has converged
+   below 2^-110 after 17 terms.  */
+static dd_t
+dd_lgamma_stirling (dd_t x)
+{
+  dd_t w = dd_div (d (1.0), x), w2 = dd_mul (w, w), s = d (0.0);
+  int k;
+
+  for (k = 17; k >= 1; k--)
+    s = dd_add (dd_mul (s, w2),
+		dd_div_d (d (bernoulli[k - 1][0]),
+			  bernoulli[k - 1][1] * (2 * k) * (2 * k - 1)));
+  /* (x - 0.5) * log (x) - x + log (2 pi) / 2 + s / x.  */
+  s = dd_add (dd_mul (s, w), dd (hlog2pi[0], hlog2pi[1]));
+  s = dd_sub (s, x);
+  return dd_add (s, dd_mul (dd_add_d (x, -0.5), dd_log (x)));
+}
+
+/* lgamma (x) for x > 0, moved above 20 by the recurrence.  The result
+   loses relative precision close to the zeros at 1 and 2.  */
+static dd_t
+dd_lgamma_pos (double x)
+{
+  dd_t p = d (x);
+  int k, n;
+
+  if (x >= 20.0)
+    return dd_lgamma_stirling (d (x));
+  n = (int) ceil (20.0 - x);
+  for (k = 1; k < n; k++)
+    p = dd_mul (p, dd_add_d (d (x), k));
+  return dd_sub (dd_lgamma_stirling (dd_add_d (d (x), n)), dd_log (p));
+}
+
+/* lgamma (x) and the sign of gamma (x) in *NEG for x not a pole.  */
+static dd_t
+dd_lgamma (double x, int *neg)
+{
+  dd_t pi = dd (2 * pio2[0], 2 * pio2[1]), s, c;
+  double r;
+
+  *neg = 0;
+  if (x > 0.0)
+    return dd_lgamma_pos (x);
+  /* log (pi / |x * sin (pi * x)|) - lgamma (-x).  */
+  r = x - rint (x);
+  dd_sincos (dd_mul_d (pi, fabs (r)), &s, &c);
+  *neg = (fmod (floor (-x), 2.0) == 0.0);
+  return dd_sub (dd_log (dd_div (pi, dd_mul_d (s, fabs (x)))),
+		 dd_lgamma_pos (-x));
+}
+
+dd_t
+ref_tgamma (double x)
+{
+  dd_t l;
+  int neg;
+
+  if (isnan (x) || x == -INFINITY)
+    return dd_nan;
+  if (x == 0.0 || x == INFINITY)
+    return d (1.0 / x);
+  if (x < 0.0 && x == rint (x))
+    return dd_nan;
+  l = dd_exp (dd_lgamma (x, &neg));
+  return neg ? dd_neg (l) : l;
+}
+
+dd_t
+ref_lgamma (double x)
+{
+  int neg;
+
+  if (isnan (x))
+    return dd_nan;
+  if (isinf (x) || (x <= 0.0 && x == rint (x)))
+    return d (INFINITY);
+  return dd_lgamma (x, &neg);
+}
+
+/* erf (x) for |x| <= 6 by the series 2 / sqrt (pi) * e^-x^2 * sum of
+   2^n x^(2n+1) / (1 * 3 * ... * (2n + 1)), which has no cancellation.  */
+static dd_t
+dd_erf (double x)
+{
+  dd_t x2 = dd_ldexp (two_prod (x, x), 1), t = d (x), s = d (x);
+  int n;
+
+  for (n = 1; fabs (t.hi) > 0x1p-110 * fabs (s.hi); n++)
+    {
+      t = dd_div_d (dd_mul (t, x2), 2 * n + 1);
+      s = dd_add (s, t);
+    }
+  s = dd_mul (s, dd_exp (dd_ldexp (dd_neg (x2), -1)));
+  return dd_mul (s, dd (twoosqrtpi[0], twoosqrtpi[1]));
+}
+
+/* erfc (x) for x >= 3 by its continued fraction
+   e^-x^2 / sqrt (pi) / (x + (1/2) / (x + 1 / (x + (3/2) / (x + ...)))),
+   evaluated backwards from 200 terms.  */
+static dd_t
+dd_erfc_cf (double x)
+{
+  dd_t t = d (x), e;
+  int k;
+
+  for (k = 200; k >= 1; k--)
+    t = dd_add_d (dd_div (d (0.5 * k), t), x);
+  e = dd_exp (dd_neg (two_prod (x, x)));
+  return dd_div (dd_mul (e, dd (twoosqrtpi[0] / 2, twoosqrtpi[1] / 2)), t);
+}
+
+dd_t
+ref_erf (double x)
+{
+  if (isnan (x))
+    return dd_nan;
+  if (fabs (x) > 6.0)
+    return dd_copysign (dd_add_d (dd_neg (dd_erfc_cf (fabs (x))), 1.0), x);
+  return dd_erf (x);
+}
+
+dd_t
+ref_erfc (double x)
+{
+  if (isnan (x))
+    return dd_nan;
+  if (x >= 3.0)
+    return dd_erfc_cf (x);
+  if (x < -6.0)
+    return dd_add_d (dd_neg (dd_erfc_cf (-x)), 2.0);
+  return dd_add_d (dd_neg (dd_erf (x)), 1.0);
+}
@@ -0,0 +1,201 @@
+#define _GNU_SOURCE
+#include "test.h"
+#include <complex.h>
+#include <string.h>
+#include <time.h>
+
+/* Check the complex functions which share their sin/cos and sinh/cosh
+   evaluations against the formulas with separate calls, check the array
+   functions against the scalar ones, and report their speed.  */
+
+extern int inacc;
+
+#define NTEST 100000
+#define NBENCH 1024
+#define BENCH_LOOPS 1000
+
+static unsigned int seed = 1;
+
+static double
+urand (double lo, double hi)
+{
+  seed = seed * 1103515245 + 12345;
+  return lo + (hi - lo) * (seed >> 8) * 0x1p-24;
+}
+
+/* Both parts of W must be within 2^-BITS of the larger part of REF.  */
+static int
+close_to (double complex w, double complex ref, int bits)
+{
+  double m = fmax (fabs (creal (ref)), fabs (cimag (ref)));
+
+  return fabs (creal (w) - creal (ref)) <= ldexp (m, -bits)
+	 && fabs (cimag (w) - cimag (ref)) <= ldexp (m, -bits);
+}
+
+static void
+check (const char *name, double complex z, double complex w,
+       double complex ref, int bits)
+{
+  if (!close_to (w, ref, bits))
+    {
+      inacc++;
+      printf ("%s, wrong answer for %a%+ai: %a%+ai should be %a%+ai\n",
+	      name, creal (z), cimag (z), creal (w), cimag (w),
+	      creal (ref), cimag (ref));
+    }
+}
+
+static void
+check_scalar (void)
+{
+  double complex z;
+  float complex zf;
+  double x, y, d;
+  float xf, yf;
+  int i;
+
+  for (i = 0; i < NTEST; i++)
+    {
+      x = urand (-20.0, 20.0);
+      y = urand (-20.0, 20.0);
+      if (i & 1)
+	{
+	  x *= 0x1p-5;
+	  y *= 0x1p-5;
+	}
+      z = x + y * I;
+      check ("cexp", z, cexp (z), exp (x) * cos (y) + exp (x) * sin (y) * I,
+	     50);
+      check ("ccos", z, ccos (z), cos (x) * cosh (y) - sin (x) * sinh (y) * I,
+	     50);
+      check ("csin", z, csin (z), sin (x) * cosh (y) + cos (x) * sinh (y) * I,
+	     50);
+      check ("ccosh", z, ccosh (z),
+	     cosh (x) * cos (y) + sinh (x) * sin (y) * I, 50);
+      check ("csinh", z, csinh (z),
+	     sinh (x) * cos (y) + cosh (x) * sin (y) * I, 50);
+      d = cosh (2.0 * x) + cos (2.0 * y);
+      if (d > 0.25)
+	check ("ctanh", z, ctanh (z),
+	       sinh (2.0 * x) / d + sin (2.0 * y) / d * I, 48);
+      d = cos (2.0 * x) + cosh (2.0 * y);
+      if (d > 0.25)
+	check ("ctan", z, ctan (z),
+	       sin (2.0 * x) / d + sinh (2.0 * y) / d * I, 48);
+
+      xf = x;
+      yf = y;
+      zf = xf + yf * I;
+      check ("cexpf", zf, cexpf (zf),
+	     exp (xf) * cos (yf) + exp (xf) * sin (yf) * I, 21);
+      check ("ccoshf", zf, ccoshf (zf),
+	     cosh (xf) * cos (yf) + sinh (xf) * sin (yf) * I, 21);
+      check ("csinf", zf, csinf (zf),
+	     sin (xf) * cosh (yf) + cos (xf) * sinh (yf) * I, 21);
+    }
+
+  /* sinh and cosh keep their range beyond the overflow of exp.  */
+  test_iok (isinf (creal (ccosh (700.0))) == 0
+	    && isinf (creal (ccosh (710.0))) == 0
+	    && isfinite (creal (ccosh (711.0))) == 0
+	    && isinf (crealf (ccoshf (89.0f))) == 0, 1);
+}
+
+static void
+check_array (void)
+{
+  static double complex z[NBENCH], w[NBENCH];
+  static float complex zf[NBENCH], wf[NBENCH];
+  static double r[NBENCH];
+  static float rf[NBENCH];
+  double complex v;
+  float complex vf;
+  double s;
+  float sf;
+  int i, bad = 0;
+
+  for (i = 0; i < NBENCH; i++)
+    {
+      z[i] = urand (-50.0, 50.0) + urand (-1e3, 1e3) * I;
+      zf[i] = z[i];
+    }
+  z[0] = INFINITY;
+  z[1] = -INFINITY;
+  z[2] = NAN;
+  z[3] = -0.0;
+  zf[3] = -0.0f;
+
+  cexp_array (w, z, NBENCH);
+  cexpf_array (wf, zf, NBENCH);
+  for (i = 0; i < NBENCH; i++)
+    {
+      v = cexp (z[i]);
+      vf = cexpf (zf[i]);
+      bad += memcmp (&v, &w[i], sizeof (v)) != 0;
+      bad += memcmp (&vf, &wf[i], sizeof (vf)) != 0;
+    }
+  cabs_array (r, z, NBENCH);
+  cabsf_array (rf, zf, NBENCH);
+  for (i = 0; i < NBENCH; i++)
+    {
+      s = cabs (z[i]);
+      sf = cabsf (zf[i]);
+      bad += memcmp (&s, &r[i], sizeof (s)) != 0;
+      bad += memcmp (&sf, &rf[i], sizeof (sf)) != 0;
+    }
+  carg_array (r, z, NBENCH);
+  cargf_array (rf, zf, NBENCH);
+  for (i = 0; i < NBENCH; i++)
+    {
+      s = carg (z[i]);
+      sf = cargf (zf[i]);
+      bad += memcmp (&s, &r[i], sizeof (s)) != 0;
+      bad += memcmp (&sf, &rf[i], sizeof (sf)) != 0;
+    }
+
+  /* In place.  */
+  memcpy (w, z, sizeof (w));
+  cexp_array (w, w, NBENCH);
+  for (i = 0; i < NBENCH; i++)
+    {
+      v = cexp (z[i]);
+      bad += memcmp (&v, &w[i], sizeof (v)) != 0;
+    }
+  test_iok (bad, 0);
+}
+
+void
+test_complex (void)
+{
+  static double complex z[NBENCH], w[NBENCH];
+  static double r[NBENCH];
+  clock_t t;
+  int i, j;
+
+  newfunc ("complex");
+  line (1);
+  check_scalar ();
+  line (2);
+  check_array ();
+
+  for (i = 0; i < NBENCH; i++)
+    z[i] = urand (-2.0, 2.0) + urand (-10.0, 10.0) * I;
+
+#define BENCH(name, loop)						\
+  t = clock ();								\
+  for (j = 0; j < BENCH_LOOPS; j++)					\
+    loop;								\
+  t = clock () - t;							\
+  printf ("%-12s: %.3f s\n", name, (double) t / CLOCKS_PER_SEC)
+
+  BENCH ("cexp", for (i = 0; i < NBENCH; i++) w[i] = cexp (z[i]));
+  BENCH ("cexp_array", cexp_array (w, z, NBENCH));
+  BENCH ("cabs", for (i = 0; i < NBENCH; i++) r[i] = cabs (z[i]));
+  BENCH ("cabs_array", cabs_array (r, z, NBENCH));
+  BENCH ("carg", for (i = 0; i < NBENCH; i++) r[i] = carg (z[i]));
+  BENCH ("carg_array", carg_array (r, z, NBENCH));
+  BENCH ("ccos", for (i = 0; i < NBENCH; i++) w[i] = ccos (z[i]));
+  BENCH ("ccosh", for (i = 0; i < NBENCH; i++) w[i] = ccosh (z[i]));
+  BENCH ("ctanh", for (i = 0; i < NBENCH; i++) w[i] = ctanh (z[i]));
+}
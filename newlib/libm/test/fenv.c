@@ -0,0 +1,175 @@
+#include "test.h"
+#include <fenv.h>
+#include <stdlib.h>
+
+/* Check that the rounding mode and the environment functions take effect
+   for float, double and long double arithmetic.  The generic fenv.h
+   defines no rounding modes, and soft-float fesetround may accept only
+   FE_TONEAREST, so checks needing a mode are skipped where it is missing
+   or rejected.  "bench -e" reports the cost of the switches.  */
+
+static volatile double one = 1.0, three = 3.0;
+static volatile long double onel = 1.0L, threel = 3.0L;
+
+/* Ends with -1, which is not a rounding mode.  */
+static const int modes[] = {
+#ifdef FE_TONEAREST
+  FE_TONEAREST,
+#endif
+#ifdef FE_DOWNWARD
+  FE_DOWNWARD,
+#endif
+#ifdef FE_UPWARD
+  FE_UPWARD,
+#endif
+#ifdef FE_TOWARDZERO
+  FE_TOWARDZERO,
+#endif
+  -1
+};
+
+/* Results are stored in volatile variables, so that the compiler cannot
+   move the arithmetic across the mode changes.  */
+
+static void
+check_round (void)
+{
+  int i, bad = 0;
+
+  for (i = 0; modes[i] != -1; i++)
+    {
+      if (fesetround (modes[i]) != 0)
+	continue;
+      bad += fegetround () != modes[i];
+      /* Again, which must not change anything.  */
+      bad += fesetround (modes[i]) != 0;
+      bad += fegetround () != modes[i];
+    }
+
+#if defined (FE_TONEAREST) && defined (FE_DOWNWARD) && defined (FE_UPWARD) \
+    && defined (FE_TOWARDZERO)
+  if (fesetround (FE_DOWNWARD) == 0 && fesetround (FE_UPWARD) == 0
+      && fesetround (FE_TOWARDZERO) == 0)
+    {
+      volatile double down, up;
+      volatile long double downl, upl;
+
+      fesetround (FE_DOWNWARD);
+      down = one / three;
+      downl = onel / threel;
+      fesetround (FE_UPWARD);
+      up = one / three;
+      upl = onel / threel;
+      fesetround (FE_TOWARDZERO);
+      bad += -one / three != -down;
+      bad += -onel / threel != -downl;
+      fesetround (FE_TONEAREST);
+      bad += down >= up || downl >= upl;
+      bad += one / three != up && one / three != down;
+    }
+#endif
+
+#ifdef FE_TONEAREST
+  bad += fesetround (FE_TONEAREST) != 0;
+  bad += fesetround (-1) == 0;
+  bad += fegetround () != FE_TONEAREST;
+#endif
+  test_iok (bad, 0);
+}
+
+static void
+check_hold (void)
+{
+#if defined (FE_TONEAREST) && defined (FE_DOWNWARD) && defined (FE_UPWARD) \
+    && defined (FE_DIVBYZERO) && defined (FE_INEXACT)
+  fenv_t env;
+  volatile double up;
+  volatile long double third;
+  int bad = 0;
+
+  /* Without flags or directed modes there is nothing to hold.  */
+  feclearexcept (FE_ALL_EXCEPT);
+  feraiseexcept (FE_DIVBYZERO);
+  if (fetestexcept (FE_DIVBYZERO) == 0 || fesetround (FE_UPWARD) != 0)
+    {
+      feclearexcept (FE_ALL_EXCEPT);
+      return;
+    }
+  bad += feholdexcept (&env) != 0;
+  bad += fetestexcept (FE_ALL_EXCEPT) != 0;
+  bad += fegetround () != FE_UPWARD;
+  up = one / three;
+  bad += fetestexcept (FE_ALL_EXCEPT) != FE_INEXACT;
+  fesetround (FE_DOWNWARD);
+  bad += feupdateenv (&env) != 0;
+  bad += fegetround () != FE_UPWARD;
+  bad += one / three != up;
+  bad += fetestexcept (FE_ALL_EXCEPT) != (FE_DIVBYZERO | FE_INEXACT);
+
+  /* Long double arithmetic raises its flags in the x87 unit.  */
+  feclearexcept (FE_ALL_EXCEPT);
+  feholdexcept (&env);
+  third = onel / threel;
+  feupdateenv (&env);
+  bad += fetestexcept (FE_INEXACT) != FE_INEXACT || third == 0;
+
+  fesetenv (FE_DFL_ENV);
+  bad += fegetround () != FE_TONEAREST;
+  test_iok (bad, 0);
+#endif
+}
+
+/* strtold follows the rounding mode only where it can read it from the
+   x87 unit.  Just below a power of two, the directed modes need the
+   number below it, whose ulp is half that of the power.  */
+
+static void
+check_strtold (void)
+{
+#if (defined (__x86_64__) || defined (__i386__)) && !defined (__iamcu__) \
+    && LDBL_MANT_DIG == 64 && defined (FE_TOWARDZERO)
+  static const char below[] = "8.6736173798840354720596224069595336914e-19";
+  static const char nbelow[] = "-5.4210108624275221700372640043497085571e-20";
+  static const char big[] = "1.66380747905596319277662682326443985449e+1175";
+  long double p = 0x1p-60L, np = -0x1p-64L;
+  long double tiny = LDBL_MIN * LDBL_EPSILON;
+  int bad = 0;
+
+  fesetround (FE_TOWARDZERO);
+  bad += strtold (below, NULL) != p - p * LDBL_EPSILON / 2;
+  bad += strtold (nbelow, NULL) != np - np * LDBL_EPSILON / 2;
+  bad += strtold ("1.84467440737095516150e19", NULL) != 0x1p64L - 1;
+  bad += strtold ("1.2e4932", NULL) != LDBL_MAX;
+  bad += strtold ("12e-4952", NULL) != 0;
+  fesetround (FE_UPWARD);
+  bad += strtold (below, NULL) != p;
+  bad += strtold (nbelow, NULL) != np - np * LDBL_EPSILON / 2;
+  bad += strtold ("1.84467440737095516150e19", NULL) != 0x1p64L - 1;
+  bad += strtold ("-1.2e4932", NULL) != -LDBL_MAX;
+  bad += strtold ("12e-4952", NULL) != tiny;
+  fesetround (FE_DOWNWARD);
+  bad += strtold (below, NULL) != p - p * LDBL_EPSILON / 2;
+  bad += strtold (nbelow, NULL) != np;
+  bad += strtold ("-12e-4952", NULL) != -tiny;
+  fesetround (FE_TONEAREST);
+  bad += strtold (below, NULL) != p;
+  bad += strtold (nbelow, NULL) != np;
+  bad += strtold (big, NULL) != 0x1p3904L - 0x1p3840L;
+  test_iok (bad, 0);
+#endif
+}
+
+void
+test_fenv (void)
+{
+  newfunc ("fenv");
+  line (1);
+  check_round ();
+  line (2);
+  check_hold ();
+  line (3);
+  check_strtold ();
+#ifdef FE_TONEAREST
+  fesetround (FE_TONEAREST);
+#endif
+}
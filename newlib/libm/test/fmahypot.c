@@ -0,0 +1,448 @@
+#define _GNU_SOURCE
+#include "test.h"
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+/* Check fma, fmod, hypot and their float variants against exact
+   references, and report their speed.  fma and fmaf must be correctly
+   rounded and fmod and fmodf exact.  The exact sums below use the
+   expansions of Shewchuk's robust predicates, so the test must run in
+   round-to-nearest mode.  */
+
+extern int inacc;
+
+#define NTEST 200000
+#define NBENCH 1024
+#define BENCH_LOOPS 1000
+
+static unsigned int seed = 1;
+
+static uint32_t
+rand32 (void)
+{
+  uint32_t r;
+
+  seed = seed * 1103515245 + 12345;
+  r = seed >> 16;
+  seed = seed * 1103515245 + 12345;
+  return r << 16 | seed >> 16;
+}
+
+static double
+asdouble (uint64_t i)
+{
+  double d;
+
+  memcpy (&d, &i, sizeof (d));
+  return d;
+}
+
+static uint64_t
+asuint64 (double d)
+{
+  uint64_t i;
+
+  memcpy (&i, &d, sizeof (i));
+  return i;
+}
+
+static float
+asfloat (uint32_t i)
+{
+  float f;
+
+  memcpy (&f, &i, sizeof (f));
+  return f;
+}
+
+static uint32_t
+asuint (float f)
+{
+  uint32_t i;
+
+  memcpy (&i, &f, sizeof (i));
+  return i;
+}
+
+/* A random double with a random sign and mantissa and a binary exponent
+   in [LO, HI].  */
+static double
+rand_exp (int lo, int hi)
+{
+  uint64_t m = (uint64_t) rand32 () << 32 | rand32 ();
+  int e = lo + rand32 () % (hi - lo + 1);
+
+  return asdouble ((m & 0x800fffffffffffff) | (uint64_t) (e + 1023) << 52);
+}
+
+/* Split the product X * Y into *HI + *LO exactly, unless *LO underflows.  */
+static void
+two_prod (double x, double y, double *hi, double *lo)
+{
+  double c, xh, xl, yh, yl;
+
+  c = 0x1.0000002p27 * x;
+  xh = c - (c - x);
+  xl = x - xh;
+  c = 0x1.0000002p27 * y;
+  yh = c - (c - y);
+  yl = y - yh;
+  *hi = x * y;
+  *lo = ((xh * yh - *hi) + xh * yl + xl * yh) + xl * yl;
+}
+
+/* Return the sign of the exact sum of the N terms of E, which is
+   overwritten.  Adding the terms one by one to a nonoverlapping expansion
+   leaves its largest component last, and that has the sign of the sum.  */
+static int
+sum_sign (double *e, int n)
+{
+  double b, s, bv;
+  int i, j;
+
+  for (i = 1; i < n; i++)
+    {
+      b = e[i];
+      for (j = 0; j < i; j++)
+	{
+	  s = b + e[j];
+	  bv = s - b;
+	  e[j] = (b - (s - bv)) + (e[j] - bv);
+	  b = s;
+	}
+      e[i] = b;
+    }
+  for (i = n - 1; i >= 0; i--)
+    if (e[i] != 0)
+      return e[i] > 0 ? 1 : -1;
+  return 0;
+}
+
+/* Return whether R is the exact sum of the N terms of E rounded to nearest,
+   where R has its neighbours DOWN and UP in its format and is EVEN if its
+   last mantissa bit is clear.  E has room for two more terms.  */
+static int
+rounded (double *e, int n, double r, double down, double up, int even)
+{
+  double t[8];
+  int lo, hi;
+
+  memcpy (t, e, n * sizeof (double));
+  t[n] = -r;
+  t[n + 1] = (r - down) / 2;
+  lo = sum_sign (t, n + 2);
+  memcpy (t, e, n * sizeof (double));
+  t[n] = -r;
+  t[n + 1] = -(up - r) / 2;
+  hi = sum_sign (t, n + 2);
+  return (lo > 0 || (lo == 0 && even)) && (hi < 0 || (hi == 0 && even));
+}
+
+static void
+check_fma (double x, double y, double z)
+{
+  double e[5], r = fma (x, y, z);
+
+  two_prod (x, y, &e[0], &e[1]);
+  e[2] = z;
+  if (!rounded (e, 3, r, nextafter (r, -INFINITY), nextafter (r, INFINITY),
+		(asuint64 (r) & 1) == 0)
+      && inacc++ < 20)
+    printf ("fma, wrong answer for %a %a %a: %a\n", x, y, z, r);
+}
+
+static void
+check_fmaf (float x, float y, float z)
+{
+  double e[4];
+  float r = fmaf (x, y, z);
+
+  e[0] = (double) x * y;
+  e[1] = z;
+  if (!rounded (e, 2, r, nextafterf (r, -INFINITY), nextafterf (r, INFINITY),
+		(asuint (r) & 1) == 0)
+      && inacc++ < 20)
+    printf ("fmaf, wrong answer for %a %a %a: %a\n", x, y, z, r);
+}
+
+/* fmod by subtracting Y times decreasing powers of 2, each subtraction is
+   exact.  */
+static double
+fmod_ref (double x, double y)
+{
+  double ax = fabs (x), ay = fabs (y), t;
+
+  if (ax < ay)
+    return x;
+  t = ldexp (ay, ilogb (ax) - ilogb (ay));
+  if (t > ax)
+    t /= 2;
+  for (; t >= ay; t /= 2)
+    if (ax >= t)
+      ax -= t;
+  return copysign (ax, x);
+}
+
+static void
+check_fmod (double x, double y)
+{
+  double is = fmod (x, y), shouldbe = fmod_ref (x, y);
+
+  if (asuint64 (is) != asuint64 (shouldbe) && inacc++ < 20)
+    printf ("fmod, wrong answer for %a %a: %a should be %a\n", x, y, is,
+	    shouldbe);
+}
+
+static void
+check_fmodf (float x, float y)
+{
+  float is = fmodf (x, y), shouldbe = fmod_ref (x, y);
+
+  if (asuint (is) != asuint (shouldbe) && inacc++ < 20)
+    printf ("fmodf, wrong answer for %a %a: %a should be %a\n", x, y, is,
+	    shouldbe);
+}
+
+/* The result of hypot must be within 1 ULP: the sum of the squares lies
+   between the squares of its neighbours.  */
+static void
+check_hypot (double x, double y)
+{
+  double e[6], r = hypot (x, y), down, up;
+  int lo, hi;
+
+  down = nextafter (r, 0);
+  up = nextafter (r, INFINITY);
+  two_prod (x, x, &e[0], &e[1]);
+  two_prod (y, y, &e[2], &e[3]);
+  two_prod (down, down, &e[4], &e[5]);
+  e[4] = -e[4];
+  e[5] = -e[5];
+  lo = sum_sign (e, 6);
+  two_prod (x, x, &e[0], &e[1]);
+  two_prod (y, y, &e[2], &e[3]);
+  two_prod (up, up, &e[4], &e[5]);
+  e[4] = -e[4];
+  e[5] = -e[5];
+  hi = sum_sign (e, 6);
+  if ((lo <= 0 || hi >= 0) && inacc++ < 20)
+    printf ("hypot, wrong answer for %a %a: %a\n", x, y, r);
+}
+
+static double
+fma_1 (double x)
+{
+  return fma (x, 0x1.3456789abcdefp-1, -0.75);
+}
+
+static double
+fmod_1 (double x)
+{
+  return fmod (x, 0x1.3456789abcdefp-1);
+}
+
+static double
+fmod_big (double x)
+{
+  return fmod (x * 0x1p1000, 0x1.3456789abcdefp-1);
+}
+
+static double
+hypot_1 (double x)
+{
+  return hypot (x, 0x1.3456789abcdefp-1);
+}
+
+static float
+fmaf_1 (float x)
+{
+  return fmaf (x, 0x1.345678p-1f, -0.75f);
+}
+
+static float
+fmodf_1 (float x)
+{
+  return fmodf (x, 0x1.345678p-1f);
+}
+
+static float
+hypotf_1 (float x)
+{
+  return hypotf (x, 0x1.345678p-1f);
+}
+
+typedef struct
+{
+  const char *name;
+  double (*func) (double);
+} fmahypot_func_type;
+
+typedef struct
+{
+  const char *name;
+  float (*func) (float);
+} fmahypotf_func_type;
+
+static const fmahypot_func_type funcs[] =
+{
+  {"fma", fma_1},
+  {"fmod", fmod_1},
+  {"fmod big", fmod_big},
+  {"hypot", hypot_1},
+};
+
+static const fmahypotf_func_type funcsf[] =
+{
+  {"fmaf", fmaf_1},
+  {"fmodf", fmodf_1},
+  {"hypotf", hypotf_1},
+};
+
+void
+test_fmahypot (void)
+{
+  static double x[NBENCH], y[NBENCH];
+  static float xf[NBENCH], yf[NBENCH];
+  unsigned int i, k;
+  double a, b, c;
+  float af, bf, cf;
+  clock_t t;
+  int j;
+
+  /* Random operands, and sums that cancel most of the product, where the
+     alignment and the sticky bit matter.  */
+  newfunc ("fma");
+  line (1);
+  for (i = 0; i < NTEST; i++)
+    {
+      a = rand_exp (-300, 300);
+      b = rand_exp (-300, 300);
+      switch (i % 4)
+	{
+	case 0:
+	  c = rand_exp (-300, 300);
+	  break;
+	case 1:
+	  c = -(a * b);
+	  break;
+	case 2:
+	  c = asdouble (asuint64 (-(a * b)) + rand32 () % 16 - 8);
+	  break;
+	default:
+	  c = ldexp (rand_exp (0, 0), ilogb (a * b) - rand32 () % 110);
+	  break;
+	}
+      check_fma (a, b, c);
+    }
+
+  /* Every mantissa of x in [1, 2), with y close to 1 / x so that the
+     double sum often lands on a float tie.  */
+  newfunc ("fmaf");
+  line (1);
+  for (i = 0; i < 1 << 23; i++)
+    {
+      af = asfloat (0x3f800000 | i);
+      bf = 1.0f / af;
+      check_fmaf (af, bf, i & 1 ? 0x1p24f : -0x1p25f);
+    }
+  for (i = 0; i < NTEST; i++)
+    {
+      af = rand_exp (-60, 60);
+      bf = rand_exp (-60, 60);
+      cf = i & 1 ? (float) rand_exp (-120, 120) : -(af * bf);
+      check_fmaf (af, bf, cf);
+    }
+
+  newfunc ("fmod");
+  line (1);
+  for (i = 0; i < NTEST; i++)
+    {
+      a = rand_exp (-1074 + 52, 1023);
+      b = i & 1 ? rand_exp (-1074 + 52, 1023) : rand_exp (-8, 8);
+      check_fmod (a, b);
+    }
+  for (i = 0; i < NTEST; i++)
+    check_fmod (rand_exp (-20, 100), ldexp (rand_exp (0, 0), -1074 + 52)
+					 * (rand32 () % 1000 + 1));
+
+  /* Every mantissa of x in [2^20, 2^21).  */
+  newfunc ("fmodf");
+  line (1);
+  for (i = 0; i < 1 << 23; i++)
+    check_fmodf (asfloat (0x49800000 | i), 1.0f + (float) (i % 977) / 977);
+  for (i = 0; i < NTEST; i++)
+    check_fmodf (asfloat (rand32 () & 0xff7fffff),
+		 asfloat (rand32 () & 0xff7fffff));
+
+  /* The squares in check_hypot must not overflow or underflow.  Scaling
+     the arguments by a power of 2 scales normal results exactly.  */
+  newfunc ("hypot");
+  line (1);
+  for (i = 0; i < NTEST; i++)
+    {
+      a = rand_exp (-400, 400);
+      b = i & 1 ? a * rand_exp (-30, 0) : rand_exp (-400, 400);
+      check_hypot (a, b);
+      c = hypot (a, b);
+      if ((hypot (ldexp (a, 600), ldexp (b, 600)) != ldexp (c, 600)
+	   || hypot (ldexp (a, -600), ldexp (b, -600)) != ldexp (c, -600))
+	  && inacc++ < 20)
+	printf ("hypot, wrong answer for %a %a scaled by 2^600 or 2^-600\n",
+		a, b);
+    }
+
+  line (2);
+  test_mok (fma (0x1.0000000000001p-537, 0x1p-537, 0.0), 0x1p-1074, 64);
+  test_mok (fma (0x1.8p-537, 0x1p-537, 0.0), 0x1p-1073, 64);
+  test_mok (fma (-0x1p-600, 0x1p-600, 0x1p-1074), 0x1p-1074, 64);
+  test_mok (fma (0x1p-1022, -0x1p-1, 0x1p-1022), 0x1p-1023, 64);
+  test_mok (fma (1.0 + 0x1p-52, 1.0 - 0x1p-52, -1.0), -0x1p-104, 64);
+  test_mok (fma (0x1p1000, 0x1p100, -INFINITY), -INFINITY, 64);
+  test_mok (fmaf (1.0f + 0x1p-23f, 1.0f - 0x1p-23f, -1.0f), -0x1p-46, 32);
+  test_mok (fmod (0x1p1023, 0x1p-1074), 0.0, 64);
+  test_mok (fmod (-0x1.fffffffffffffp1023, 3.0), -2.0, 64);
+  test_mok (fmod (5.5, -2.0), 1.5, 64);
+  test_mok (fmodf (-0x1p127f, 3.0f), -2.0, 32);
+  test_mok (hypot (3.0, 4.0), 5.0, 64);
+  test_mok (hypot (0x1p-1074, 0x1p-1074), 0x1p-1074, 64);
+  test_mok (hypot (0x1.6a09e667f3bccp1023, 0x1.6a09e667f3bccp1023),
+	    0x1.fffffffffffffp1023, 64);
+  test_mok (hypotf (3.0f, -4.0f), 5.0, 32);
+  line (3);
+  test_iok (signbit (fma (1.0, -0.0, 0.0)) == 0
+	    && signbit (fma (-0x1p-600, 0x1p-600, -0.0)) != 0
+	    && signbit (fma (1.0, 1.0, -1.0)) == 0, 1);
+  test_iok (isinf (fma (0x1p1000, 0x1p100, 0.0))
+	    && isnan (fma (INFINITY, 0.0, 1.0))
+	    && isinf (fmaf (0x1p100f, 0x1p100f, 1.0f)), 1);
+  test_iok (isnan (fmod (INFINITY, 1.0)) && isnan (fmod (1.0, 0.0))
+	    && fmod (1.0, INFINITY) == 1.0 && isnan (fmodf (1.0f, 0.0f))
+	    && signbit (fmod (-3.0, 1.5)) != 0, 1);
+  test_iok (isinf (hypot (NAN, INFINITY)) && isinf (hypotf (-INFINITY, NAN))
+	    && isnan (hypot (NAN, 1.0)) && isinf (hypot (0x1.8p1023, 0x1.8p1023))
+	    && isinf (hypotf (0x1.8p127f, 0x1.8p127f)), 1);
+
+  for (k = 0; k < sizeof (funcs) / sizeof (funcs[0]); k++)
+    {
+      for (i = 0; i < NBENCH; i++)
+	x[i] = rand_exp (-1, 3);
+      t = clock ();
+      for (j = 0; j < BENCH_LOOPS; j++)
+	for (i = 0; i < NBENCH; i++)
+	  y[i] = funcs[k].func (x[i]);
+      t = clock () - t;
+      printf ("%-8s: %.3f s\n", funcs[k].name, (double) t / CLOCKS_PER_SEC);
+    }
+  for (k = 0; k < sizeof (funcsf) / sizeof (funcsf[0]); k++)
+    {
+      for (i = 0; i < NBENCH; i++)
+	xf[i] = rand_exp (-1, 3);
+      t = clock ();
+      for (j = 0; j < BENCH_LOOPS; j++)
+	for (i = 0; i < NBENCH; i++)
+	  yf[i] = funcsf[k].func (xf[i]);
+      t = clock () - t;
+      printf ("%-8s: %.3f s\n", funcsf[k].name, (double) t / CLOCKS_PER_SEC);
+    }
+}
@@ -0,0 +1,307 @@
+#define _GNU_SOURCE
+#include "test.h"
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+/* Check tgamma, lgamma, erf, erfc and their float variants, and compare
+   the speed of tgamma and lgamma with the fdlibm code they replaced.
+   s_erf.c and sf_erf.c are no longer built, so erf and erfc are checked
+   against each other.  */
+
+extern int inacc;
+extern double __ieee754_lgamma_r (double, int *);
+extern double __ieee754_gamma_r (double, int *);
+extern float __ieee754_lgammaf_r (float, int *);
+extern float __ieee754_gammaf_r (float, int *);
+
+#define NTEST 200000
+#define NBENCH 1024
+#define BENCH_LOOPS 1000
+
+static double
+fdlibm_tgamma (double x)
+{
+  int sign;
+  double y = __ieee754_gamma_r (x, &sign);
+
+  return sign < 0 ? -y : y;
+}
+
+static double
+fdlibm_lgamma (double x)
+{
+  int sign;
+
+  return __ieee754_lgamma_r (x, &sign);
+}
+
+static float
+fdlibm_tgammaf (float x)
+{
+  int sign;
+  float y = __ieee754_gammaf_r (x, &sign);
+
+  return sign < 0 ? -y : y;
+}
+
+static float
+fdlibm_lgammaf (float x)
+{
+  int sign;
+
+  return __ieee754_lgammaf_r (x, &sign);
+}
+
+static float
+tgammaf_ref (float x)
+{
+  return tgamma (x);
+}
+
+static float
+lgammaf_ref (float x)
+{
+  return lgamma (x);
+}
+
+static float
+erff_ref (float x)
+{
+  return erf (x);
+}
+
+static float
+erfcf_ref (float x)
+{
+  return erfc (x);
+}
+
+typedef struct
+{
+  const char *name;
+  double (*func) (double);
+  double (*fdlibm) (double);
+  double lo, hi;
+} gammaerf_func_type;
+
+typedef struct
+{
+  const char *name;
+  float (*func) (float);
+  float (*ref) (float);
+  float (*fdlibm) (float);
+  float lo, hi;
+} gammaerff_func_type;
+
+static const gammaerf_func_type funcs[] =
+{
+  {"tgamma", tgamma, fdlibm_tgamma, 1, 10},
+  {"tgamma", tgamma, fdlibm_tgamma, -10, 10},
+  {"lgamma", lgamma, fdlibm_lgamma, 0.5, 10},
+  {"lgamma", lgamma, fdlibm_lgamma, 10, 1000},
+  {"erf", erf, NULL, -6, 6},
+  {"erfc", erfc, NULL, -6, 26},
+};
+
+static const gammaerff_func_type funcsf[] =
+{
+  {"tgammaf", tgammaf, tgammaf_ref, fdlibm_tgammaf, -10, 35},
+  {"lgammaf", lgammaf, lgammaf_ref, fdlibm_lgammaf, 0.5, 1000},
+  {"erff", erff, erff_ref, NULL, -4, 4},
+  {"erfcf", erfcf, erfcf_ref, NULL, -4, 10},
+};
+
+static unsigned int seed = 1;
+
+static double
+rand_in (double lo, double hi)
+{
+  seed = seed * 1103515245 + 12345;
+  return lo + (hi - lo) * ((seed >> 8) / (double) (1 << 24));
+}
+
+static int64_t
+ulp_dist (double a, double b)
+{
+  int64_t ia, ib, d;
+
+  memcpy (&ia, &a, sizeof (a));
+  memcpy (&ib, &b, sizeof (b));
+  if (ia < 0)
+    ia = INT64_MIN - ia;
+  if (ib < 0)
+    ib = INT64_MIN - ib;
+  d = ia - ib;
+  return d < 0 ? -d : d;
+}
+
+static int32_t
+ulp_distf (float a, float b)
+{
+  int32_t ia, ib, d;
+
+  memcpy (&ia, &a, sizeof (a));
+  memcpy (&ib, &b, sizeof (b));
+  if (ia < 0)
+    ia = INT32_MIN - ia;
+  if (ib < 0)
+    ib = INT32_MIN - ib;
+  d = ia - ib;
+  return d < 0 ? -d : d;
+}
+
+void
+test_gammaerf (void)
+{
+  static double x[NBENCH], y[NBENCH];
+  static float xf[NBENCH], yf[NBENCH];
+  unsigned int i, k;
+  clock_t t, tf;
+  int j, sign;
+
+  /* The new functions are within 1 ULP, and the random arguments have
+     24 bits, so x + 1 is exact and gamma (x + 1) = x * gamma (x) holds
+     to 2 ULP.  */
+  newfunc ("tgamma");
+  line (1);
+  for (i = 0; i < NTEST; i++)
+    {
+      double v = rand_in (-10, 10);
+
+      if (v == floor (v))
+	continue;
+      if (ulp_dist (tgamma (v + 1), v * tgamma (v)) > 2 && inacc++ < 20)
+	printf ("tgamma, wrong answer for %a: %a should be %a\n",
+		v + 1, tgamma (v + 1), v * tgamma (v));
+    }
+
+  /* fdlibm lgamma is within 3 ULP on this range.  */
+  newfunc ("lgamma");
+  line (1);
+  for (i = 0; i < NTEST; i++)
+    {
+      double v = rand_in (0.5, 1000);
+      double is = lgamma (v), shouldbe = fdlibm_lgamma (v);
+
+      if (ulp_dist (is, shouldbe) > 3 && inacc++ < 20)
+	printf ("lgamma, wrong answer for %a: %a should be %a\n",
+		v, is, shouldbe);
+    }
+
+  /* erf (x) = 1 - erfc (x) where the subtraction does not cancel.  */
+  newfunc ("erf");
+  line (1);
+  for (i = 0; i < NTEST; i++)
+    {
+      double v = rand_in (-0.5, 6);
+
+      if (v < 0.5 && ulp_dist (erfc (v), 1.0 - erf (v)) > 2 && inacc++ < 20)
+	printf ("erfc, wrong answer for %a: %a should be %a\n",
+		v, erfc (v), 1.0 - erf (v));
+      if (v >= 0.5 && ulp_dist (erf (v), 1.0 - erfc (v)) > 2 && inacc++ < 20)
+	printf ("erf, wrong answer for %a: %a should be %a\n",
+		v, erf (v), 1.0 - erfc (v));
+    }
+
+  /* The float variants round to within 1 ULP of the correctly rounded
+     result.  */
+  for (k = 0; k < sizeof (funcsf) / sizeof (funcsf[0]); k++)
+    {
+      newfunc (funcsf[k].name);
+      line (1);
+      for (i = 0; i < NTEST; i++)
+	{
+	  float v = rand_in (funcsf[k].lo, funcsf[k].hi);
+	  float is, shouldbe;
+
+	  if (v <= 0 && v == floorf (v))
+	    continue;
+	  is = funcsf[k].func (v);
+	  shouldbe = funcsf[k].ref (v);
+	  if (ulp_distf (is, shouldbe) > 1 && inacc++ < 20)
+	    printf ("%s, wrong answer for %a: %a should be %a\n",
+		    funcsf[k].name, v, is, shouldbe);
+	}
+    }
+
+  line (2);
+  test_mok (tgamma (1.0), 1.0, 64);
+  test_mok (tgamma (5.0), 24.0, 64);
+  test_mok (tgamma (0.5), sqrt (M_PI), 50);
+  test_mok (tgamma (-0.5), -2 * sqrt (M_PI), 50);
+  test_mok (lgamma (1.0), 0.0, 64);
+  test_mok (lgamma (2.0), 0.0, 64);
+  test_mok (lgamma (0.5), log (sqrt (M_PI)), 50);
+  test_mok (erf (0.0), 0.0, 64);
+  test_mok (erf (INFINITY), 1.0, 64);
+  test_mok (erfc (-INFINITY), 2.0, 64);
+  test_mok (erfc (INFINITY), 0.0, 64);
+  test_mok (tgammaf (4.0f), 6.0, 32);
+  test_mok (lgammaf (1.0f), 0.0, 32);
+  test_mok (erff (-INFINITY), -1.0, 32);
+  test_mok (erfcf (0.0f), 1.0, 32);
+  line (3);
+  test_iok (isnan (tgamma (-1.0)) && isnan (tgamma (-INFINITY))
+	    && isnan (tgammaf (-2.0f)) && isinf (tgamma (200.0))
+	    && isinf (tgammaf (40.0f)), 1);
+  test_iok (isinf (tgamma (0.0)) && signbit (tgamma (-0.0))
+	    && tgamma (-200.5) == 0.0, 1);
+  test_iok (isinf (lgamma (0.0)) && isinf (lgamma (-3.0))
+	    && isinf (lgamma (-INFINITY)) && isinf (lgammaf (-2.0f)), 1);
+  lgamma_r (-0.5, &sign);
+  test_iok (sign, -1);
+  lgamma_r (-1.5, &sign);
+  test_iok (sign, 1);
+  test_iok (signbit (erf (-0.0)) && signbit (erff (-0.0f))
+	    && erfc (30.0) == 0.0 && erfcf (20.0f) == 0.0f, 1);
+
+  for (k = 0; k < sizeof (funcs) / sizeof (funcs[0]); k++)
+    {
+      for (i = 0; i < NBENCH; i++)
+	x[i] = rand_in (funcs[k].lo, funcs[k].hi);
+      t = clock ();
+      for (j = 0; j < BENCH_LOOPS; j++)
+	for (i = 0; i < NBENCH; i++)
+	  y[i] = funcs[k].func (x[i]);
+      t = clock () - t;
+      if (funcs[k].fdlibm == NULL)
+	{
+	  printf ("%-7s [%g, %g]: %.3f s\n", funcs[k].name, funcs[k].lo,
+		  funcs[k].hi, (double) t / CLOCKS_PER_SEC);
+	  continue;
+	}
+      tf = clock ();
+      for (j = 0; j < BENCH_LOOPS; j++)
+	for (i = 0; i < NBENCH; i++)
+	  y[i] = funcs[k].fdlibm (x[i]);
+      tf = clock () - tf;
+      printf ("%-7s [%g, %g]: %.3f s, fdlibm %.3f s\n", funcs[k].name,
+	      funcs[k].lo, funcs[k].hi, (double) t / CLOCKS_PER_SEC,
+	      (double) tf / CLOCKS_PER_SEC);
+    }
+  for (k = 0; k < sizeof (funcsf) / sizeof (funcsf[0]); k++)
+    {
+      for (i = 0; i < NBENCH; i++)
+	xf[i] = rand_in (funcsf[k].lo, funcsf[k].hi);
+      t = clock ();
+      for (j = 0; j < BENCH_LOOPS; j++)
+	for (i = 0; i < NBENCH; i++)
+	  yf[i] = funcsf[k].func (xf[i]);
+      t = clock () - t;
+      if (funcsf[k].fdlibm == NULL)
+	{
+	  printf ("%-7s [%g, %g]: %.3f s\n", funcsf[k].name, funcsf[k].lo,
+		  funcsf[k].hi, (double) t / CLOCKS_PER_SEC);
+	  continue;
+	}
+      tf = clock ();
+      for (j = 0; j < BENCH_LOOPS; j++)
+	for (i = 0; i < NBENCH; i++)
+	  yf[i] = funcsf[k].fdlibm (xf[i]);
+      tf = clock () - tf;
+      printf ("%-7s [%g, %g]: %.3f s, fdlibm %.3f s\n", funcsf[k].name,
+	      funcsf[k].lo, funcsf[k].hi, (double) t / CLOCKS_PER_SEC,
+	      (double) tf / CLOCKS_PER_SEC);
+    }
+}
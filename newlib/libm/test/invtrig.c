@@ -0,0 +1,314 @@
+#define _GNU_SOURCE
+#include "test.h"
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+/* Compare atan, atan2, asin, acos, sinh, cosh, tanh and their float
+   variants with the fdlibm code they replaced, and report the speed of
+   both.  The float variants are checked against the double functions.  */
+
+extern int inacc;
+extern double __ieee754_atan2 (double, double);
+extern double __ieee754_asin (double);
+extern double __ieee754_acos (double);
+extern double __ieee754_sinh (double);
+extern double __ieee754_cosh (double);
+extern float __ieee754_atan2f (float, float);
+extern float __ieee754_asinf (float);
+extern float __ieee754_acosf (float);
+extern float __ieee754_sinhf (float);
+extern float __ieee754_coshf (float);
+
+#define NTEST 200000
+#define NBENCH 1024
+#define BENCH_LOOPS 500
+
+/* s_atan.c and s_tanh.c are no longer built, so use the identities they
+   are based on.  */
+static double
+fdlibm_atan (double x)
+{
+  return __ieee754_atan2 (x, 1.0);
+}
+
+static double
+fdlibm_tanh (double x)
+{
+  double t;
+
+  if (fabs (x) >= 22.0)
+    return x > 0 ? 1.0 : -1.0;
+  t = expm1 (2.0 * fabs (x));
+  return x > 0 ? t / (t + 2.0) : -t / (t + 2.0);
+}
+
+static double
+atan2_1 (double x)
+{
+  return atan2 (x, -0.75);
+}
+
+static double
+fdlibm_atan2_1 (double x)
+{
+  return __ieee754_atan2 (x, -0.75);
+}
+
+static float
+atanf_ref (float x)
+{
+  return atan (x);
+}
+
+static float
+asinf_ref (float x)
+{
+  return asin (x);
+}
+
+static float
+acosf_ref (float x)
+{
+  return acos (x);
+}
+
+static float
+sinhf_ref (float x)
+{
+  return sinh (x);
+}
+
+static float
+coshf_ref (float x)
+{
+  return cosh (x);
+}
+
+static float
+tanhf_ref (float x)
+{
+  return tanh (x);
+}
+
+static float
+atan2f_1 (float x)
+{
+  return atan2f (x, -0.75f);
+}
+
+static float
+atan2f_1_ref (float x)
+{
+  return atan2 (x, -0.75);
+}
+
+static float
+fdlibm_atan2f_1 (float x)
+{
+  return __ieee754_atan2f (x, -0.75f);
+}
+
+static float
+fdlibm_atanf (float x)
+{
+  return __ieee754_atan2f (x, 1.0f);
+}
+
+typedef struct
+{
+  const char *name;
+  double (*func) (double);
+  double (*fdlibm) (double);
+  double lo, hi;
+} invtrig_func_type;
+
+typedef struct
+{
+  const char *name;
+  float (*func) (float);
+  float (*ref) (float);
+  float (*fdlibm) (float);
+  float lo, hi;
+} invtrigf_func_type;
+
+static const invtrig_func_type funcs[] =
+{
+  {"atan", atan, fdlibm_atan, -100, 100},
+  {"atan2", atan2_1, fdlibm_atan2_1, -100, 100},
+  {"asin", asin, __ieee754_asin, -1, 1},
+  {"acos", acos, __ieee754_acos, -1, 1},
+  {"sinh", sinh, __ieee754_sinh, -30, 30},
+  {"cosh", cosh, __ieee754_cosh, -30, 30},
+  {"tanh", tanh, fdlibm_tanh, -10, 10},
+};
+
+static const invtrigf_func_type funcsf[] =
+{
+  {"atanf", atanf, atanf_ref, fdlibm_atanf, -100, 100},
+  {"atan2f", atan2f_1, atan2f_1_ref, fdlibm_atan2f_1, -100, 100},
+  {"asinf", asinf, asinf_ref, __ieee754_asinf, -1, 1},
+  {"acosf", acosf, acosf_ref, __ieee754_acosf, -1, 1},
+  {"sinhf", sinhf, sinhf_ref, __ieee754_sinhf, -30, 30},
+  {"coshf", coshf, coshf_ref, __ieee754_coshf, -30, 30},
+  {"tanhf", tanhf, tanhf_ref, NULL, -10, 10},
+};
+
+static unsigned int seed = 1;
+
+static double
+rand_in (double lo, double hi)
+{
+  seed = seed * 1103515245 + 12345;
+  return lo + (hi - lo) * ((seed >> 8) / (double) (1 << 24));
+}
+
+static int64_t
+ulp_dist (double a, double b)
+{
+  int64_t ia, ib, d;
+
+  memcpy (&ia, &a, sizeof (a));
+  memcpy (&ib, &b, sizeof (b));
+  if (ia < 0)
+    ia = INT64_MIN - ia;
+  if (ib < 0)
+    ib = INT64_MIN - ib;
+  d = ia - ib;
+  return d < 0 ? -d : d;
+}
+
+static int32_t
+ulp_distf (float a, float b)
+{
+  int32_t ia, ib, d;
+
+  memcpy (&ia, &a, sizeof (a));
+  memcpy (&ib, &b, sizeof (b));
+  if (ia < 0)
+    ia = INT32_MIN - ia;
+  if (ib < 0)
+    ib = INT32_MIN - ib;
+  d = ia - ib;
+  return d < 0 ? -d : d;
+}
+
+void
+test_invtrig (void)
+{
+  static double x[NBENCH], y[NBENCH];
+  static float xf[NBENCH], yf[NBENCH];
+  unsigned int i, k;
+  clock_t t, tf;
+  int j;
+
+  /* fdlibm is within 2 ULP for all of these and the new code within
+     1 ULP, so they differ by 2 ULP at most.  */
+  for (k = 0; k < sizeof (funcs) / sizeof (funcs[0]); k++)
+    {
+      newfunc (funcs[k].name);
+      line (1);
+      for (i = 0; i < NTEST; i++)
+	{
+	  double v = rand_in (funcs[k].lo, funcs[k].hi);
+	  double is = funcs[k].func (v), shouldbe = funcs[k].fdlibm (v);
+
+	  if (ulp_dist (is, shouldbe) > 2 && inacc++ < 20)
+	    printf ("%s, wrong answer for %a: %a should be %a\n",
+		    funcs[k].name, v, is, shouldbe);
+	}
+    }
+
+  /* The float variants round to within 1 ULP of the correctly rounded
+     result.  */
+  for (k = 0; k < sizeof (funcsf) / sizeof (funcsf[0]); k++)
+    {
+      newfunc (funcsf[k].name);
+      line (1);
+      for (i = 0; i < NTEST; i++)
+	{
+	  float v = rand_in (funcsf[k].lo, funcsf[k].hi);
+	  float is = funcsf[k].func (v), shouldbe = funcsf[k].ref (v);
+
+	  if (ulp_distf (is, shouldbe) > 1 && inacc++ < 20)
+	    printf ("%s, wrong answer for %a: %a should be %a\n",
+		    funcsf[k].name, v, is, shouldbe);
+	}
+    }
+
+  newfunc ("atan2");
+  line (2);
+  for (i = 0; i < NTEST; i++)
+    {
+      double a = rand_in (-10, 10), b = rand_in (-10, 10);
+
+      if (ulp_dist (atan2 (a, b), __ieee754_atan2 (a, b)) > 2)
+	inacc++;
+      if (ulp_distf (atan2f (a, b), (float) atan2 ((float) a, (float) b)) > 1)
+	inacc++;
+    }
+  line (3);
+  test_mok (atan2 (-0.0, -0.0), -M_PI, 64);
+  test_mok (atan2 (0.0, -1.0), M_PI, 64);
+  test_mok (atan2 (-INFINITY, INFINITY), -M_PI_4, 64);
+  test_mok (atan2 (INFINITY, -INFINITY), 3 * M_PI_4, 64);
+  test_mok (atan2 (0x1p-1074, 0x1p1023), 0.0, 64);
+  test_mok (atan2 (0x1p1023, 0x1p-1074), M_PI_2, 64);
+  test_mok (atan2f (-0.0f, -0.0f), (float) -M_PI, 32);
+  test_mok (atan2f (INFINITY, -INFINITY), (float) (3 * M_PI_4), 32);
+  line (4);
+  test_mok (asin (1.0), M_PI_2, 64);
+  test_mok (acos (-1.0), M_PI, 64);
+  test_mok (acosf (1.0f), 0.0, 32);
+  test_mok (atan (-INFINITY), -M_PI_2, 64);
+  test_mok (tanh (-INFINITY), -1.0, 64);
+  test_mok (tanhf (INFINITY), 1.0, 32);
+  test_mok (cosh (-0.0), 1.0, 64);
+  line (5);
+  test_iok (isnan (asin (1.5)) && isnan (acos (-1.5)) && isnan (asinf (2.0f))
+	    && isnan (acosf (NAN)) && isnan (atan2 (NAN, 1.0)), 1);
+  test_iok (isinf (sinh (1000.0)) && sinh (-1000.0) < 0
+	    && isinf (cosh (-1000.0)) && isinf (sinhf (100.0f))
+	    && isinf (coshf (-100.0f)), 1);
+  test_iok (signbit (atan (-0.0)) && signbit (sinh (-0.0))
+	    && signbit (tanh (-0.0)) && signbit (asinf (-0.0f)), 1);
+
+  for (k = 0; k < sizeof (funcs) / sizeof (funcs[0]); k++)
+    {
+      for (i = 0; i < NBENCH; i++)
+	x[i] = rand_in (funcs[k].lo, funcs[k].hi);
+      t = clock ();
+      for (j = 0; j < BENCH_LOOPS; j++)
+	for (i = 0; i < NBENCH; i++)
+	  y[i] = funcs[k].func (x[i]);
+      t = clock () - t;
+      tf = clock ();
+      for (j = 0; j < BENCH_LOOPS; j++)
+	for (i = 0; i < NBENCH; i++)
+	  y[i] = funcs[k].fdlibm (x[i]);
+      tf = clock () - tf;
+      printf ("%-6s [%g, %g]: %.3f s, fdlibm %.3f s\n", funcs[k].name,
+	      funcs[k].lo, funcs[k].hi, (double) t / CLOCKS_PER_SEC,
+	      (double) tf / CLOCKS_PER_SEC);
+    }
+  for (k = 0; k < sizeof (funcsf) / sizeof (funcsf[0]); k++)
+    {
+      if (funcsf[k].fdlibm == NULL)
+	continue;
+      for (i = 0; i < NBENCH; i++)
+	xf[i] = rand_in (funcsf[k].lo, funcsf[k].hi);
+      t = clock ();
+      for (j = 0; j < BENCH_LOOPS; j++)
+	for (i = 0; i < NBENCH; i++)
+	  yf[i] = funcsf[k].func (xf[i]);
+      t = clock () - t;
+      tf = clock ();
+      for (j = 0; j < BENCH_LOOPS; j++)
+	for (i = 0; i < NBENCH; i++)
+	  yf[i] = funcsf[k].fdlibm (xf[i]);
+      tf = clock () - tf;
+      printf ("%-6s [%g, %g]: %.3f s, fdlibm %.3f s\n", funcsf[k].name,
+	      funcsf[k].lo, funcsf[k].hi, (double) t / CLOCKS_PER_SEC,
+	      (double) tf / CLOCKS_PER_SEC);
+    }
+}
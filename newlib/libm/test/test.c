@@ -19,6 +19,13 @@ main (int ac,
   int math= 1;
   int cvt = 1;
   int ieee= 1;
+  int vec = 1;
+  int trig = 1;
+  int invtrig = 1;
+  int gammaerf = 1;
+  int fmahypot = 1;
+  int cmplx = 1;
+  int fenv = 1;
 bt();
   for (i = 1; i < ac; i++) 
   {
@@ -36,6 +43,20 @@ bt();
      cvt = 0;
     if (strcmp(av[i],"-noiee") == 0)
      ieee= 0;
+    if (strcmp(av[i],"-novec") == 0)
+     vec = 0;
+    if (strcmp(av[i],"-notrig") == 0)
+     trig = 0;
+    if (strcmp(av[i],"-noinvtrig") == 0)
+     invtrig = 0;
+    if (strcmp(av[i],"-nogammaerf") == 0)
+     gammaerf = 0;
+    if (strcmp(av[i],"-nofmahypot") == 0)
+     fmahypot = 0;
+    if (strcmp(av[i],"-nocomplex") == 0)
+     cmplx = 0;
+    if (strcmp(av[i],"-nofenv") == 0)
+     fenv = 0;
   }
   if (cvt)
    test_cvt();
@@ -49,6 +70,20 @@ bt();
   if (is)
    test_is();
   if (ieee)  test_ieee();
+  if (vec)
+   test_vecmath();
+  if (trig)
+   test_trig();
+  if (invtrig)
+   test_invtrig();
+  if (gammaerf)
+   test_gammaerf();
+  if (fmahypot)
+   test_fmahypot();
+  if (cmplx)
+   test_complex();
+  if (fenv)
+   test_fenv();
   printf("Tested %d functions, %d errors detected\n", count, inacc);
   return 0;
 }
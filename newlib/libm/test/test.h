@@ -134,6 +134,13 @@ void test_math (void);
 void test_string (void);
 void test_is (void);
 void test_cvt (void);
+void test_vecmath (void);
+void test_trig (void);
+void test_invtrig (void);
+void test_gammaerf (void);
+void test_fmahypot (void);
+void test_complex (void);
+void test_fenv (void);
 
 void line (int);
 
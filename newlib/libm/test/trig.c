@@ -0,0 +1,191 @@
+#define _GNU_SOURCE
+#include "test.h"
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+/* Compare sin, cos, sincos and tan with the fdlibm argument reduction and
+   kernels they used before, and report the speed of both.  */
+
+extern int inacc;
+extern int __ieee754_rem_pio2 (double, double *);
+extern double __kernel_sin (double, double, int);
+extern double __kernel_cos (double, double);
+extern double __kernel_tan (double, double, int);
+
+#define NTEST 200000
+#define NBENCH 1024
+#define BENCH_LOOPS 500
+
+static double
+fdlibm_trig (double x, int f)
+{
+  double y[2];
+  int n;
+
+  if (fabs (x) <= 0x1.921fb54442d18p-1)
+    {
+      y[0] = x;
+      y[1] = 0.0;
+      n = 0;
+    }
+  else
+    n = __ieee754_rem_pio2 (x, y);
+  if (f == 2)
+    return __kernel_tan (y[0], y[1], 1 - ((n & 1) << 1));
+  switch ((n + f) & 3)
+    {
+    case 0:
+      return __kernel_sin (y[0], y[1], 1);
+    case 1:
+      return __kernel_cos (y[0], y[1]);
+    case 2:
+      return -__kernel_sin (y[0], y[1], 1);
+    default:
+      return -__kernel_cos (y[0], y[1]);
+    }
+}
+
+static double
+fdlibm_sin (double x)
+{
+  return fdlibm_trig (x, 0);
+}
+
+static double
+fdlibm_cos (double x)
+{
+  return fdlibm_trig (x, 1);
+}
+
+static double
+fdlibm_tan (double x)
+{
+  return fdlibm_trig (x, 2);
+}
+
+static double
+sincos_sum (double x)
+{
+  double s, c;
+
+  sincos (x, &s, &c);
+  return s + c;
+}
+
+static double
+fdlibm_sincos_sum (double x)
+{
+  return fdlibm_sin (x) + fdlibm_cos (x);
+}
+
+typedef struct
+{
+  const char *name;
+  double (*func) (double);
+  double (*fdlibm) (double);
+} trig_func_type;
+
+static const trig_func_type funcs[] =
+{
+  {"sin", sin, fdlibm_sin},
+  {"cos", cos, fdlibm_cos},
+  {"tan", tan, fdlibm_tan},
+  {"sincos", sincos_sum, fdlibm_sincos_sum},
+};
+
+static const double ranges[][2] =
+{
+  {-0.78, 0.78}, {-10, 10}, {-1e6, 1e6}, {-1e20, 1e20}
+};
+
+static unsigned int seed = 1;
+
+static double
+rand_in (double lo, double hi)
+{
+  seed = seed * 1103515245 + 12345;
+  return lo + (hi - lo) * ((seed >> 8) / (double) (1 << 24));
+}
+
+static int64_t
+ulp_dist (double a, double b)
+{
+  int64_t ia, ib, d;
+
+  memcpy (&ia, &a, sizeof (a));
+  memcpy (&ib, &b, sizeof (b));
+  if (ia < 0)
+    ia = INT64_MIN - ia;
+  if (ib < 0)
+    ib = INT64_MIN - ib;
+  d = ia - ib;
+  return d < 0 ? -d : d;
+}
+
+void
+test_trig (void)
+{
+  static double x[NBENCH], y[NBENCH];
+  unsigned int i, k, r;
+  double s, c;
+  clock_t t, tf;
+  int j;
+
+  /* Both are within 1 ULP of sin, cos and tan.  */
+  for (k = 0; k < 3; k++)
+    {
+      newfunc (funcs[k].name);
+      for (r = 0; r < sizeof (ranges) / sizeof (ranges[0]); r++)
+	{
+	  line (r);
+	  for (i = 0; i < NTEST; i++)
+	    {
+	      double v = rand_in (ranges[r][0], ranges[r][1]);
+	      double is = funcs[k].func (v), shouldbe = funcs[k].fdlibm (v);
+
+	      if (ulp_dist (is, shouldbe) > 1 && inacc++ < 20)
+		printf ("%s:%d, wrong answer for %a: %a should be %a\n",
+			funcs[k].name, r, v, is, shouldbe);
+	    }
+	}
+    }
+
+  newfunc ("sincos");
+  line (1);
+  for (i = 0; i < NTEST; i++)
+    {
+      double v = rand_in (-1e6, 1e6);
+
+      sincos (v, &s, &c);
+      if (s != sin (v) || c != cos (v))
+	inacc++;
+    }
+  line (2);
+  sincos (-0.0, &s, &c);
+  test_mok (s, -0.0, 64);
+  test_mok (c, 1.0, 64);
+  line (3);
+  test_iok (isnan (sin (INFINITY)) && isnan (cos (-INFINITY))
+	    && isnan (tan (NAN)), 1);
+
+  for (r = 0; r < sizeof (ranges) / sizeof (ranges[0]); r++)
+    for (k = 0; k < sizeof (funcs) / sizeof (funcs[0]); k++)
+      {
+	for (i = 0; i < NBENCH; i++)
+	  x[i] = rand_in (ranges[r][0], ranges[r][1]);
+	t = clock ();
+	for (j = 0; j < BENCH_LOOPS; j++)
+	  for (i = 0; i < NBENCH; i++)
+	    y[i] = funcs[k].func (x[i]);
+	t = clock () - t;
+	tf = clock ();
+	for (j = 0; j < BENCH_LOOPS; j++)
+	  for (i = 0; i < NBENCH; i++)
+	    y[i] = funcs[k].fdlibm (x[i]);
+	tf = clock () - tf;
+	printf ("%-6s [%g, %g]: %.3f s, fdlibm %.3f s\n", funcs[k].name,
+		ranges[r][0], ranges[r][1], (double) t / CLOCKS_PER_SEC,
+		(double) tf / CLOCKS_PER_SEC);
+      }
+}
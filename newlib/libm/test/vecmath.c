@@ -0,0 +1,294 @@
+#include "test.h"
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+extern int inacc;
+
+/* Compare the vector variants of the math functions with the scalar
+   functions, lane by lane, and report the speed of both.  */
+
+#ifdef _HAVE_VECTOR_MATH
+
+typedef double vdouble __attribute__ ((vector_size (16)));
+typedef float vfloat __attribute__ ((vector_size (16)));
+
+#ifdef __x86_64__
+# define V_PCS
+# define V1(lanes, name) _ZGVbN##lanes##v_##name
+# define V2(lanes, name) _ZGVbN##lanes##vv_##name
+#else
+# define V_PCS __attribute__ ((__aarch64_vector_pcs__))
+# define V1(lanes, name) _ZGVnN##lanes##v_##name
+# define V2(lanes, name) _ZGVnN##lanes##vv_##name
+#endif
+
+V_PCS vdouble V1 (2, exp) (vdouble);
+V_PCS vdouble V1 (2, log) (vdouble);
+V_PCS vdouble V2 (2, pow) (vdouble, vdouble);
+V_PCS vdouble V1 (2, sin) (vdouble);
+V_PCS vdouble V1 (2, cos) (vdouble);
+V_PCS vfloat V1 (4, expf) (vfloat);
+V_PCS vfloat V1 (4, logf) (vfloat);
+V_PCS vfloat V2 (4, powf) (vfloat, vfloat);
+V_PCS vfloat V1 (4, sinf) (vfloat);
+V_PCS vfloat V1 (4, cosf) (vfloat);
+
+/* Wrappers with the usual calling convention.  */
+#define WRAP(type, lanes, name) \
+  static type w_##name (type x) { return V1 (lanes, name) (x); }
+
+WRAP (vdouble, 2, exp)
+WRAP (vdouble, 2, log)
+WRAP (vdouble, 2, sin)
+WRAP (vdouble, 2, cos)
+WRAP (vfloat, 4, expf)
+WRAP (vfloat, 4, logf)
+WRAP (vfloat, 4, sinf)
+WRAP (vfloat, 4, cosf)
+
+#define NTEST 200000
+#define NBENCH 1024
+#define BENCH_LOOPS 500
+
+/* The double variants get a second argument only for pow.  */
+static double pow_y;
+static vdouble vpow_y;
+
+static double
+s_pow1 (double x)
+{
+  return pow (x, pow_y);
+}
+
+static vdouble
+v_pow1 (vdouble x)
+{
+  return V2 (2, pow) (x, vpow_y);
+}
+
+static float
+s_powf1 (float x)
+{
+  return powf (x, (float) pow_y);
+}
+
+static vfloat
+v_powf1 (vfloat x)
+{
+  vfloat y = {pow_y, pow_y, pow_y, pow_y};
+  return V2 (4, powf) (x, y);
+}
+
+typedef struct
+{
+  const char *name;
+  double (*sfunc) (double);
+  vdouble (*vfunc) (vdouble);
+  float (*sfuncf) (float);
+  vfloat (*vfuncf) (vfloat);
+  double lo, hi;
+  int ulps;
+} vec_func_type;
+
+static const vec_func_type funcs[] =
+{
+  {"exp", exp, w_exp, 0, 0, -745, 710, 0},
+  {"log", log, w_log, 0, 0, 0, 4, 0},
+  {"log", log, w_log, 0, 0, 0, 1e300, 0},
+  {"pow", s_pow1, v_pow1, 0, 0, 0, 1000, 0},
+  {"sin", sin, w_sin, 0, 0, -10, 10, 1},
+  {"sin", sin, w_sin, 0, 0, -1e7, 1e7, 1},
+  {"cos", cos, w_cos, 0, 0, -10, 10, 1},
+  {"cos", cos, w_cos, 0, 0, -1e7, 1e7, 1},
+  {"expf", 0, 0, expf, w_expf, -104, 89, 0},
+  {"logf", 0, 0, logf, w_logf, 0, 4, 0},
+  {"logf", 0, 0, logf, w_logf, 0, 1e38, 0},
+  {"powf", 0, 0, s_powf1, v_powf1, 0, 1000, 0},
+  {"sinf", 0, 0, sinf, w_sinf, -10, 10, 1},
+  {"sinf", 0, 0, sinf, w_sinf, -200, 200, 1},
+  {"cosf", 0, 0, cosf, w_cosf, -10, 10, 1},
+  {"cosf", 0, 0, cosf, w_cosf, -200, 200, 1},
+};
+
+/* Lanes mixed with ordinary input.  */
+static const double specials[] =
+{
+  0.0, -0.0, 1.0, -1.0, 0x1p-1074, 0x1p-1022, 1e-300, 1e300, -1e300, 1000,
+  -1000, 710, -746, 1e10, 0x1p20, 0x1p30, 100, 120, 121, 1e38, 1e-40,
+  __builtin_inf (), -__builtin_inf (), __builtin_nan ("")
+};
+
+static unsigned int seed = 1;
+
+static double
+rand_in (double lo, double hi)
+{
+  seed = seed * 1103515245 + 12345;
+  return lo + (hi - lo) * ((seed >> 8) / (double) (1 << 24));
+}
+
+/* Distance in units in the last place, 0 if both are nan.  */
+static int64_t
+ulp_dist (double a, double b)
+{
+  int64_t ia, ib, d;
+
+  if (isnan (a) && isnan (b))
+    return 0;
+  memcpy (&ia, &a, sizeof (a));
+  memcpy (&ib, &b, sizeof (b));
+  if (ia < 0)
+    ia = INT64_MIN - ia;
+  if (ib < 0)
+    ib = INT64_MIN - ib;
+  d = ia - ib;
+  return d < 0 ? -d : d;
+}
+
+static int64_t
+ulp_distf (float a, float b)
+{
+  int32_t ia, ib;
+
+  if (isnan (a) && isnan (b))
+    return 0;
+  memcpy (&ia, &a, sizeof (a));
+  memcpy (&ib, &b, sizeof (b));
+  if (ia < 0)
+    ia = INT32_MIN - ia;
+  if (ib < 0)
+    ib = INT32_MIN - ib;
+  return ia > ib ? (int64_t) ia - ib : (int64_t) ib - ia;
+}
+
+static void
+check_lane (const vec_func_type *f, int i, double x, double is, double shouldbe,
+	    int64_t dist)
+{
+  if (dist > f->ulps)
+    {
+      if (inacc < 20)
+	printf ("%s:%d, wrong answer for %a: %a should be %a\n",
+		f->name, i, x, is, shouldbe);
+      inacc++;
+    }
+}
+
+static void
+test_func (const vec_func_type *f)
+{
+  int i, j;
+
+  newfunc (f->name);
+  line (__LINE__);
+  for (i = 0; i < NTEST; i++)
+    {
+      double x[4];
+
+      for (j = 0; j < 4; j++)
+	x[j] = rand_in (f->lo, f->hi);
+      if (i % 7 == 0)
+	x[i % 4] = specials[(i / 7) % (sizeof (specials) / sizeof (specials[0]))];
+      pow_y = rand_in (-8, 8);
+      if (i % 11 == 0)
+	pow_y = specials[(i / 11) % (sizeof (specials) / sizeof (specials[0]))];
+      vpow_y = (vdouble) {pow_y, pow_y};
+      if (f->vfunc)
+	{
+	  vdouble y = f->vfunc ((vdouble) {x[0], x[1]});
+
+	  for (j = 0; j < 2; j++)
+	    check_lane (f, i, x[j], y[j], f->sfunc (x[j]),
+			ulp_dist (y[j], f->sfunc (x[j])));
+	}
+      else
+	{
+	  vfloat y = f->vfuncf ((vfloat) {x[0], x[1], x[2], x[3]});
+
+	  for (j = 0; j < 4; j++)
+	    check_lane (f, i, (float) x[j], y[j], f->sfuncf (x[j]),
+			ulp_distf (y[j], f->sfuncf (x[j])));
+	}
+    }
+}
+
+static void
+bench_func (const vec_func_type *f)
+{
+  static double x[NBENCH], y[NBENCH];
+  static float xf[NBENCH], yf[NBENCH];
+  clock_t ts, tv;
+  int i, j;
+
+  for (i = 0; i < NBENCH; i++)
+    xf[i] = x[i] = rand_in (f->lo, f->hi);
+  pow_y = 1.5;
+  vpow_y = (vdouble) {pow_y, pow_y};
+
+  ts = clock ();
+  for (j = 0; j < BENCH_LOOPS; j++)
+    for (i = 0; i < NBENCH; i++)
+      if (f->sfunc)
+	y[i] = f->sfunc (x[i]);
+      else
+	yf[i] = f->sfuncf (xf[i]);
+  ts = clock () - ts;
+
+  tv = clock ();
+  for (j = 0; j < BENCH_LOOPS; j++)
+    if (f->vfunc)
+      for (i = 0; i < NBENCH; i += 2)
+	{
+	  vdouble v = f->vfunc ((vdouble) {x[i], x[i + 1]});
+	  memcpy (y + i, &v, sizeof (v));
+	}
+    else
+      for (i = 0; i < NBENCH; i += 4)
+	{
+	  vfloat v = f->vfuncf ((vfloat) {xf[i], xf[i + 1], xf[i + 2],
+					  xf[i + 3]});
+	  memcpy (yf + i, &v, sizeof (v));
+	}
+  tv = clock () - tv;
+
+  printf ("%-5s [%g, %g]: scalar %.3f s, vector %.3f s\n", f->name, f->lo,
+	  f->hi, (double) ts / CLOCKS_PER_SEC, (double) tv / CLOCKS_PER_SEC);
+}
+
+void
+test_vecmath (void)
+{
+  unsigned int i;
+  vdouble y;
+
+  for (i = 0; i < sizeof (funcs) / sizeof (funcs[0]); i++)
+    test_func (&funcs[i]);
+
+  /* Special lanes set errno like the scalar function.  */
+  newfunc ("exp");
+  line (__LINE__);
+  errno = 0;
+  y = V1 (2, exp) ((vdouble) {1.0, 1000.0});
+  test_eok (errno, ERANGE);
+  test_mok (y[0], exp (1.0), 64);
+  newfunc ("log");
+  line (__LINE__);
+  errno = 0;
+  y = V1 (2, log) ((vdouble) {-1.0, 2.0});
+  test_eok (errno, EDOM);
+  test_mok (y[1], log (2.0), 64);
+
+  for (i = 0; i < sizeof (funcs) / sizeof (funcs[0]); i++)
+    bench_func (&funcs[i]);
+}
+
+#else
+
+void
+test_vecmath (void)
+{
+}
+
+#endif
@@ -0,0 +1,195 @@
+/* Check conversions between the encodings iconv converts directly (UTF-8,
+   UTF-16BE/LE, UCS-4, ISO-8859-1, US-ASCII) and report their throughput.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <iconv.h>
+#include <errno.h>
+#include <newlib.h>
+#include "check.h"
+
+#if defined (_ICONV_FROM_ENCODING_UTF_8) && defined (_ICONV_TO_ENCODING_UTF_8)
+
+#define BENCH_SIZE (64 * 1024)
+#define BENCH_LOOPS 64
+
+/* One, two, three and four byte characters followed by ASCII */
+static const char utf8[] = "a\xc3\xa9\xe4\xb8\xad\xf0\x9f\x98\x80 plain ASCII tail";
+
+static size_t
+conv (const char *to, const char *from, const char *in, size_t inlen,
+      char *out, size_t outlen)
+{
+  iconv_t cd;
+  char *ip = (char *) in;
+  char *op = out;
+  size_t r;
+
+  cd = iconv_open (to, from);
+  CHECK (cd != (iconv_t) -1);
+  r = iconv (cd, &ip, &inlen, &op, &outlen);
+  CHECK (r == 0);
+  CHECK (inlen == 0);
+  CHECK (iconv_close (cd) == 0);
+  return op - out;
+}
+
+static void
+roundtrip (const char *via)
+{
+  char mid[256], back[256];
+  size_t n;
+
+  n = conv (via, "UTF-8", utf8, sizeof (utf8) - 1, mid, sizeof (mid));
+  n = conv ("UTF-8", via, mid, n, back, sizeof (back));
+  CHECK (n == sizeof (utf8) - 1);
+  CHECK (memcmp (back, utf8, n) == 0);
+}
+
+static void
+errors (void)
+{
+  iconv_t cd;
+  char out[16];
+  char *ip, *op;
+  size_t il, ol;
+
+  cd = iconv_open ("UTF-16LE", "UTF-8");
+  CHECK (cd != (iconv_t) -1);
+
+  /* Overlong sequence */
+  ip = "ab\xc0\xafz";
+  il = 5;
+  op = out;
+  ol = sizeof (out);
+  CHECK (iconv (cd, &ip, &il, &op, &ol) == (size_t) -1);
+  CHECK (errno == EILSEQ);
+  CHECK (il == 3 && ol == sizeof (out) - 4);
+
+  /* Incomplete sequence */
+  ip = "a\xe4\xb8";
+  il = 3;
+  op = out;
+  ol = sizeof (out);
+  CHECK (iconv (cd, &ip, &il, &op, &ol) == (size_t) -1);
+  CHECK (errno == EINVAL);
+  CHECK (il == 2 && out[0] == 'a' && out[1] == 0);
+
+  /* No room for the surrogate pair */
+  ip = "a\xf0\x9f\x98\x80";
+  il = 5;
+  op = out;
+  ol = 5;
+  CHECK (iconv (cd, &ip, &il, &op, &ol) == (size_t) -1);
+  CHECK (errno == E2BIG);
+  CHECK (il == 4 && ol == 3);
+
+  CHECK (iconv_close (cd) == 0);
+
+#if defined (_ICONV_TO_ENCODING_US_ASCII)
+  /* Unrepresentable characters are replaced */
+  cd = iconv_open ("US-ASCII", "UTF-8");
+  CHECK (cd != (iconv_t) -1);
+  ip = (char *) utf8;
+  il = 14;
+  op = out;
+  ol = sizeof (out);
+  CHECK (iconv (cd, &ip, &il, &op, &ol) == 3);
+  CHECK (op - out == 8 && memcmp (out, "a??? pla", 8) == 0);
+  CHECK (iconv_close (cd) == 0);
+#endif
+}
+
+static void
+bench (const char *to, const char *from, const char *in, size_t inlen)
+{
+  static char out[BENCH_SIZE * 4];
+  iconv_t cd;
+  clock_t t;
+  int i;
+
+  cd = iconv_open (to, from);
+  CHECK (cd != (iconv_t) -1);
+  t = clock ();
+  for (i = 0; i < BENCH_LOOPS; i++)
+    {
+      char *ip = (char *) in;
+      char *op = out;
+      size_t il = inlen;
+      size_t ol = sizeof (out);
+
+      CHECK (iconv (cd, &ip, &il, &op, &ol) == 0);
+    }
+  t = clock () - t;
+  CHECK (iconv_close (cd) == 0);
+
+  printf ("%-10s -> %-10s %8.1f MB/s\n", from, to,
+	  t > 0 ? (double) inlen * BENCH_LOOPS / 1e6 * CLOCKS_PER_SEC / t : 0.0);
+}
+
+int
+main (void)
+{
+  static char text[BENCH_SIZE];
+  static char wide[BENCH_SIZE * 4];
+  size_t i, n;
+
+  CHECK (setenv ("NLSPATH", "./", 0) != -1);
+
+#if defined (_ICONV_TO_ENCODING_UTF_16LE) \
+ && defined (_ICONV_FROM_ENCODING_UTF_16LE)
+  roundtrip ("UTF-16LE");
+#endif
+#if defined (_ICONV_TO_ENCODING_UTF_16BE) \
+ && defined (_ICONV_FROM_ENCODING_UTF_16BE)
+  roundtrip ("UTF-16BE");
+#endif
+#if defined (_ICONV_TO_ENCODING_UCS_4) \
+ && defined (_ICONV_FROM_ENCODING_UCS_4)
+  roundtrip ("UCS-4");
+#endif
+#if defined (_ICONV_TO_ENCODING_UTF_16LE) \
+ && defined (_ICONV_FROM_ENCODING_UTF_16LE)
+  errors ();
+#endif
+
+  /* Mostly ASCII text with a two-byte character every 40 characters */
+  for (i = 0, n = 0; n + 2 < sizeof (text); i++)
+    if (i % 40 == 39)
+      {
+	text[n++] = '\xc3';
+	text[n++] = '\xa9';
+      }
+    else
+      text[n++] = 'a' + i % 26;
+
+#if defined (_ICONV_TO_ENCODING_UTF_16LE) \
+ && defined (_ICONV_FROM_ENCODING_UTF_16LE)
+  bench ("UTF-16LE", "UTF-8", text, n);
+  i = conv ("UTF-16LE", "UTF-8", text, n, wide, sizeof (wide));
+  bench ("UTF-8", "UTF-16LE", wide, i);
+#endif
+#if defined (_ICONV_TO_ENCODING_UCS_4) \
+ && defined (_ICONV_FROM_ENCODING_UCS_4)
+  bench ("UCS-4", "UTF-8", text, n);
+#endif
+#if defined (_ICONV_TO_ENCODING_ISO_8859_1) \
+ && defined (_ICONV_FROM_ENCODING_ISO_8859_1)
+  i = conv ("ISO-8859-1", "UTF-8", text, n, wide, sizeof (wide));
+  bench ("UTF-8", "ISO-8859-1", wide, i);
+#endif
+
+  exit (0);
+}
+
+#else
+
+int
+main (void)
+{
+  exit (0);
+}
+
+#endif
@@ -0,0 +1,123 @@
+/* Check that conversions using the same external CCS table share it: once
+   the table is loaded, further iconv_open calls neither read the file
+   again nor depend on NLSPATH, and the table is released with the last
+   conversion using it.  Encodings whose tables are linked in, or whose
+   table files are not installed, are skipped.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <iconv.h>
+#include <newlib.h>
+#include "check.h"
+
+#if defined (_ICONV_ENABLE_EXTERNAL_CCS) && defined (_ICONV_TO_ENCODING_UTF_8)
+
+#define NO_TABLES "/nonexistent/newlib-iconvext"
+
+static const char *const encodings[] = {
+  "EUC-KR", "EUC-TW", "EUC-JP", "BIG5", "KOI8-R", "KOI8-U", "CP1251",
+  "ISO-8859-5", "CP866", NULL
+};
+
+static char *saved_path;
+
+static void
+use_tables (int yes)
+{
+  if (yes && saved_path != NULL)
+    setenv ("NLSPATH", saved_path, 1);
+  else if (yes)
+    unsetenv ("NLSPATH");
+  else
+    setenv ("NLSPATH", NO_TABLES, 1);
+}
+
+/* Convert ASCII text, which all of the encodings above keep as is.  */
+static int
+converts (iconv_t cd)
+{
+  char in[] = "shared table", out[32];
+  char *ip = in, *op = out;
+  size_t il = sizeof (in) - 1, ol = sizeof (out);
+
+  return iconv (cd, &ip, &il, &op, &ol) == 0 && il == 0
+	 && op - out == sizeof (in) - 1 && memcmp (out, in, op - out) == 0;
+}
+
+/* Return 1 if ENC was checked, 0 if it was skipped.  */
+static int
+check_encoding (const char *enc)
+{
+  iconv_t a, b, c;
+  int i;
+
+  use_tables (0);
+  a = iconv_open ("UTF-8", enc);
+  use_tables (1);
+  if (a != (iconv_t) -1)
+    {
+      /* Linked in, no file involved */
+      iconv_close (a);
+      return 0;
+    }
+  a = iconv_open ("UTF-8", enc);
+  if (a == (iconv_t) -1)
+    return 0;
+
+  /* While A is open, its table is found without the file.  */
+  use_tables (0);
+  b = iconv_open ("UTF-8", enc);
+  CHECK (b != (iconv_t) -1);
+  CHECK (converts (a) && converts (b));
+
+  /* Closing one of them leaves the table to the other.  */
+  CHECK (iconv_close (a) == 0);
+  CHECK (converts (b));
+  c = iconv_open ("UTF-8", enc);
+  CHECK (c != (iconv_t) -1);
+  CHECK (iconv_close (b) == 0);
+  CHECK (converts (c));
+  CHECK (iconv_close (c) == 0);
+
+  /* The last close released it, so now the file is needed again.  */
+  CHECK (iconv_open ("UTF-8", enc) == (iconv_t) -1);
+  use_tables (1);
+
+  /* Loading and releasing it many times leaks nothing.  */
+  for (i = 0; i < 1000; i++)
+    {
+      a = iconv_open ("UTF-8", enc);
+      CHECK (a != (iconv_t) -1);
+      CHECK (iconv_close (a) == 0);
+    }
+  a = iconv_open ("UTF-8", enc);
+  CHECK (a != (iconv_t) -1 && converts (a));
+  CHECK (iconv_close (a) == 0);
+  return 1;
+}
+
+int
+main (void)
+{
+  int i, checked = 0;
+
+  if (getenv ("NLSPATH") != NULL)
+    saved_path = strdup (getenv ("NLSPATH"));
+  for (i = 0; encodings[i] != NULL; i++)
+    checked += check_encoding (encodings[i]);
+  if (checked == 0)
+    puts ("No external CCS tables found, SKIP test");
+  exit (0);
+}
+
+#else
+
+int
+main (void)
+{
+  puts ("External CCS tables are disabled, SKIP test");
+  exit (0);
+}
+
+#endif
@@ -0,0 +1,65 @@
+/* Check that printf, scanf and strtod give the same results in the "C"
+   locale, which takes the constant fast paths, and in a locale which has
+   to fetch its data, and report the speed of both.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <locale.h>
+#include <time.h>
+#include <ctype.h>
+#include "check.h"
+
+#define BENCH_LOOPS 20000
+
+static const char text[] =
+  "  3.25 and -17 then 1e-3, finally 0.5 + 42 = 42.5 in total  ";
+
+static double
+bench (char *out, size_t size)
+{
+  clock_t t = clock ();
+  double d;
+  char *end;
+  int i, n, j;
+
+  for (i = 0; i < BENCH_LOOPS; i++)
+    {
+      n = snprintf (out, size, "value %d is %.3f or %g (%s)", i, i / 8.0,
+		    i * 1e-3, "ok");
+      CHECK (n > 0 && (size_t) n < size);
+      n = sscanf (out, "value %d is %lf", &j, &d);
+      CHECK (n == 2);
+      CHECK (j == i && d == i / 8.0);
+      d = strtod (text + 2, &end);
+      CHECK (d == 3.25 && end == text + 6);
+      for (j = n = 0; text[j]; j++)
+	n += isdigit ((unsigned char) text[j]) != 0;
+      CHECK (n == 14);
+    }
+  return (double) (clock () - t) / CLOCKS_PER_SEC;
+}
+
+int
+main (void)
+{
+  char c_out[64], out[64];
+  locale_t loc, old;
+  double c_time, time;
+
+  c_time = bench (c_out, sizeof (c_out));
+  printf ("C locale:       %8.3f s\n", c_time);
+
+  loc = newlocale (LC_ALL_MASK, "C.UTF-8", (locale_t) 0);
+  if (!loc)
+    exit (0);
+  old = uselocale (loc);
+  time = bench (out, sizeof (out));
+  uselocale (old);
+  freelocale (loc);
+  printf ("C.UTF-8 locale: %8.3f s\n", time);
+
+  CHECK (strcmp (c_out, out) == 0);
+
+  exit (0);
+}
@@ -0,0 +1,113 @@
+/* Check mbsnrtowcs and wcsnrtombs in a UTF-8 locale on strings long enough
+   for their word-at-a-time paths, against mbrtowc and wcrtomb.  */
+
+#include <stdlib.h>
+#include <string.h>
+#include <locale.h>
+#include <wchar.h>
+#include <errno.h>
+#include "check.h"
+
+/* ASCII, two, three and four byte characters */
+static const char *const pieces[] = {
+  "abcdefghijklmnopqrstuvw", "\xc3\xa9", "\xe4\xb8\xad", "\xf0\x9f\x98\x80"
+};
+
+static void
+check_string (const char *s, size_t nms)
+{
+  wchar_t w1[1024], w2[1024];
+  char b[4096];
+  mbstate_t st;
+  const char *p;
+  const wchar_t *q;
+  size_t n, r, k;
+
+  /* Reference: one character at a time */
+  memset (&st, 0, sizeof (st));
+  for (n = 0, k = 0, r = 1; k < nms; n++, k += r)
+    {
+      r = mbrtowc (&w1[n], s + k, nms - k, &st);
+      if (r == 0 || r == (size_t) -1 || r == (size_t) -2)
+	break;
+    }
+
+  memset (&st, 0, sizeof (st));
+  p = s;
+  errno = 0;
+  if (r == (size_t) -1)
+    {
+      CHECK (mbsnrtowcs (w2, &p, nms, 1024, &st) == (size_t) -1);
+      CHECK (errno == EILSEQ);
+      CHECK (p == s + k);
+      CHECK (wmemcmp (w1, w2, n) == 0);
+      return;
+    }
+  CHECK (mbsnrtowcs (w2, &p, nms, 1024, &st) == n);
+  CHECK (wmemcmp (w1, w2, n) == 0);
+  CHECK (r == 0 ? p == NULL : p == s + nms);
+
+  /* Same count without storing */
+  memset (&st, 0, sizeof (st));
+  p = s;
+  CHECK (mbsnrtowcs (NULL, &p, nms, 0, &st) == n);
+  CHECK (p == s);
+
+  /* And back */
+  memset (&st, 0, sizeof (st));
+  q = w2;
+  r = wcsnrtombs (b, &q, n, sizeof (b), &st);
+  CHECK (r == k);
+  CHECK (memcmp (b, s, k) == 0);
+  CHECK (q == w2 + n);
+
+  /* Stops before a character which doesn't fit */
+  if (k > 1)
+    {
+      memset (&st, 0, sizeof (st));
+      q = w2;
+      r = wcsnrtombs (b, &q, n, k - 1, &st);
+      CHECK (r < k && r + 4 >= k);
+      CHECK (memcmp (b, s, r) == 0);
+    }
+}
+
+int
+main (void)
+{
+  static char s[1024];
+  size_t n, i;
+  unsigned seed = 1;
+  wchar_t bad[3] = { L'a', (wchar_t) 0x110000, 0 };
+  const wchar_t *q;
+  char b[8];
+  mbstate_t st;
+
+  if (!setlocale (LC_CTYPE, "C.UTF-8"))
+    exit (0);
+
+  for (i = 0; i < 200; i++)
+    {
+      n = 0;
+      while (n < sizeof (s) - 32)
+	{
+	  seed = seed * 1103515245 + 12345;
+	  strcpy (s + n, pieces[(seed >> 16) % 4]);
+	  n += strlen (s + n);
+	}
+      /* Damage some strings */
+      if (i % 4 == 1)
+	s[(seed >> 8) % n] = '\xff';
+      else if (i % 4 == 2)
+	s[(seed >> 8) % n] = '\0';
+      check_string (s, i % 4 == 3 ? (seed >> 8) % n : n + 1);
+    }
+
+  memset (&st, 0, sizeof (st));
+  q = bad;
+  CHECK (wcsnrtombs (b, &q, 3, sizeof (b), &st) == (size_t) -1);
+  CHECK (errno == EILSEQ);
+  CHECK (q == bad + 1);
+
+  exit (0);
+}
@@ -0,0 +1,78 @@
+/* Check that locale objects sharing their category data stay independent:
+   create, duplicate and free them in different orders and check the data
+   they use.  */
+
+#include <stdlib.h>
+#include <string.h>
+#include <locale.h>
+#include <langinfo.h>
+#include "check.h"
+
+/* Whether the codeset of LOC starts with PREFIX.  Only Cygwin lets
+   uselocale change the multibyte functions, so ask nl_langinfo_l, which
+   takes the locale explicitly.  */
+static int
+codeset_is (locale_t loc, const char *prefix)
+{
+  return strncmp (nl_langinfo_l (CODESET, loc), prefix, strlen (prefix)) == 0;
+}
+
+int
+main (void)
+{
+  locale_t a, b, c, d;
+  int i;
+
+  a = newlocale (LC_ALL_MASK, "C.UTF-8", (locale_t) 0);
+  if (!a)
+    exit (0);
+  CHECK (codeset_is (a, "UTF-8"));
+
+  /* Same name again, and a copy */
+  b = newlocale (LC_ALL_MASK, "C.UTF-8", (locale_t) 0);
+  CHECK (b != (locale_t) 0 && b != a);
+  c = duplocale (a);
+  CHECK (c != (locale_t) 0);
+  freelocale (a);
+  CHECK (codeset_is (b, "UTF-8"));
+  CHECK (codeset_is (c, "UTF-8"));
+
+  /* Modify a copy based on another object */
+  d = newlocale (LC_CTYPE_MASK, "C.ISO-8859-1", duplocale (b));
+  CHECK (d != (locale_t) 0);
+  CHECK (codeset_is (d, "ISO-8859-1"));
+  CHECK (codeset_is (b, "UTF-8"));
+  freelocale (b);
+  CHECK (codeset_is (c, "UTF-8"));
+
+  /* A failing newlocale leaves its base alone */
+  CHECK (newlocale (LC_CTYPE_MASK, "no-such-locale", d) == (locale_t) 0);
+  CHECK (codeset_is (d, "ISO-8859-1"));
+  freelocale (d);
+  freelocale (c);
+
+  /* Per-call locale objects */
+  for (i = 0; i < 1000; i++)
+    {
+      a = newlocale (LC_CTYPE_MASK | LC_NUMERIC_MASK,
+		     i & 1 ? "C.UTF-8" : "C.EUC-JP", (locale_t) 0);
+      CHECK (a != (locale_t) 0);
+      CHECK (codeset_is (a, i & 1 ? "UTF-8" : "EUC"));
+      b = duplocale (a);
+      freelocale (a);
+      CHECK (codeset_is (b, i & 1 ? "UTF-8" : "EUC"));
+      freelocale (b);
+    }
+
+  /* Copy of the global locale */
+  if (setlocale (LC_CTYPE, "C.UTF-8"))
+    {
+      a = duplocale (LC_GLOBAL_LOCALE);
+      CHECK (a != (locale_t) 0);
+      setlocale (LC_CTYPE, "C");
+      CHECK (codeset_is (a, "UTF-8"));
+      freelocale (a);
+    }
+
+  exit (0);
+}
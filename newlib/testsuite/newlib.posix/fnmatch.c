@@ -0,0 +1,180 @@
+/* Check that fnmatch gives the same answers whether a pattern is matched
+   directly, compiled into the pattern cache, found there again or evicted
+   from it, and when the cache cannot allocate its entries.  */
+
+#define _GNU_SOURCE
+#include <fnmatch.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "check.h"
+
+/* More than the cache holds.  */
+#define NPATTERNS 20
+
+/* Give up exhausting the heap beyond this, and skip those checks.  */
+#define HEAP_LIMIT (64L << 20)
+
+static const struct {
+  const char *pattern;
+  const char *string;
+  int flags;
+  int match;
+} tests[] = {
+  { "*.c", "fnmatch.c", 0, 1 },
+  { "*.c", "fnmatch.h", 0, 0 },
+  { "a?c", "abc", 0, 1 },
+  { "a?c", "a/c", FNM_PATHNAME, 0 },
+  { "a?c", "a/c", 0, 1 },
+  { "[a-c]*[!x]", "bzzy", 0, 1 },
+  { "[a-c]*[!x]", "bzzx", 0, 0 },
+  { "*/b", "a/b", FNM_PATHNAME, 1 },
+  { "*/b", "a/x/b", FNM_PATHNAME, 0 },
+  { "*", ".profile", FNM_PERIOD, 0 },
+  { "*", ".profile", 0, 1 },
+  { "a*", "abc/def", FNM_PATHNAME | FNM_LEADING_DIR, 1 },
+  { "*.TXT", "read.me.txt", FNM_CASEFOLD, 1 },
+  { "*.TXT", "read.me.txt", 0, 0 },
+  { "[A-Z]*", "lower", FNM_CASEFOLD, 1 },
+  { "\\*x", "*x", 0, 1 },
+  { "\\*x", "\\ax", FNM_NOESCAPE, 1 },
+};
+
+#define NTESTS (sizeof (tests) / sizeof (tests[0]))
+
+static int
+check_tests (void)
+{
+  int bad = 0;
+  size_t i;
+
+  for (i = 0; i < NTESTS; i++)
+    if ((fnmatch (tests[i].pattern, tests[i].string, tests[i].flags) == 0)
+	!= tests[i].match)
+      {
+	printf ("fnmatch (\"%s\", \"%s\", %#x) is wrong\n", tests[i].pattern,
+		tests[i].string, tests[i].flags);
+	bad++;
+      }
+  return bad;
+}
+
+/* Pattern I of the eviction checks, and a string it matches.  */
+static void
+make_pattern (int i, char *pattern, char *string)
+{
+  sprintf (pattern, "p%d*[0-9]?", i);
+  sprintf (string, "p%dxyz5q", i);
+}
+
+static int
+check_patterns (int first, int n, int times)
+{
+  char pattern[32], string[32];
+  int bad = 0, i, j;
+
+  for (i = first; i < first + n; i++)
+    {
+      make_pattern (i, pattern, string);
+      for (j = 0; j < times; j++)
+	{
+	  bad += fnmatch (pattern, string, 0) != 0;
+	  bad += fnmatch (pattern, string + 1, 0) != FNM_NOMATCH;
+	}
+    }
+  return bad;
+}
+
+struct block
+{
+  struct block *next;
+};
+
+/* Allocate all of the heap and return the blocks, or NULL if the heap
+   seems to have no end.  */
+static struct block *
+fill_heap (void)
+{
+  struct block *list = NULL, *b;
+  size_t size = 1 << 20;
+  long total = 0;
+
+  while (size >= sizeof (struct block))
+    {
+      b = malloc (size);
+      if (b == NULL)
+	{
+	  size /= 2;
+	  continue;
+	}
+      b->next = list;
+      list = b;
+      total += size;
+      if (total > HEAP_LIMIT)
+	break;
+    }
+  if (total > HEAP_LIMIT)
+    {
+      while ((b = list) != NULL)
+	{
+	  list = b->next;
+	  free (b);
+	}
+    }
+  return list;
+}
+
+int
+main (void)
+{
+  struct block *heap, *b;
+  void *spare;
+  int i, bad;
+
+  /* Direct, compiled on the second miss, then cached.  */
+  for (i = 0; i < 4; i++)
+    CHECK (check_tests () == 0);
+
+  /* Each pattern twice in a row is compiled, so this replaces every
+     entry of the cache several times over; the first ones are then
+     matched again after their eviction.  */
+  CHECK (check_patterns (0, NPATTERNS, 3) == 0);
+  CHECK (check_patterns (0, NPATTERNS, 1) == 0);
+  CHECK (check_patterns (NPATTERNS - 2, 2, 3) == 0);
+
+  /* The same pattern with different flags are different entries.  */
+  for (i = 0; i < 6; i++)
+    {
+      CHECK (fnmatch ("*/x", ".a/x", i & 1 ? FNM_PERIOD : 0)
+	     == (i & 1 ? FNM_NOMATCH : 0));
+      CHECK (fnmatch ("*.C", "x.c", i & 2 ? FNM_CASEFOLD : 0)
+	     == (i & 2 ? 0 : FNM_NOMATCH));
+    }
+
+  /* With the heap exhausted, no entry can be made, and with a small hole
+     in it the entry can be made but not the compiled pattern.  Cached
+     patterns still match.  */
+  CHECK (check_patterns (0, 1, 2) == 0);
+  spare = malloc (64);
+  heap = fill_heap ();
+  if (heap != NULL)
+    {
+      bad = check_patterns (100, 2, 3);
+      bad += check_patterns (0, 1, 2);
+      free (spare);
+      spare = NULL;
+      bad += check_patterns (200, 2, 3);
+      bad += check_tests ();
+      while ((b = heap) != NULL)
+	{
+	  heap = b->next;
+	  free (b);
+	}
+      CHECK (bad == 0);
+    }
+  free (spare);
+
+  CHECK (check_tests () == 0);
+  CHECK (check_patterns (100, 2, 3) == 0);
+  exit (0);
+}
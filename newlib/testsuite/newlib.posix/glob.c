@@ -0,0 +1,279 @@
+/* Check glob and glob_stream on a small tree, served through
+   GLOB_ALTDIRFUNC so that no real directories are needed: patterns with
+   several wildcard components, GLOB_MARK, GLOB_NOCHECK, GLOB_ERR and the
+   error function, and stopping glob_stream early.  */
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <errno.h>
+#include <glob.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "check.h"
+
+/* Every path of the tree; directories end in a slash.  */
+static const char *const tree[] = {
+  "a/", "a/x.c", "a/y.h", "a/.hidden.c",
+  "b/", "b/x.c", "b/sub/", "b/sub/z.c", "b/sub/deep/", "b/sub/deep/w.c",
+  "f",
+  NULL
+};
+
+struct dir
+{
+  char name[64];
+  int next;
+  struct dirent ent;
+};
+
+/* Copy PATH to BUF without "./" in front and slashes at the end.  */
+static void
+normalize (const char *path, char *buf)
+{
+  size_t len;
+
+  if (strcmp (path, ".") == 0)
+    path = "";
+  else if (strncmp (path, "./", 2) == 0)
+    path += 2;
+  strncpy (buf, path, 63);
+  buf[63] = '\0';
+  len = strlen (buf);
+  while (len > 0 && buf[len - 1] == '/')
+    buf[--len] = '\0';
+}
+
+/* Return the entry of the tree for PATH, or -1.  */
+static int
+lookup (const char *path)
+{
+  char name[64];
+  size_t len;
+  int i;
+
+  normalize (path, name);
+  len = strlen (name);
+  for (i = 0; tree[i] != NULL; i++)
+    if (strncmp (tree[i], name, len) == 0
+	&& (tree[i][len] == '\0' || strcmp (tree[i] + len, "/") == 0))
+      return i;
+  return -1;
+}
+
+static int
+is_dir (int i)
+{
+  return tree[i][strlen (tree[i]) - 1] == '/';
+}
+
+static int
+tree_stat (const char *path, struct stat *st)
+{
+  int i;
+
+  if (*path == '\0')
+    {
+      errno = ENOENT;
+      return -1;
+    }
+  if ((i = lookup (path)) < 0 && strcmp (path, ".") != 0)
+    {
+      errno = ENOENT;
+      return -1;
+    }
+  memset (st, 0, sizeof (*st));
+  st->st_mode = i < 0 || is_dir (i) ? S_IFDIR | 0755 : S_IFREG | 0644;
+  return 0;
+}
+
+static int opened;
+
+static void *
+tree_opendir (const char *path)
+{
+  struct dir *d;
+  int i;
+
+  i = lookup (path);
+  if (strcmp (path, ".") != 0 && (i < 0 || !is_dir (i)))
+    {
+      errno = i < 0 ? ENOENT : ENOTDIR;
+      return NULL;
+    }
+  if ((d = malloc (sizeof (*d))) == NULL)
+    return NULL;
+  normalize (path, d->name);
+  d->next = -2;
+  opened++;
+  return d;
+}
+
+/* Return ".", "..", then the entries whose parent is the directory.  */
+static struct dirent *
+tree_readdir (void *p)
+{
+  struct dir *d = p;
+  size_t len = strlen (d->name);
+  const char *rest;
+
+  if (d->next < 0)
+    {
+      strcpy (d->ent.d_name, d->next == -2 ? "." : "..");
+      d->next++;
+      return &d->ent;
+    }
+  for (; tree[d->next] != NULL; d->next++)
+    {
+      if (len > 0
+	  && (strncmp (tree[d->next], d->name, len) != 0
+	      || tree[d->next][len] != '/'))
+	continue;
+      rest = tree[d->next] + (len > 0 ? len + 1 : 0);
+      if (*rest == '\0'
+	  || (strchr (rest, '/') != NULL && strchr (rest, '/')[1] != '\0'))
+	continue;
+      strcpy (d->ent.d_name, rest);
+      if (d->ent.d_name[strlen (rest) - 1] == '/')
+	d->ent.d_name[strlen (rest) - 1] = '\0';
+      d->next++;
+      return &d->ent;
+    }
+  return NULL;
+}
+
+static void
+tree_closedir (void *p)
+{
+  opened--;
+  free (p);
+}
+
+static void
+init (glob_t *g)
+{
+  memset (g, 0, sizeof (*g));
+  g->gl_opendir = tree_opendir;
+  g->gl_readdir = tree_readdir;
+  g->gl_closedir = tree_closedir;
+  g->gl_stat = tree_stat;
+  g->gl_lstat = tree_stat;
+}
+
+/* Glob PATTERN and return whether the result is the paths in EXPECT,
+   separated by spaces, in that order.  */
+static int
+glob_is (const char *pattern, int flags, const char *expect)
+{
+  glob_t g;
+  char buf[256];
+  int i, ok;
+
+  init (&g);
+  if (glob (pattern, flags | GLOB_ALTDIRFUNC, NULL, &g) != 0)
+    return *expect == '\0';
+  buf[0] = '\0';
+  for (i = 0; i < g.gl_pathc; i++)
+    {
+      if (i > 0)
+	strcat (buf, " ");
+      strcat (buf, g.gl_pathv[i]);
+    }
+  ok = strcmp (buf, expect) == 0;
+  if (!ok)
+    printf ("glob (\"%s\") gave \"%s\"\n", pattern, buf);
+  globfree (&g);
+  return ok;
+}
+
+static int errors;
+
+static int
+count_error (const char *path, int err)
+{
+  errors++;
+  return 0;
+}
+
+static int
+stop_error (const char *path, int err)
+{
+  errors++;
+  return 1;
+}
+
+static int
+count_path (const char *path, void *arg)
+{
+  int *n = arg;
+
+  ++*n;
+  return 0;
+}
+
+static int
+stop_at_two (const char *path, void *arg)
+{
+  int *n = arg;
+
+  return ++*n == 2;
+}
+
+int
+main (void)
+{
+  glob_t g;
+  int n;
+
+  /* Wildcards in one, two and three components.  */
+  CHECK (glob_is ("*/*.c", 0, "a/x.c b/x.c"));
+  CHECK (glob_is ("*/*/*.c", 0, "b/sub/z.c"));
+  CHECK (glob_is ("b/*/*/*.c", 0, "b/sub/deep/w.c"));
+  CHECK (glob_is ("*/sub/*", 0, "b/sub/deep b/sub/z.c"));
+  CHECK (glob_is ("[ab]/x.?", 0, "a/x.c b/x.c"));
+  CHECK (glob_is ("*/.*.c", 0, "a/.hidden.c"));
+  CHECK (glob_is ("*/y.[ch]", 0, "a/y.h"));
+  CHECK (glob_is ("*", GLOB_MARK, "a/ b/ f"));
+  CHECK (opened == 0);
+
+  /* No match, with and without GLOB_NOCHECK.  */
+  CHECK (glob_is ("*/*.o", 0, ""));
+  CHECK (glob_is ("*/*.o", GLOB_NOCHECK, "*/*.o"));
+  CHECK (glob_is ("nothere", GLOB_NOCHECK, "nothere"));
+
+  /* "f" is not a directory, so "*" "/" "*" cannot open "f/".  The error
+     function is told, and only its return or GLOB_ERR stop the walk.  */
+  init (&g);
+  errors = 0;
+  CHECK (glob ("*/*", GLOB_ALTDIRFUNC, count_error, &g) == 0);
+  CHECK (errors == 1 && g.gl_pathc == 4);
+  globfree (&g);
+  init (&g);
+  errors = 0;
+  CHECK (glob ("*/*", GLOB_ALTDIRFUNC | GLOB_ERR, count_error, &g)
+	 == GLOB_ABEND);
+  CHECK (errors == 1);
+  globfree (&g);
+  init (&g);
+  errors = 0;
+  CHECK (glob ("*/*", GLOB_ALTDIRFUNC, stop_error, &g) == GLOB_ABEND);
+  CHECK (errors == 1);
+  globfree (&g);
+  CHECK (opened == 0);
+
+  /* glob_stream sees every path, and stops when asked to.  */
+  init (&g);
+  n = 0;
+  CHECK (glob_stream ("*/*/*", GLOB_ALTDIRFUNC, NULL, count_path, &n, &g)
+	 == 0);
+  CHECK (n == 2 && g.gl_pathc == 2 && g.gl_pathv == NULL);
+  init (&g);
+  n = 0;
+  CHECK (glob_stream ("*/*", GLOB_ALTDIRFUNC, NULL, stop_at_two, &n, &g)
+	 == GLOB_ABEND);
+  CHECK (n == 2 && g.gl_pathc == 2 && g.gl_pathv == NULL);
+  CHECK (opened == 0);
+
+  exit (0);
+}
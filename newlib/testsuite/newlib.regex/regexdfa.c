@@ -0,0 +1,83 @@
+/* Check that regexec's lazy DFA agrees with the NFA simulation
+   (REG_NODFA).  "bench -x" in libm/test reports the throughput of both.  */
+
+#include <sys/types.h>
+#include <regex.h>
+#include <stdio.h>
+#include <string.h>
+#include "check.h"
+
+#define LINES	1000
+
+static const char *const patterns[] = {
+  "abc",
+  "a|b|cd",
+  "(foo|bar|baz)+x",
+  "[a-c]+d",
+  "^ab",
+  "b$",
+  "x*",
+  "(a|ab)(c|bcd)(d*)",
+  "[[:digit:]]+\\.[[:digit:]]+",
+  "a.*b.*c",
+  "^$",
+  "(^|[^a])b",
+  "[^ab]{2,3}c",
+  "(error|warn|fatal):[0-9]+",
+  "(alpha|beta|gamma|delta|epsilon|zeta|eta|theta|iota|kappa)+[0-9]{2}",
+  "(a|b)*a(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)",
+};
+
+static unsigned long seed = 1;
+
+static int
+rnd (int n)
+{
+  seed = seed * 1103515245 + 12345;
+  return (int) ((seed >> 16) % n);
+}
+
+static void
+fill (char *buf, int len, const char *alpha)
+{
+  int n = strlen (alpha);
+  int i;
+
+  for (i = 0; i < len; i++)
+    buf[i] = alpha[rnd (n)];
+  buf[len] = '\0';
+}
+
+int
+main (void)
+{
+  char line[300];
+  regmatch_t a[3], b[3];
+  regex_t re;
+  int i, j, k, cflags, eflags, nmatch;
+
+  for (i = 0; i < sizeof (patterns) / sizeof (patterns[0]); i++)
+    for (cflags = 0; cflags < 2; cflags++)
+      {
+	CHECK (regcomp (&re, patterns[i],
+			REG_EXTENDED | (cflags ? REG_NEWLINE : 0)) == 0);
+	for (j = 0; j < LINES; j++)
+	  {
+	    fill (line, rnd (sizeof (line) - 1),
+		  (j & 1) ? "abcdq\n xz.0123456789:" : "abcdefor_ wx\nbaz");
+	    for (k = 0; k < 4; k++)
+	      {
+		eflags = (k & 1 ? REG_NOTBOL : 0) | (k & 2 ? REG_NOTEOL : 0);
+		nmatch = k < 3 ? k : 3;
+		memset (a, 0, sizeof (a));
+		memset (b, 0, sizeof (b));
+		CHECK (regexec (&re, line, nmatch, a, eflags)
+		       == regexec (&re, line, nmatch, b, eflags | REG_NODFA));
+		CHECK (memcmp (a, b, sizeof (a)) == 0);
+	      }
+	  }
+	regfree (&re);
+      }
+
+  return 0;
+}
@@ -0,0 +1,67 @@
+/* Check the match offsets regexec reports for patterns whose leading
+   characters and required substrings regcomp extracts to skip ahead
+   in the subject.  */
+
+#include <sys/types.h>
+#include <regex.h>
+#include <stdio.h>
+#include <string.h>
+#include "check.h"
+
+static const struct {
+  const char *re;
+  int cflags;
+  const char *str;
+  int so;		/* -1 if no match is expected */
+  int eo;
+} tests[] = {
+  { "needle", 0, "haystack with a needle in it", 16, 22 },
+  { "needle", 0, "haystack with a needl", -1, -1 },
+  { "n", 0, "xxxxn", 4, 5 },
+  { "q?a", 0, "xxqa", 2, 4 },
+  { "q?a", 0, "xxxa", 3, 4 },
+  { "(foo|bar)+x", 0, "zzbarfoox", 2, 9 },
+  { "(foo|bar)+x", 0, "zzbarfoo", -1, -1 },
+  { "(ab|c?)d", 0, "zzzd", 3, 4 },
+  { "(ab|c?)d", 0, "zzabd", 2, 5 },
+  { "(a*|b)c", 0, "xxxc", 3, 4 },
+  { "(x?y?)+z", 0, "aaaz", 3, 4 },
+  { "x(ab)*y", 0, "--xy--", 2, 4 },
+  { "(a+|b+)(c|d)", 0, "zzbbd", 2, 5 },
+  { "^ab", 0, "xab", -1, -1 },
+  { "^ab", REG_NEWLINE, "x\nab", 2, 4 },
+  { "[[:<:]]word[[:>:]]", 0, "swords word", 7, 11 },
+  { "[0-9]+x", 0, "abc123x", 3, 7 },
+  { "[^a-y]", 0, "abcz", 3, 4 },
+  { "q", REG_ICASE, "aaQ", 2, 3 },
+  { "x*", 0, "abc", 0, 0 },
+  { "(((x)))q", 0, "xxq", 1, 3 },
+};
+
+int
+main (void)
+{
+  regex_t re;
+  regmatch_t pm[1];
+  int i;
+  int r;
+
+  for (i = 0; i < (int) (sizeof tests / sizeof tests[0]); i++)
+    {
+      CHECK (regcomp (&re, tests[i].re, REG_EXTENDED | tests[i].cflags) == 0);
+      r = regexec (&re, tests[i].str, 1, pm, 0);
+      if (tests[i].so < 0)
+	{
+	  CHECK (r == REG_NOMATCH);
+	}
+      else
+	{
+	  CHECK (r == 0);
+	  CHECK (pm[0].rm_so == tests[i].so);
+	  CHECK (pm[0].rm_eo == tests[i].eo);
+	}
+      regfree (&re);
+    }
+
+  return 0;
+}
@@ -0,0 +1,127 @@
+/* Check that long doubles survive a round trip through printf and
+   strtold, and check some conversions which must be exact or correctly
+   rounded.  "bench -c" in libm/test reports the speed of both.  */
+
+#include <newlib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include "check.h"
+
+#define NTEST 20000
+
+/* Significant digits which tell all long doubles apart.  */
+#define ROUND_TRIP_DIG (LDBL_DIG + 3)
+
+static unsigned long long seed = 1;
+
+static unsigned long long
+rand64 (void)
+{
+  seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+  return seed;
+}
+
+/* A random long double between 2^-EMAX and 2^EMAX.  */
+static long double
+random_ld (int emax)
+{
+  long double x = (long double) (rand64 () >> 1) * 0x1p-63L;
+  int e = (int) (rand64 () >> 33) % (2 * emax + 1) - emax;
+
+  x += (long double) (rand64 () >> 11) * 0x1p-116L;
+  for (; e >= 64; e -= 64)
+    x *= 0x1p64L;
+  for (; e <= -64; e += 64)
+    x *= 0x1p-64L;
+  for (; e > 0; e--)
+    x *= 2;
+  for (; e < 0; e++)
+    x /= 2;
+  return x;
+}
+
+static void
+check_strtold (void)
+{
+  char *end;
+
+  CHECK (strtold ("0.1", &end) == 0.1L && *end == '\0');
+  CHECK (strtold ("  -2.5e-3x", &end) == -2.5e-3L && *end == 'x');
+  CHECK (strtold ("123456789012345678901234567890", NULL)
+	 == 123456789012345678901234567890.0L);
+  CHECK (strtold ("1267650600228229401496703205376", NULL) == 0x1p100L);
+  CHECK (strtold ("7.888609052210118054117285652827862296732064351090230"
+		  "047702789306640625e-31", NULL) == 0x1p-100L);
+  CHECK (LDBL_MIN_10_EXP > -4931
+	 || strtold ("3.3621031431120935062626778173217526e-4932", NULL)
+	    == LDBL_MIN);
+  CHECK (strtold ("1e99999", NULL) > LDBL_MAX);
+  CHECK (strtold ("-1e-99999", NULL) == 0);
+  CHECK (strtold ("0x1.8p1", &end) == 3 && *end == '\0');
+  CHECK (strtold ("inf", NULL) > LDBL_MAX);
+  CHECK (strtold ("nan", NULL) != strtold ("nan", NULL));
+  CHECK (strtold ("e5", &end) == 0 && *end == 'e');
+}
+
+#ifdef _WANT_IO_LONG_DOUBLE
+static void
+check_printf (void)
+{
+  char buf[1600];
+
+  snprintf (buf, sizeof (buf), "%Lf", 0x1p100L);
+  CHECK (strcmp (buf, "1267650600228229401496703205376.000000") == 0);
+  snprintf (buf, sizeof (buf), "%.100Lg", 0x1p-100L);
+  CHECK (strcmp (buf, "7.888609052210118054117285652827862296732064351090230"
+		      "047702789306640625e-31") == 0);
+  snprintf (buf, sizeof (buf), "%.0Lf %.0Lf %.0Lf %.1Lf", 0.5L, 1.5L, 2.5L,
+	    0.25L);
+  CHECK (strcmp (buf, "0 2 2 0.2") == 0);
+  snprintf (buf, sizeof (buf), "%.3Lf %.2Lf %.3Le", 9.9996L, 0.004L, 9.9996L);
+  CHECK (strcmp (buf, "10.000 0.00 1.000e+01") == 0);
+  snprintf (buf, sizeof (buf), "%Lg %Lg %Lg", 0.0L, -0.0L, 100000.0L);
+  CHECK (strcmp (buf, "0 -0 100000") == 0);
+  snprintf (buf, sizeof (buf), "%Lg %Lg", 1 / 0.0L, -1 / 0.0L);
+  CHECK (strcmp (buf, "inf -inf") == 0);
+  if (LDBL_MIN_10_EXP < -1000)
+    {
+      snprintf (buf, sizeof (buf), "%.1000Lf", LDBL_MIN);
+      CHECK (strspn (buf, "0.") == strlen (buf));
+    }
+}
+
+static void
+check_round_trip (void)
+{
+  char buf[64], buf2[64];
+  long double x, y;
+  int i;
+
+  for (i = 0; i < NTEST; i++)
+    {
+      x = random_ld (i & 1 ? 200 : LDBL_MAX_EXP - 1);
+      if (i & 2)
+	x = -x;
+      snprintf (buf, sizeof (buf), "%.*Lg", ROUND_TRIP_DIG, x);
+      y = strtold (buf, NULL);
+      if (x != y)
+	printf ("%s does not convert back\n", buf);
+      CHECK (x == y);
+      snprintf (buf2, sizeof (buf2), "%.*Lg", ROUND_TRIP_DIG, y);
+      CHECK (strcmp (buf, buf2) == 0);
+    }
+}
+#endif /* _WANT_IO_LONG_DOUBLE */
+
+int
+main (void)
+{
+  check_strtold ();
+#ifdef _WANT_IO_LONG_DOUBLE
+  check_printf ();
+  check_round_trip ();
+#endif
+  exit (0);
+}
@@ -0,0 +1,56 @@
+/* Check strcollsort against qsort with strcoll, and strxfrm.  */
+
+#include <stdlib.h>
+#include <string.h>
+#include "check.h"
+
+#define NSTR 2000
+
+static int
+coll_cmp (const void *a, const void *b)
+{
+  return strcoll (*(const char *const *) a, *(const char *const *) b);
+}
+
+int
+main (void)
+{
+  static char pool[NSTR][24];
+  static const char *a[NSTR], *b[NSTR];
+  unsigned seed = 1;
+  char buf[8];
+  int i, j, len;
+
+  for (i = 0; i < NSTR; i++)
+    {
+      /* Short strings from few letters, so that many share a prefix */
+      seed = seed * 1103515245 + 12345;
+      len = (seed >> 16) % 20;
+      for (j = 0; j < len; j++)
+	{
+	  seed = seed * 1103515245 + 12345;
+	  pool[i][j] = "aab\xe9Z"[(seed >> 16) % 5];
+	}
+      pool[i][len] = '\0';
+      a[i] = b[i] = pool[i];
+    }
+
+  CHECK (strcollsort (a, NSTR) == 0);
+  qsort (b, NSTR, sizeof (b[0]), coll_cmp);
+  for (i = 0; i < NSTR; i++)
+    CHECK (strcmp (a[i], b[i]) == 0);
+  for (i = 1; i < NSTR; i++)
+    CHECK (strcoll (a[i - 1], a[i]) <= 0);
+
+  CHECK (strcollsort (a, 0) == 0);
+  CHECK (strcollsort (a, 1) == 0);
+
+  CHECK (strxfrm (buf, "abc", sizeof (buf)) == 3);
+  CHECK (strcmp (buf, "abc") == 0);
+  memset (buf, '-', sizeof (buf));
+  CHECK (strxfrm (buf, "abcdef", 3) == 6);
+  CHECK (buf[3] == '-');
+  CHECK (strxfrm (NULL, "abcdef", 0) == 6);
+
+  exit (0);
+}
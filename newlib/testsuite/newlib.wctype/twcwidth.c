@@ -0,0 +1,81 @@
+/* Check Unicode classification and wcwidth on characters from different
+   scripts and planes, and report their speed on mixed-script text.  */
+
+#define _XOPEN_SOURCE 700	/* for wcwidth */
+#include <stdio.h>
+#include <stdlib.h>
+#include <locale.h>
+#include <time.h>
+#include <wchar.h>
+#include <wctype.h>
+#include <newlib.h>
+#include "check.h"
+
+#ifdef _MB_CAPABLE
+
+#define BENCH_LOOPS 200
+
+/* Latin, Greek, Cyrillic, Hebrew with points, CJK, Hangul, symbols */
+static const wchar_t text[] =
+  L"Plain text, \x00e9t\x00e9 \x03b1\x03b2\x03b3 \x0416\x0438\x0437\x043d\x044c "
+  L"\x05e9\x05c1\x05dc\x05d5\x05b9\x05dd \x4e2d\x6587\x5b57 \xd55c\xae00 "
+  L"\x2014 \x00bd \x3002 \xff21\xff22 \x0301\x200b 12345 ";
+
+int
+main (void)
+{
+  clock_t t;
+  size_t i;
+  int j;
+  long n;
+
+  if (!setlocale (LC_CTYPE, "C.UTF-8"))
+    exit (0);
+
+  CHECK (iswalpha (0x00e9) && iswlower (0x00e9) && !iswupper (0x00e9));
+  CHECK (iswupper (0x0416) && towlower (0x0416) == 0x0436);
+  CHECK (iswalpha (0x05d0) && !iswalpha (0x05b9));
+  CHECK (iswalpha (0x4e2d) && iswalpha (0xd55c));
+  CHECK (iswalpha (0x20000) && iswalpha (0x2a6d6));
+  CHECK (iswpunct (0x2014) && iswpunct (0x3002));
+  CHECK (iswdigit (L'7') && !iswdigit (0x0663));
+  /* No-break spaces are category Zs, which counts as space here.  */
+  CHECK (iswspace (0x3000) && iswspace (0x00a0) && !iswspace (0x200b));
+  CHECK (iswcntrl (0x0085) && iswcntrl (0x2028));
+  CHECK (!iswprint (0xd800) && !iswprint (0x0378));
+  CHECK (iswprint (0xe0100) && !iswprint (0xe0000));
+  CHECK (!iswprint (0x10ffff) && !iswprint (0x110000));
+
+  CHECK (wcwidth (L'a') == 1 && wcwidth (0) == 0 && wcwidth (0x0085) == -1);
+  CHECK (wcwidth (0x00e9) == 1 && wcwidth (0x00bd) == 1);
+  CHECK (wcwidth (0x0301) == 0 && wcwidth (0x200b) == 0);
+  CHECK (wcwidth (0x00ad) == 1 && wcwidth (0x1160) == 0);
+  CHECK (wcwidth (0x4e2d) == 2 && wcwidth (0xd55c) == 2);
+  CHECK (wcwidth (0xff21) == 2 && wcwidth (0x3002) == 2);
+  CHECK (wcwidth (0x1f600) == 2 && wcwidth (0x20000) == 2);
+  CHECK (wcwidth (0xe0100) == 0 && wcwidth (0xd800) == -1);
+
+  t = clock ();
+  n = 0;
+  for (j = 0; j < BENCH_LOOPS; j++)
+    for (i = 0; i < sizeof (text) / sizeof (text[0]) - 1; i++)
+      n += iswalpha (text[i]) + iswpunct (text[i]) + wcwidth (text[i]);
+  t = clock () - t;
+  CHECK (n > 0);
+
+  printf ("iswalpha+iswpunct+wcwidth %8.1f Mchar/s\n",
+	  t > 0 ? (double) BENCH_LOOPS * (sizeof (text) / sizeof (text[0]) - 1)
+		  / 1e6 * CLOCKS_PER_SEC / t : 0.0);
+
+  exit (0);
+}
+
+#else
+
+int
+main (void)
+{
+  exit (0);
+}
+
+#endif
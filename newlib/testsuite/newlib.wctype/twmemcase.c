@@ -0,0 +1,100 @@
+/* Check the bulk case conversion and classification extensions against
+   their single character counterparts.  */
+
+#include <locale.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+#include <wctype.h>
+#include <newlib.h>
+#include "check.h"
+
+static const wchar_t text[] =
+  L"Mixed CASE text with some PUNCTUATION, digits 0123 and\ttabs "
+#ifdef _MB_CAPABLE
+  L"\x00c9t\x00e9 \x0394\x03b9\x03ac \x0416\x0438\x0437\x043d\x044c "
+  L"\x0130\x0131 \x01c5 \x1e9e \x2c65 \x4e2d\xff21\xff41 "
+#endif
+  L"and a long ASCII tail to cover whole blocks";
+
+int
+main (void)
+{
+  wchar_t buf[sizeof (text) / sizeof (text[0])];
+  size_t n = sizeof (text) / sizeof (text[0]) - 1;
+  size_t i, len;
+  char u[64];
+#ifdef _MB_CAPABLE
+  static const char *const classes[] = {
+    "alnum", "alpha", "blank", "cntrl", "digit", "graph",
+    "lower", "print", "punct", "space", "upper", "xdigit"
+  };
+  wchar_t c;
+  int k;
+#endif
+
+  CHECK (wmemtolower (buf, text, n) == buf);
+  for (i = 0; i < n; i++)
+    CHECK ((wint_t) buf[i] == towlower (text[i]));
+
+  CHECK (wmemtoupper (buf, text, n) == buf);
+  for (i = 0; i < n; i++)
+    CHECK ((wint_t) buf[i] == towupper (text[i]));
+
+  /* In place */
+  wmemcpy (buf, text, n);
+  wmemtolower (buf, buf, n);
+  for (i = 0; i < n; i++)
+    CHECK ((wint_t) buf[i] == towlower (text[i]));
+
+  CHECK (wmemctype (text, n, wctype ("alpha")) == 5);
+  CHECK (wmemctype (text, n, wctype ("print")) == 54);
+  CHECK (wmemctype (L" \t x", 4, wctype ("blank")) == 3);
+  CHECK (wmemctype (L"0123x", 5, wctype ("digit")) == 4);
+  CHECK (wmemctype (L"abc", 3, wctype ("upper")) == 0);
+  CHECK (wmemctype (L"abc", 3, 0) == 0);
+
+  CHECK (wcscasecmp (L"Hello, World", L"hELLO, wORLD") == 0);
+  CHECK (wcscasecmp (L"abc", L"ABD") < 0);
+  CHECK (wcscasecmp (L"abcd", L"ABC") > 0);
+  CHECK (wcscasecmp (L"", L"") == 0);
+  CHECK (wcsncasecmp (L"abcdefghijklmnopqrstuvwxyz0123456789abcdefX",
+		      L"ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789ABCDEFY", 42) == 0);
+  CHECK (wcsncasecmp (L"abcdefghijklmnopqrstuvwxyz0123456789abcdefX",
+		      L"ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789ABCDEFY", 43) < 0);
+  CHECK (wcsncasecmp (L"ab", L"AB", 10) == 0);
+  CHECK (wcsncasecmp (L"x", L"y", 0) == 0);
+
+  len = utf8toupper (u, sizeof (u), "Hello, World! long enough", 25);
+  CHECK (len == 25 && memcmp (u, "HELLO, WORLD! LONG ENOUGH", 25) == 0);
+  len = utf8tolower (u, sizeof (u), "ABC\xff" "DEF", 7);
+  CHECK (len == 7 && memcmp (u, "abc\xff" "def", 7) == 0);
+#ifdef _MB_CAPABLE
+  CHECK (wcscasecmp (L"\x0416\x0438\x0437\x043d\x044c",
+		     L"\x0436\x0418\x0417\x041d\x042c") == 0);
+
+  /* Length changes: U+0130 lowercases to 'i', U+2C65 uppercases to U+023A */
+  len = utf8tolower (u, sizeof (u), "\xc4\xb0Stanbul", 9);
+  CHECK (len == 8 && memcmp (u, "istanbul", 8) == 0);
+  len = utf8toupper (u, sizeof (u), "x\xe2\xb1\xa5y", 5);
+  CHECK (len == 4 && memcmp (u, "X\xc8\xba" "Y", 4) == 0);
+
+  /* Nothing is stored past a character which doesn't fit */
+  memset (u, '-', sizeof (u));
+  len = utf8toupper (u, 2, "a\xc3\xa9z", 4);
+  CHECK (len == 4 && u[0] == 'A' && u[1] == '-');
+
+  /* SJIS wide characters are not Unicode, not even below 0x80, so
+     wmemctype must classify them like iswctype does.  */
+  if (setlocale (LC_CTYPE, "C.SJIS") != NULL)
+    {
+      for (k = 0; k < 12; k++)
+	for (c = 0; c < 0x80; c++)
+	  CHECK (wmemctype (&c, 1, wctype (classes[k]))
+		 == (iswctype (c, wctype (classes[k])) != 0));
+      setlocale (LC_CTYPE, "C");
+    }
+#endif
+
+  exit (0);
+}
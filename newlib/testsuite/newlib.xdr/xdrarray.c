@@ -0,0 +1,186 @@
+/* Check that xdr_array and xdr_vector give the same stream for the
+   primitive filters they convert in bulk as for a filter they don't know,
+   check the in-place opaque data functions, and report the speed of both
+   array paths.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <rpc/types.h>
+#include <rpc/xdr.h>
+#include "check.h"
+
+#define NELEM 1000
+#define BENCH_LOOPS 2000
+
+static bool_t
+my_int (XDR *xdrs, int *ip)
+{
+  return xdr_int (xdrs, ip);
+}
+
+static bool_t
+my_hyper (XDR *xdrs, quad_t *hp)
+{
+  return xdr_hyper (xdrs, hp);
+}
+
+static bool_t
+my_double (XDR *xdrs, double *dp)
+{
+  return xdr_double (xdrs, dp);
+}
+
+static u_int
+encode (char *buf, u_int size, char *vec, u_int nelem, u_int elsize,
+	xdrproc_t elproc)
+{
+  XDR xdrs;
+  u_int pos;
+
+  xdrmem_create (&xdrs, buf, size, XDR_ENCODE);
+  if (!xdr_vector (&xdrs, vec, nelem, elsize, elproc))
+    return 0;
+  pos = xdr_getpos (&xdrs);
+  xdr_destroy (&xdrs);
+  return pos;
+}
+
+static int
+decode (char *buf, u_int size, char *vec, u_int nelem, u_int elsize,
+	xdrproc_t elproc)
+{
+  XDR xdrs;
+  int ret;
+
+  xdrmem_create (&xdrs, buf, size, XDR_DECODE);
+  ret = xdr_vector (&xdrs, vec, nelem, elsize, elproc);
+  xdr_destroy (&xdrs);
+  return ret;
+}
+
+static double
+bench (char *buf, u_int size, int *vec, xdrproc_t elproc)
+{
+  clock_t t = clock ();
+  int i;
+
+  for (i = 0; i < BENCH_LOOPS; i++)
+    {
+      CHECK (encode (buf, size, (char *) vec, NELEM, sizeof (int), elproc));
+      CHECK (decode (buf, size, (char *) vec, NELEM, sizeof (int), elproc));
+    }
+  return (double) (clock () - t) / CLOCKS_PER_SEC;
+}
+
+int
+main (void)
+{
+  static int ints[NELEM], ints2[NELEM];
+  static quad_t hypers[NELEM], hypers2[NELEM];
+  static double doubles[NELEM], doubles2[NELEM];
+  static char buf[NELEM * 8 + 8], buf2[NELEM * 8 + 8];
+  u_int len, len2, count;
+  char *p, *data = "opaque";
+  XDR xdrs;
+  int i;
+
+  for (i = 0; i < NELEM; i++)
+    {
+      ints[i] = (int) (i * 0x01020304U - 7);
+      hypers[i] = (quad_t) ints[i] << 20 | i;
+      doubles[i] = ints[i] / 3.0;
+    }
+
+  len = encode (buf, sizeof (buf), (char *) ints, NELEM, sizeof (int),
+		(xdrproc_t) xdr_int);
+  len2 = encode (buf2, sizeof (buf2), (char *) ints, NELEM, sizeof (int),
+		 (xdrproc_t) my_int);
+  CHECK (len == NELEM * 4 && len2 == len);
+  CHECK (memcmp (buf, buf2, len) == 0);
+  CHECK (decode (buf, len, (char *) ints2, NELEM, sizeof (int),
+		 (xdrproc_t) xdr_int));
+  CHECK (memcmp (ints, ints2, sizeof (ints)) == 0);
+  /* Short input */
+  CHECK (!decode (buf, len - 4, (char *) ints2, NELEM, sizeof (int),
+		  (xdrproc_t) xdr_int));
+
+  len = encode (buf, sizeof (buf), (char *) hypers, NELEM, sizeof (quad_t),
+		(xdrproc_t) xdr_hyper);
+  len2 = encode (buf2, sizeof (buf2), (char *) hypers, NELEM,
+		 sizeof (quad_t), (xdrproc_t) my_hyper);
+  CHECK (len == NELEM * 8 && len2 == len);
+  CHECK (memcmp (buf, buf2, len) == 0);
+  CHECK (decode (buf, len, (char *) hypers2, NELEM, sizeof (quad_t),
+		 (xdrproc_t) xdr_hyper));
+  CHECK (memcmp (hypers, hypers2, sizeof (hypers)) == 0);
+
+  len = encode (buf, sizeof (buf), (char *) doubles, NELEM, sizeof (double),
+		(xdrproc_t) xdr_double);
+  len2 = encode (buf2, sizeof (buf2), (char *) doubles, NELEM,
+		 sizeof (double), (xdrproc_t) my_double);
+  CHECK (len == NELEM * 8 && len2 == len);
+  CHECK (memcmp (buf, buf2, len) == 0);
+  CHECK (decode (buf, len, (char *) doubles2, NELEM, sizeof (double),
+		 (xdrproc_t) xdr_double));
+  CHECK (memcmp (doubles, doubles2, sizeof (doubles)) == 0);
+
+  /* Counted array through an unaligned buffer takes the element loop */
+  xdrmem_create (&xdrs, buf + 1, sizeof (buf) - 1, XDR_ENCODE);
+  p = (char *) ints;
+  count = NELEM;
+  CHECK (xdr_array (&xdrs, &p, &count, NELEM, sizeof (int),
+		    (xdrproc_t) xdr_int));
+  CHECK (xdr_getpos (&xdrs) == 4 + NELEM * 4);
+  xdr_destroy (&xdrs);
+  CHECK (encode (buf2, sizeof (buf2), (char *) ints, NELEM, sizeof (int),
+		 (xdrproc_t) xdr_int) == NELEM * 4);
+  CHECK (memcmp (buf + 5, buf2, NELEM * 4) == 0);
+  xdrmem_create (&xdrs, buf + 1, sizeof (buf) - 1, XDR_DECODE);
+  p = NULL;
+  CHECK (xdr_array (&xdrs, &p, &count, NELEM, sizeof (int),
+		    (xdrproc_t) xdr_int));
+  CHECK (count == NELEM && memcmp (p, ints, sizeof (ints)) == 0);
+  xdr_destroy (&xdrs);
+  xdrmem_create (&xdrs, NULL, 0, XDR_FREE);
+  CHECK (xdr_array (&xdrs, &p, &count, NELEM, sizeof (int),
+		    (xdrproc_t) xdr_int));
+  CHECK (p == NULL);
+
+  /* In-place opaque data, padded to a unit */
+  memset (buf, '-', sizeof (buf));
+  xdrmem_create (&xdrs, buf, sizeof (buf), XDR_ENCODE);
+  len = strlen (data);
+  CHECK (xdr_bytes_inline (&xdrs, &p, &len, 16));
+  CHECK (p == buf + 4);
+  memcpy (p, data, len);
+  CHECK (xdr_getpos (&xdrs) == 12);
+  CHECK (p[6] == 0 && p[7] == 0 && buf[12] == '-');
+  len = strlen (data);
+  CHECK (!xdr_bytes_inline (&xdrs, &p, &len, 5));
+  xdr_destroy (&xdrs);
+
+  xdrmem_create (&xdrs, buf, 12, XDR_DECODE);
+  CHECK (xdr_bytes_inline (&xdrs, &p, &len, 16));
+  CHECK (len == 6 && p == buf + 4 && memcmp (p, data, 6) == 0);
+  xdr_destroy (&xdrs);
+
+  xdrmem_create (&xdrs, buf, 8, XDR_DECODE);
+  CHECK (!xdr_opaque_inline (&xdrs, &p, 9));
+  xdr_destroy (&xdrs);
+
+  /* xdr_opaque pads like before */
+  memset (buf, '-', sizeof (buf));
+  xdrmem_create (&xdrs, buf, sizeof (buf), XDR_ENCODE);
+  CHECK (xdr_opaque (&xdrs, data, 6));
+  CHECK (xdr_getpos (&xdrs) == 8 && memcmp (buf, "opaque\0\0-", 9) == 0);
+  xdr_destroy (&xdrs);
+
+  printf ("bulk:     %8.3f s\n",
+	  bench (buf, sizeof (buf), ints, (xdrproc_t) xdr_int));
+  printf ("per item: %8.3f s\n",
+	  bench (buf, sizeof (buf), ints, (xdrproc_t) my_int));
+
+  exit (0);
+}
@@ -0,0 +1,183 @@
+/* Check record streams in non-blocking mode, with a channel which takes
+   and gives only part of the data at a time and sometimes none at all,
+   and check that ended records are written in a single batch.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <rpc/types.h>
+#include <rpc/xdr.h>
+#include "check.h"
+
+#define NREC 3000
+#define MAXLEN 600
+
+struct channel
+{
+  char data[1 << 16];
+  int head, tail;
+  int chunk;		/* most bytes moved by one call */
+  int blocked;		/* fail with EAGAIN */
+  int writes;
+};
+
+static int
+chan_write (void *handle, void *buf, int len)
+{
+  struct channel *ch = handle;
+
+  ch->writes++;
+  if (ch->blocked)
+    {
+      errno = EAGAIN;
+      return -1;
+    }
+  if (ch->chunk && len > ch->chunk)
+    len = ch->chunk;
+  if (ch->head > 0)
+    {
+      memmove (ch->data, ch->data + ch->head, ch->tail - ch->head);
+      ch->tail -= ch->head;
+      ch->head = 0;
+    }
+  if (len > (int) sizeof (ch->data) - ch->tail)
+    len = sizeof (ch->data) - ch->tail;
+  memcpy (ch->data + ch->tail, buf, len);
+  ch->tail += len;
+  return len;
+}
+
+static int
+chan_read (void *handle, void *buf, int len)
+{
+  struct channel *ch = handle;
+
+  if (ch->head == ch->tail || ch->blocked)
+    {
+      errno = EAGAIN;
+      return -1;
+    }
+  if (ch->chunk && len > ch->chunk)
+    len = ch->chunk;
+  if (len > ch->tail - ch->head)
+    len = ch->tail - ch->head;
+  memcpy (buf, ch->data + ch->head, len);
+  ch->head += len;
+  return len;
+}
+
+static bool_t
+put_record (XDR *xdrs, int i, int *vals)
+{
+  u_int n = (i * 37) % MAXLEN;
+  int j;
+
+  for (j = 0; j < (int) n; j++)
+    vals[j] = i + j;
+  return xdr_int (xdrs, &i) && xdr_array (xdrs, (char **) &vals, &n, MAXLEN,
+					  sizeof (int), (xdrproc_t) xdr_int);
+}
+
+static bool_t
+check_record (XDR *xdrs, int i, int *vals)
+{
+  u_int n;
+  int j, k;
+
+  if (!xdr_int (xdrs, &k) || k != i)
+    return FALSE;
+  if (!xdr_array (xdrs, (char **) &vals, &n, MAXLEN, sizeof (int),
+		  (xdrproc_t) xdr_int) || n != (i * 37) % MAXLEN)
+    return FALSE;
+  for (j = 0; j < (int) n; j++)
+    if (vals[j] != i + j)
+      return FALSE;
+  return TRUE;
+}
+
+int
+main (void)
+{
+  static struct channel ch;
+  static int vals[MAXLEN];
+  XDR out, in;
+  int i, got, r, k, sendnow;
+  clock_t t;
+
+  xdrrec_create (&out, 256, 256, &ch, chan_read, chan_write);
+  xdrrec_create (&in, 256, 256, &ch, chan_read, chan_write);
+  CHECK (xdrrec_setnonblock (&out, 0));
+  CHECK (xdrrec_setnonblock (&in, 4 * MAXLEN + 64));
+  out.x_op = XDR_ENCODE;
+  in.x_op = XDR_DECODE;
+
+  t = clock ();
+  for (i = got = k = 0; got < NREC; k++)
+    {
+      /* Odd chunk sizes split headers and data everywhere */
+      ch.chunk = 1 + (k * 13) % 900;
+      ch.blocked = k % 5 == 0;
+      if (i < NREC)
+	{
+	  CHECK (put_record (&out, i, vals));
+	  sendnow = i % 3 == 0;
+	  CHECK (xdrrec_endofrecord (&out, sendnow));
+	  i++;
+	}
+      else
+	CHECK (xdrrec_flush (&out) >= 0);
+      while ((r = xdrrec_getrec (&in)) == 1)
+	{
+	  CHECK (check_record (&in, got, vals));
+	  got++;
+	}
+      CHECK (r == 0);
+      CHECK (ch.head <= ch.tail);
+    }
+  t = clock () - t;
+  ch.blocked = 0;
+  CHECK (xdrrec_flush (&out) == 1);
+  CHECK (xdrrec_getrec (&in) == 0);
+  CHECK (xdrrec_eof (&in));
+  printf ("%d records in %.3f s\n", NREC, (double) t / CLOCKS_PER_SEC);
+
+  /* A fragment header larger than allowed */
+  ch.head = ch.tail = 0;
+  CHECK (put_record (&out, 1, vals));
+  CHECK (xdrrec_endofrecord (&out, TRUE));
+  CHECK (xdrrec_flush (&out) == 1);
+  xdr_destroy (&in);
+  xdrrec_create (&in, 256, 256, &ch, chan_read, chan_write);
+  CHECK (xdrrec_setnonblock (&in, 16));
+  CHECK (xdrrec_getrec (&in) == -1);
+  xdr_destroy (&in);
+  xdr_destroy (&out);
+
+  /* Blocking stream: ended records go out together */
+  ch.head = ch.tail = ch.chunk = ch.writes = 0;
+  xdrrec_create (&out, 4000, 4000, &ch, chan_read, chan_write);
+  xdrrec_create (&in, 4000, 4000, &ch, chan_read, chan_write);
+  out.x_op = XDR_ENCODE;
+  in.x_op = XDR_DECODE;
+  for (i = 0; i < 10; i++)
+    {
+      CHECK (xdr_int (&out, &i));
+      CHECK (xdrrec_endofrecord (&out, FALSE));
+    }
+  CHECK (ch.writes == 0);
+  CHECK (xdrrec_flush (&out) == 1);
+  CHECK (ch.writes == 1 && ch.tail == 10 * 8);
+  CHECK (xdrrec_flush (&out) == 1);
+  CHECK (ch.writes == 1);
+  for (i = 0; i < 10; i++)
+    {
+      CHECK (xdrrec_skiprecord (&in));
+      CHECK (xdr_int (&in, &r) && r == i);
+    }
+  xdr_destroy (&in);
+  xdr_destroy (&out);
+
+  exit (0);
+}